@@ -0,0 +1,165 @@
+#ifndef DATETIME_BENCH_DATA_H
+#define DATETIME_BENCH_DATA_H
+
+#include <datetime/datetime.h>
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * Data the benchmarks run over. Generated from fixed seeds, so every build benchmarks the same
+ * values and results can be compared between builds.
+ */
+namespace bench
+{
+/**
+ * Sizes of the data sets: about what fits in the L1 cache, and what does not fit in the L2.
+ */
+constexpr int64_t SMALL = 1 << 10;
+constexpr int64_t LARGE = 1 << 16;
+
+/**
+ * Xorshift random number generator.
+ */
+class Random
+{
+public:
+    explicit Random(uint64_t seed = 88172645463325252ull) :
+        state(seed) {}
+
+    /**
+     * Gets the next random number.
+     */
+    uint64_t next()
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return state;
+    }
+
+    /**
+     * Gets a random number from 0 up to, but not including, 'bound'.
+     */
+    uint64_t below(uint64_t bound)
+    {
+        return next() % bound;
+    }
+
+private:
+    uint64_t state;
+};
+
+/**
+ * Creates 'count' datetimes spread over several years and a mix of timezones.
+ */
+inline std::vector<Datetime> make_datetimes(size_t count)
+{
+    constexpr std::array<Timezone, 4> timezones = {TZ::UTC, TZ::EST, TZ::CST, TZ::PST};
+
+    std::vector<Datetime> datetimes;
+    datetimes.reserve(count);
+    Random random;
+    for (size_t i = 0; i < count; i++)
+    {
+        uint64_t state = random.next();
+        datetimes.push_back(Datetime(2000 + state % 20, 1 + state / 20 % 12, 1 + state / 240 % 28,
+                                     state / 6720 % 24, state / 161280 % 60, 0, 0, 0, 0,
+                                     timezones[i % timezones.size()]));
+    }
+    return datetimes;
+}
+
+/**
+ * Creates 'count' ascending datetimes of one trading session from 09:30 in New York, a few
+ * microseconds to a few milliseconds apart, like the timestamps of market data.
+ */
+inline std::vector<Datetime> make_ticks(size_t count)
+{
+    std::vector<Datetime> datetimes;
+    datetimes.reserve(count);
+    Random random = Random(42);
+    Datetime datetime = Datetime(2024, 3, 15, 9, 30, 0, 0, 0, 0, TZ::EST);
+    for (size_t i = 0; i < count; i++)
+    {
+        // Mostly bursts of close ticks, with the occasional quiet spell.
+        uint64_t gap = random.below(8) == 0 ? random.below(5'000'000) : random.below(20'000);
+        datetime += Nanoseconds(static_cast<int64_t>(gap));
+        datetimes.push_back(datetime);
+    }
+    return datetimes;
+}
+
+/**
+ * Creates 'count' milliseconds since the unix epoch, uniform from 1970 to 2100.
+ */
+inline std::vector<size_t> make_epoch_milliseconds(size_t count)
+{
+    std::vector<size_t> milliseconds;
+    milliseconds.reserve(count);
+    Random random = Random(7);
+    for (size_t i = 0; i < count; i++)
+        milliseconds.push_back(random.below(4'133'980'800'000ull));
+    return milliseconds;
+}
+
+/**
+ * Creates 'count' dates uniform from 1970 to 2100.
+ */
+inline std::vector<Date> make_dates(size_t count)
+{
+    std::vector<Date> dates;
+    dates.reserve(count);
+    Random random = Random(11);
+    for (size_t i = 0; i < count; i++)
+        dates.push_back(Date::from_day_number(static_cast<int64_t>(random.below(47'846))));
+    return dates;
+}
+
+/**
+ * Creates 'count' times of day with every component random.
+ */
+inline std::vector<Time> make_times(size_t count)
+{
+    std::vector<Time> times;
+    times.reserve(count);
+    Random random = Random(13);
+    for (size_t i = 0; i < count; i++)
+    {
+        uint64_t state = random.next();
+        times.push_back(Time(state % 24, state / 24 % 60, state / 1'440 % 60,
+                             state / 86'400 % 1'000, state / 86'400'000 % 1'000,
+                             state / 86'400'000'000 % 1'000, TZ::UTC));
+    }
+    return times;
+}
+
+/**
+ * Gets the 'to_string' representation of each of 'values'.
+ */
+template<typename T>
+std::vector<std::string> to_strings(const std::vector<T>& values)
+{
+    std::vector<std::string> strings;
+    strings.reserve(values.size());
+    for (const T& value : values)
+        strings.push_back(value.to_string());
+    return strings;
+}
+
+/**
+ * Gets the ISO 8601 representation of each of 'datetimes', as 'Datetime(std::string_view)'
+ * parses it.
+ */
+inline std::vector<std::string> to_iso_strings(const std::vector<Datetime>& datetimes)
+{
+    std::vector<std::string> strings;
+    strings.reserve(datetimes.size());
+    for (const Datetime& datetime : datetimes)
+        strings.push_back(fmt::format("{:%Y-%m-%dT%H:%M:%S.%9f%z}", datetime));
+    return strings;
+}
+}
+
+#endif //DATETIME_BENCH_DATA_H
@@ -0,0 +1,194 @@
+#include <benchmark/benchmark.h>
+#include <datetime/datetime.h>
+#include <chrono>
+#include <ctime>
+
+namespace
+{
+/**
+ * 'Time::now' as it was before 'Clock': the hour, minute and second from 'std::localtime', the
+ * rest from 'high_resolution_clock', then converted from local time to 'timezone'.
+ *
+ * Kept here so the benchmarks below can compare against it.
+ */
+Time localtime_time_now(Timezone timezone)
+{
+    std::time_t now = std::time(nullptr);
+    std::tm local_tm = *std::localtime(&now);
+
+    auto nanoseconds = std::chrono::time_point_cast<std::chrono::nanoseconds>(
+        std::chrono::high_resolution_clock::now() + std::chrono::hours(local_tm.tm_hour));
+    auto count = nanoseconds.time_since_epoch().count();
+
+    Time time = Time(local_tm.tm_hour, local_tm.tm_min, local_tm.tm_sec,
+                     count / 1'000'000 % 1'000, count / 1'000 % 1'000, count % 1'000, TZ::LOCAL);
+    time.set_timezone(timezone);
+    return time;
+}
+
+/**
+ * 'Date::today' as it was before 'Clock', reading 'std::localtime' and then 'Time::now' again
+ * to adjust for 'timezone'.
+ */
+Date localtime_date_today(Timezone timezone)
+{
+    std::time_t t = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+    std::tm* now_tm = std::localtime(&t);
+
+    Date ret = Date(now_tm->tm_year + 1900, now_tm->tm_mon + 1, now_tm->tm_mday);
+    if (timezone != TZ::LOCAL)
+    {
+        int hour = localtime_time_now(TZ::LOCAL).hour
+                   + TZ::local().get_utc_offset_diff(timezone).value / 60;
+        if (hour >= 24)
+            ret += Days(1);
+        else if (hour < 0)
+            ret -= Days(1);
+    }
+    return ret;
+}
+
+/**
+ * 'Datetime::now' as it was before the per-thread cached day, working out the date from the
+ * day number on every call.
+ */
+Datetime uncached_datetime_now(Timezone timezone)
+{
+    constexpr int64_t NANOSECONDS_PER_DAY = Timestamp::NANOSECONDS_PER_DAY;
+    int64_t nanoseconds = Clock::now()
+                          - timezone.utc_offset_minutes * Timestamp::NANOSECONDS_PER_MINUTE;
+    int64_t days = nanoseconds / NANOSECONDS_PER_DAY - (nanoseconds % NANOSECONDS_PER_DAY < 0);
+    nanoseconds -= days * NANOSECONDS_PER_DAY;
+
+    Date date = Date::from_day_number(days);
+    return Datetime(UNCHECKED, date.year, date.month, date.day,
+                    nanoseconds / Timestamp::NANOSECONDS_PER_HOUR,
+                    nanoseconds / Timestamp::NANOSECONDS_PER_MINUTE % 60,
+                    nanoseconds / Timestamp::NANOSECONDS_PER_SECOND % 60,
+                    nanoseconds / Timestamp::NANOSECONDS_PER_MILLISECOND % 1'000,
+                    nanoseconds / Timestamp::NANOSECONDS_PER_MICROSECOND % 1'000,
+                    nanoseconds % Timestamp::NANOSECONDS_PER_MICROSECOND,
+                    timezone);
+}
+}
+
+static void BM_Datetime_now_localtime(benchmark::State& state)
+{
+    for (auto _ : state)
+        benchmark::DoNotOptimize(Datetime(localtime_date_today(TZ::EST),
+                                          localtime_time_now(TZ::EST)));
+}
+BENCHMARK(BM_Datetime_now_localtime);
+
+static void BM_Clock_system(benchmark::State& state)
+{
+    for (auto _ : state)
+        benchmark::DoNotOptimize(Clock::system());
+}
+BENCHMARK(BM_Clock_system);
+
+static void BM_Clock_tsc(benchmark::State& state)
+{
+    Clock::tsc_available();
+    for (auto _ : state)
+        benchmark::DoNotOptimize(Clock::tsc());
+}
+BENCHMARK(BM_Clock_tsc);
+
+static void BM_Datetime_now(benchmark::State& state)
+{
+    for (auto _ : state)
+        benchmark::DoNotOptimize(Datetime::now(0, 0, 0, 0, 0, 0, 0, TZ::EST));
+}
+BENCHMARK(BM_Datetime_now)->ThreadRange(1, 64);
+
+static void BM_Datetime_now_uncached(benchmark::State& state)
+{
+    for (auto _ : state)
+        benchmark::DoNotOptimize(uncached_datetime_now(TZ::EST));
+}
+BENCHMARK(BM_Datetime_now_uncached)->ThreadRange(1, 64);
+
+static void BM_Datetime_now_timezones(benchmark::State& state)
+{
+    // Alternates between timezones, each keeping its own cached day.
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(Datetime::now(0, 0, 0, 0, 0, 0, 0, TZ::EST));
+        benchmark::DoNotOptimize(Datetime::now(0, 0, 0, 0, 0, 0, 0, TZ::UTC));
+    }
+}
+BENCHMARK(BM_Datetime_now_timezones)->ThreadRange(1, 64);
+
+static void BM_Datetime_now_tsc(benchmark::State& state)
+{
+    Clock::Source previous = Clock::get_source();
+    Clock::set_source(Clock::tsc);
+    for (auto _ : state)
+        benchmark::DoNotOptimize(Datetime::now(0, 0, 0, 0, 0, 0, 0, TZ::EST));
+    Clock::set_source(previous);
+}
+BENCHMARK(BM_Datetime_now_tsc);
+
+static void BM_Time_now(benchmark::State& state)
+{
+    for (auto _ : state)
+        benchmark::DoNotOptimize(Time::now(0, 0, 0, 0, 0, 0, TZ::EST));
+}
+BENCHMARK(BM_Time_now);
+
+static void BM_Date_today(benchmark::State& state)
+{
+    for (auto _ : state)
+        benchmark::DoNotOptimize(Date::today(0, TZ::EST));
+}
+BENCHMARK(BM_Date_today)->ThreadRange(1, 64);
+
+/**
+ * 'CoarseClock' shared by the reader benchmarks below, refreshed every millisecond.
+ */
+static const CoarseClock& coarse_clock()
+{
+    static const CoarseClock clock = CoarseClock(Milliseconds(1), TZ::EST);
+    return clock;
+}
+
+static void BM_CoarseClock_now_nanoseconds(benchmark::State& state)
+{
+    const CoarseClock& clock = coarse_clock();
+    for (auto _ : state)
+        benchmark::DoNotOptimize(clock.now_nanoseconds());
+}
+BENCHMARK(BM_CoarseClock_now_nanoseconds)->ThreadRange(1, 64);
+
+static void BM_CoarseClock_now(benchmark::State& state)
+{
+    const CoarseClock& clock = coarse_clock();
+    for (auto _ : state)
+        benchmark::DoNotOptimize(clock.now());
+}
+BENCHMARK(BM_CoarseClock_now)->ThreadRange(1, 64);
+
+static void BM_CoarseClock_to_chars(benchmark::State& state)
+{
+    const CoarseClock& clock = coarse_clock();
+    char buffer[Datetime::MAX_CHARS];
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(clock.to_chars(buffer, buffer + Datetime::MAX_CHARS));
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_CoarseClock_to_chars)->ThreadRange(1, 64);
+
+static void BM_Datetime_now_to_chars(benchmark::State& state)
+{
+    char buffer[Datetime::MAX_CHARS];
+    for (auto _ : state)
+    {
+        Datetime now = Datetime::now(0, 0, 0, 0, 0, 0, 0, TZ::EST);
+        benchmark::DoNotOptimize(now.to_chars(buffer, buffer + Datetime::MAX_CHARS));
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_Datetime_now_to_chars)->ThreadRange(1, 64);
@@ -0,0 +1,122 @@
+#include <benchmark/benchmark.h>
+#include <datetime/datetime.h>
+#include "bench_data.h"
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+static void BM_Date_construct(benchmark::State& state)
+{
+    std::vector<Date> dates = bench::make_dates(state.range(0));
+    for (auto _ : state)
+        for (Date date : dates)
+            benchmark::DoNotOptimize(Date(date.year, date.month, date.day));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Date_construct)->Arg(bench::SMALL)->Arg(bench::LARGE);
+
+static void BM_Date_construct_string(benchmark::State& state)
+{
+    std::vector<std::string> strings = bench::to_strings(bench::make_dates(state.range(0)));
+    for (auto _ : state)
+        for (const std::string& string : strings)
+            benchmark::DoNotOptimize(Date(string));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Date_construct_string)->Arg(bench::SMALL)->Arg(bench::LARGE);
+
+static void BM_Date_to_string(benchmark::State& state)
+{
+    std::vector<Date> dates = bench::make_dates(state.range(0));
+    for (auto _ : state)
+        for (Date date : dates)
+            benchmark::DoNotOptimize(date.to_string());
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Date_to_string)->Arg(bench::SMALL)->Arg(bench::LARGE);
+
+static void BM_Date_add_days(benchmark::State& state)
+{
+    std::vector<Date> dates = bench::make_dates(state.range(0));
+    for (auto _ : state)
+    {
+        for (Date& date : dates)
+            date += Days(30);
+        benchmark::DoNotOptimize(dates.data());
+        for (Date& date : dates)
+            date -= Days(30);
+        benchmark::DoNotOptimize(dates.data());
+    }
+    state.SetItemsProcessed(state.iterations() * 2 * state.range(0));
+}
+BENCHMARK(BM_Date_add_days)->Arg(bench::SMALL)->Arg(bench::LARGE);
+
+static void BM_Date_subtract_date(benchmark::State& state)
+{
+    std::vector<Date> dates = bench::make_dates(state.range(0));
+    for (auto _ : state)
+        for (size_t i = 1; i < dates.size(); i++)
+            benchmark::DoNotOptimize(dates[i] - dates[i - 1]);
+    state.SetItemsProcessed(state.iterations() * (state.range(0) - 1));
+}
+BENCHMARK(BM_Date_subtract_date)->Arg(bench::SMALL)->Arg(bench::LARGE);
+
+static void BM_Date_less_than(benchmark::State& state)
+{
+    std::vector<Date> dates = bench::make_dates(state.range(0));
+    for (auto _ : state)
+    {
+        size_t less = 0;
+        for (size_t i = 1; i < dates.size(); i++)
+            less += dates[i - 1] < dates[i];
+        benchmark::DoNotOptimize(less);
+    }
+    state.SetItemsProcessed(state.iterations() * (state.range(0) - 1));
+}
+BENCHMARK(BM_Date_less_than)->Arg(bench::SMALL)->Arg(bench::LARGE);
+
+static void BM_Date_day_of_week(benchmark::State& state)
+{
+    std::vector<Date> dates = bench::make_dates(state.range(0));
+    for (auto _ : state)
+        for (Date date : dates)
+            benchmark::DoNotOptimize(date.day_of_week());
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Date_day_of_week)->Arg(bench::SMALL)->Arg(bench::LARGE);
+
+static void BM_Date_hash(benchmark::State& state)
+{
+    std::vector<Date> dates = bench::make_dates(state.range(0));
+    for (auto _ : state)
+        for (Date date : dates)
+            benchmark::DoNotOptimize(hash_value(date));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Date_hash)->Arg(bench::SMALL)->Arg(bench::LARGE);
+
+static void BM_Date_unordered_set_insert(benchmark::State& state)
+{
+    std::vector<Date> dates = bench::make_dates(state.range(0));
+    for (auto _ : state)
+    {
+        std::unordered_set<Date> set;
+        set.reserve(dates.size());
+        set.insert(dates.begin(), dates.end());
+        benchmark::DoNotOptimize(set.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Date_unordered_set_insert)->Arg(bench::SMALL)->Arg(bench::LARGE);
+
+static void BM_Date_range(benchmark::State& state)
+{
+    // Every day of a decade.
+    for (auto _ : state)
+    {
+        std::vector<Date> dates = Date::range(Date(2014, 1, 1), Date(2024, 1, 1));
+        benchmark::DoNotOptimize(dates.data());
+    }
+    state.SetItemsProcessed(state.iterations() * 3'653);
+}
+BENCHMARK(BM_Date_range);
@@ -0,0 +1,155 @@
+#include <benchmark/benchmark.h>
+#include <datetime/datetime.h>
+#include "bench_data.h"
+#include <vector>
+
+/*
+ * Each operation on a 'DatetimeArray' next to the same operation on a 'std::vector<Datetime>',
+ * over the ticks of a trading session.
+ */
+
+namespace
+{
+const Datetime OPEN = Datetime(2024, 3, 15, 9, 45, 0, 0, 0, 0, TZ::EST);
+const Datetime CLOSE = Datetime(2024, 3, 15, 9, 50, 0, 0, 0, 0, TZ::EST);
+}
+
+static void BM_DatetimeArray_from_datetimes(benchmark::State& state)
+{
+    std::vector<Datetime> datetimes = bench::make_ticks(state.range(0));
+    for (auto _ : state)
+    {
+        DatetimeArray array = DatetimeArray(datetimes, TZ::EST);
+        benchmark::DoNotOptimize(array.get_epoch_nanoseconds().data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_DatetimeArray_from_datetimes)->Arg(bench::SMALL)->Arg(bench::LARGE);
+
+static void BM_DatetimeArray_to_datetimes(benchmark::State& state)
+{
+    DatetimeArray array = DatetimeArray(bench::make_ticks(state.range(0)), TZ::EST);
+    for (auto _ : state)
+    {
+        std::vector<Datetime> datetimes = array.to_datetimes();
+        benchmark::DoNotOptimize(datetimes.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_DatetimeArray_to_datetimes)->Arg(bench::SMALL)->Arg(bench::LARGE);
+
+static void BM_DatetimeArray_add_time_delta(benchmark::State& state)
+{
+    DatetimeArray array = DatetimeArray(bench::make_ticks(state.range(0)), TZ::EST);
+    for (auto _ : state)
+    {
+        array += TimeDelta(0, 0, 0, 0, 0, 1);
+        benchmark::DoNotOptimize(array.get_epoch_nanoseconds().data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_DatetimeArray_add_time_delta)->Arg(bench::SMALL)->Arg(bench::LARGE);
+
+static void BM_Datetimes_add_time_delta(benchmark::State& state)
+{
+    std::vector<Datetime> datetimes = bench::make_ticks(state.range(0));
+    for (auto _ : state)
+    {
+        for (Datetime& datetime : datetimes)
+            datetime += TimeDelta(0, 0, 0, 0, 0, 1);
+        benchmark::DoNotOptimize(datetimes.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Datetimes_add_time_delta)->Arg(bench::SMALL)->Arg(bench::LARGE);
+
+static void BM_DatetimeArray_floor(benchmark::State& state)
+{
+    std::vector<Datetime> datetimes = bench::make_ticks(bench::LARGE);
+    TimeComponent component = static_cast<TimeComponent>(state.range(0));
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        DatetimeArray array = DatetimeArray(datetimes, TZ::EST);
+        state.ResumeTiming();
+
+        array.floor(component);
+        benchmark::DoNotOptimize(array.get_epoch_nanoseconds().data());
+    }
+    state.SetItemsProcessed(state.iterations() * bench::LARGE);
+}
+BENCHMARK(BM_DatetimeArray_floor)
+    ->Arg(static_cast<int>(TimeComponent::MINUTE))
+    ->Arg(static_cast<int>(TimeComponent::MICROSECOND));
+
+static void BM_Datetimes_floor(benchmark::State& state)
+{
+    std::vector<Datetime> ticks = bench::make_ticks(bench::LARGE);
+    TimeComponent component = static_cast<TimeComponent>(state.range(0));
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        std::vector<Datetime> datetimes = ticks;
+        state.ResumeTiming();
+
+        for (Datetime& datetime : datetimes)
+            datetime.floor(component);
+        benchmark::DoNotOptimize(datetimes.data());
+    }
+    state.SetItemsProcessed(state.iterations() * bench::LARGE);
+}
+BENCHMARK(BM_Datetimes_floor)
+    ->Arg(static_cast<int>(TimeComponent::MINUTE))
+    ->Arg(static_cast<int>(TimeComponent::MICROSECOND));
+
+static void BM_DatetimeArray_day_of_week(benchmark::State& state)
+{
+    DatetimeArray array = DatetimeArray(bench::make_datetimes(state.range(0)), TZ::EST);
+    for (auto _ : state)
+    {
+        std::vector<uint8_t> days = array.day_of_week();
+        benchmark::DoNotOptimize(days.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_DatetimeArray_day_of_week)->Arg(bench::SMALL)->Arg(bench::LARGE);
+
+static void BM_Datetimes_day_of_week(benchmark::State& state)
+{
+    std::vector<Datetime> datetimes = bench::make_datetimes(state.range(0));
+    for (auto _ : state)
+    {
+        std::vector<uint8_t> days(datetimes.size());
+        for (size_t i = 0; i < datetimes.size(); i++)
+            days[i] = datetimes[i].date().day_of_week();
+        benchmark::DoNotOptimize(days.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Datetimes_day_of_week)->Arg(bench::SMALL)->Arg(bench::LARGE);
+
+static void BM_DatetimeArray_between(benchmark::State& state)
+{
+    DatetimeArray array = DatetimeArray(bench::make_ticks(state.range(0)), TZ::EST);
+    for (auto _ : state)
+    {
+        std::vector<uint8_t> mask = array.between(OPEN, CLOSE);
+        benchmark::DoNotOptimize(mask.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_DatetimeArray_between)->Arg(bench::SMALL)->Arg(bench::LARGE);
+
+static void BM_Datetimes_between(benchmark::State& state)
+{
+    std::vector<Datetime> datetimes = bench::make_ticks(state.range(0));
+    for (auto _ : state)
+    {
+        std::vector<uint8_t> mask(datetimes.size());
+        for (size_t i = 0; i < datetimes.size(); i++)
+            mask[i] = datetimes[i] >= OPEN && datetimes[i] < CLOSE;
+        benchmark::DoNotOptimize(mask.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Datetimes_between)->Arg(bench::SMALL)->Arg(bench::LARGE);
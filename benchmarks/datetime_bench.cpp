@@ -0,0 +1,336 @@
+#include <benchmark/benchmark.h>
+#include <datetime/datetime.h>
+#include "bench_data.h"
+#include <algorithm>
+#include <array>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+static void BM_Datetime_less_than(benchmark::State& state)
+{
+    Datetime lhs = Datetime(2000, 1, 1, 12, 0, 0, 0, 0, 0, TZ::EST);
+    Datetime rhs = Datetime(2000, 1, 1, 12, 0, 0, 0, 0, 0, TZ::CST);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(lhs);
+        benchmark::DoNotOptimize(rhs);
+        benchmark::DoNotOptimize(lhs < rhs);
+    }
+}
+BENCHMARK(BM_Datetime_less_than);
+
+static void BM_Datetime_sort(benchmark::State& state)
+{
+    std::vector<Datetime> datetimes = bench::make_datetimes(state.range(0));
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        std::vector<Datetime> copy = datetimes;
+        state.ResumeTiming();
+        std::sort(copy.begin(), copy.end());
+        benchmark::DoNotOptimize(copy.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Datetime_sort)->Arg(1 << 16);
+
+static void BM_Datetime_hash(benchmark::State& state)
+{
+    Datetime datetime = Datetime(2000, 1, 1, 12, 0, 0, 0, 0, 0, TZ::EST);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(datetime);
+        benchmark::DoNotOptimize(std::hash<Datetime>{}(datetime));
+    }
+}
+BENCHMARK(BM_Datetime_hash);
+
+namespace
+{
+/**
+ * 'Datetime::range' as it was before the lazy views: pushes every datetime into a 'std::vector'
+ * that was never reserved.
+ *
+ * Kept here so the benchmarks below can compare against it.
+ */
+std::vector<Datetime> push_back_range(Datetime start, Datetime end, Seconds increment)
+{
+    std::vector<Datetime> ret;
+    Datetime current_datetime = start;
+    while (current_datetime <= end)
+    {
+        ret.push_back(current_datetime);
+        current_datetime += increment;
+    }
+    return ret;
+}
+
+const Datetime RANGE_START = Datetime(2023, 1, 1, 0, 0, 0, 0, 0, 0, TZ::UTC);
+const Datetime RANGE_END = Datetime(2023, 1, 2, 0, 0, 0, 0, 0, 0, TZ::UTC);
+}
+
+static void BM_Datetime_range_push_back(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        std::vector<Datetime> datetimes = push_back_range(RANGE_START, RANGE_END, Seconds(1));
+        benchmark::DoNotOptimize(datetimes.data());
+    }
+    state.SetItemsProcessed(state.iterations() * 86'401);
+}
+BENCHMARK(BM_Datetime_range_push_back);
+
+static void BM_Datetime_range(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        std::vector<Datetime> datetimes = Datetime::range(RANGE_START, RANGE_END, Seconds(1));
+        benchmark::DoNotOptimize(datetimes.data());
+    }
+    state.SetItemsProcessed(state.iterations() * 86'401);
+}
+BENCHMARK(BM_Datetime_range);
+
+static void BM_Datetime_iota(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        for (Datetime datetime : Datetime::iota(RANGE_START, RANGE_END, Seconds(1)))
+            benchmark::DoNotOptimize(datetime);
+    }
+    state.SetItemsProcessed(state.iterations() * 86'401);
+}
+BENCHMARK(BM_Datetime_iota);
+
+static void BM_Datetime_iota_index(benchmark::State& state)
+{
+    IotaView<Datetime, Seconds> view = Datetime::iota(RANGE_START, RANGE_END, Seconds(1));
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(view[i]);
+        i = (i + 7919) % view.size();
+    }
+}
+BENCHMARK(BM_Datetime_iota_index);
+
+static void BM_Datetime_from_ms(benchmark::State& state)
+{
+    std::vector<size_t> milliseconds = bench::make_epoch_milliseconds(state.range(0));
+    for (auto _ : state)
+        for (size_t value : milliseconds)
+            benchmark::DoNotOptimize(Datetime::from_ms(value, TZ::EST));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Datetime_from_ms)->Arg(bench::SMALL)->Arg(bench::LARGE);
+
+static void BM_Datetime_to_ms(benchmark::State& state)
+{
+    std::vector<Datetime> datetimes = bench::make_datetimes(state.range(0));
+    for (auto _ : state)
+        for (const Datetime& datetime : datetimes)
+            benchmark::DoNotOptimize(datetime.to_ms());
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Datetime_to_ms)->Arg(bench::SMALL)->Arg(bench::LARGE);
+
+static void BM_Datetime_less_than_random(benchmark::State& state)
+{
+    // Neighbours in random order, in mixed timezones, so the branch is unpredictable.
+    std::vector<Datetime> datetimes = bench::make_datetimes(state.range(0));
+    for (auto _ : state)
+    {
+        size_t less = 0;
+        for (size_t i = 1; i < datetimes.size(); i++)
+            less += datetimes[i - 1] < datetimes[i];
+        benchmark::DoNotOptimize(less);
+    }
+    state.SetItemsProcessed(state.iterations() * (state.range(0) - 1));
+}
+BENCHMARK(BM_Datetime_less_than_random)->Arg(bench::SMALL)->Arg(bench::LARGE);
+
+static void BM_Datetime_less_than_ticks(benchmark::State& state)
+{
+    std::vector<Datetime> datetimes = bench::make_ticks(state.range(0));
+    for (auto _ : state)
+    {
+        size_t less = 0;
+        for (size_t i = 1; i < datetimes.size(); i++)
+            less += datetimes[i - 1] < datetimes[i];
+        benchmark::DoNotOptimize(less);
+    }
+    state.SetItemsProcessed(state.iterations() * (state.range(0) - 1));
+}
+BENCHMARK(BM_Datetime_less_than_ticks)->Arg(bench::SMALL)->Arg(bench::LARGE);
+
+static void BM_Datetime_equal(benchmark::State& state)
+{
+    std::vector<Datetime> datetimes = bench::make_datetimes(state.range(0));
+    for (auto _ : state)
+    {
+        size_t equal = 0;
+        for (size_t i = 1; i < datetimes.size(); i++)
+            equal += datetimes[i - 1] == datetimes[i];
+        benchmark::DoNotOptimize(equal);
+    }
+    state.SetItemsProcessed(state.iterations() * (state.range(0) - 1));
+}
+BENCHMARK(BM_Datetime_equal)->Arg(bench::SMALL)->Arg(bench::LARGE);
+
+/**
+ * Adds 'Step(AMOUNT)' to each of a set of datetimes, as rolling a column of timestamps forward.
+ */
+template<typename Step, int64_t AMOUNT>
+static void BM_Datetime_add(benchmark::State& state)
+{
+    std::vector<Datetime> datetimes = bench::make_datetimes(state.range(0));
+    for (auto _ : state)
+    {
+        for (Datetime& datetime : datetimes)
+            datetime += Step(AMOUNT);
+        benchmark::DoNotOptimize(datetimes.data());
+        for (Datetime& datetime : datetimes)
+            datetime -= Step(AMOUNT);
+        benchmark::DoNotOptimize(datetimes.data());
+    }
+    state.SetItemsProcessed(state.iterations() * 2 * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_Datetime_add, Nanoseconds, 1500)
+    ->Arg(bench::SMALL)->Arg(bench::LARGE);
+BENCHMARK_TEMPLATE(BM_Datetime_add, Seconds, 90)
+    ->Arg(bench::SMALL)->Arg(bench::LARGE);
+BENCHMARK_TEMPLATE(BM_Datetime_add, Hours, 30)
+    ->Arg(bench::SMALL)->Arg(bench::LARGE);
+BENCHMARK_TEMPLATE(BM_Datetime_add, Days, 45)
+    ->Arg(bench::SMALL)->Arg(bench::LARGE);
+
+static void BM_Datetime_add_time_delta(benchmark::State& state)
+{
+    std::vector<Datetime> datetimes = bench::make_datetimes(state.range(0));
+    TimeDelta delta = TimeDelta(3, 4, 5, 6, 7, 8, 9);
+    for (auto _ : state)
+    {
+        for (Datetime& datetime : datetimes)
+            datetime += delta;
+        benchmark::DoNotOptimize(datetimes.data());
+        for (Datetime& datetime : datetimes)
+            datetime -= delta;
+        benchmark::DoNotOptimize(datetimes.data());
+    }
+    state.SetItemsProcessed(state.iterations() * 2 * state.range(0));
+}
+BENCHMARK(BM_Datetime_add_time_delta)->Arg(bench::SMALL)->Arg(bench::LARGE);
+
+static void BM_Datetime_subtract_datetime(benchmark::State& state)
+{
+    // Gaps between consecutive ticks.
+    std::vector<Datetime> datetimes = bench::make_ticks(state.range(0));
+    for (auto _ : state)
+        for (size_t i = 1; i < datetimes.size(); i++)
+            benchmark::DoNotOptimize(datetimes[i] - datetimes[i - 1]);
+    state.SetItemsProcessed(state.iterations() * (state.range(0) - 1));
+}
+BENCHMARK(BM_Datetime_subtract_datetime)->Arg(bench::SMALL)->Arg(bench::LARGE);
+
+static void BM_Datetime_set_timezone(benchmark::State& state)
+{
+    std::vector<Datetime> datetimes = bench::make_datetimes(state.range(0));
+    for (auto _ : state)
+    {
+        for (Datetime& datetime : datetimes)
+            datetime.set_timezone(TZ::UTC);
+        benchmark::DoNotOptimize(datetimes.data());
+        for (Datetime& datetime : datetimes)
+            datetime.set_timezone(TZ::PST);
+        benchmark::DoNotOptimize(datetimes.data());
+    }
+    state.SetItemsProcessed(state.iterations() * 2 * state.range(0));
+}
+BENCHMARK(BM_Datetime_set_timezone)->Arg(bench::SMALL)->Arg(bench::LARGE);
+
+static void BM_Datetime_round(benchmark::State& state)
+{
+    std::vector<Datetime> ticks = bench::make_ticks(state.range(0));
+    for (auto _ : state)
+    {
+        for (Datetime datetime : ticks)
+            benchmark::DoNotOptimize(datetime.round(TimeComponent::SECOND));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Datetime_round)->Arg(bench::SMALL)->Arg(bench::LARGE);
+
+static void BM_Datetime_construct_string_iso(benchmark::State& state)
+{
+    std::vector<std::string> strings = bench::to_iso_strings(bench::make_ticks(state.range(0)));
+    for (auto _ : state)
+        for (const std::string& string : strings)
+            benchmark::DoNotOptimize(Datetime(string));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Datetime_construct_string_iso)->Arg(bench::SMALL)->Arg(bench::LARGE);
+
+static void BM_Datetime_construct_string_components(benchmark::State& state)
+{
+    std::vector<std::string> strings = bench::to_strings(bench::make_ticks(state.range(0)));
+    for (auto _ : state)
+        for (const std::string& string : strings)
+            benchmark::DoNotOptimize(Datetime(string, DateComponent::YEAR, DateComponent::MONTH,
+                                              DateComponent::DAY, TimeComponent::HOUR,
+                                              TimeComponent::MINUTE, TimeComponent::SECOND,
+                                              TimeComponent::MILLISECOND,
+                                              TimeComponent::MICROSECOND,
+                                              TimeComponent::NANOSECOND,
+                                              TimeComponent::TIMEZONE));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Datetime_construct_string_components)->Arg(bench::SMALL)->Arg(bench::LARGE);
+
+static void BM_Datetime_to_string_array(benchmark::State& state)
+{
+    std::vector<Datetime> datetimes = bench::make_ticks(state.range(0));
+    for (auto _ : state)
+        for (const Datetime& datetime : datetimes)
+            benchmark::DoNotOptimize(datetime.to_string());
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Datetime_to_string_array)->Arg(bench::SMALL)->Arg(bench::LARGE);
+
+static void BM_Datetime_hash_array(benchmark::State& state)
+{
+    std::vector<Datetime> datetimes = bench::make_datetimes(state.range(0));
+    for (auto _ : state)
+        for (const Datetime& datetime : datetimes)
+            benchmark::DoNotOptimize(hash_value(datetime));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Datetime_hash_array)->Arg(bench::SMALL)->Arg(bench::LARGE);
+
+static void BM_Datetime_unordered_set_insert(benchmark::State& state)
+{
+    std::vector<Datetime> datetimes = bench::make_ticks(state.range(0));
+    for (auto _ : state)
+    {
+        std::unordered_set<Datetime> set;
+        set.reserve(datetimes.size());
+        set.insert(datetimes.begin(), datetimes.end());
+        benchmark::DoNotOptimize(set.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Datetime_unordered_set_insert)->Arg(bench::SMALL)->Arg(bench::LARGE);
+
+static void BM_Datetime_range_minutes(benchmark::State& state)
+{
+    // Every minute bar of a trading session.
+    Datetime open = Datetime(2024, 3, 15, 9, 30, 0, 0, 0, 0, TZ::EST);
+    Datetime close = Datetime(2024, 3, 15, 16, 0, 0, 0, 0, 0, TZ::EST);
+    for (auto _ : state)
+    {
+        std::vector<Datetime> bars = Datetime::range(open, close, Minutes(1));
+        benchmark::DoNotOptimize(bars.data());
+    }
+    state.SetItemsProcessed(state.iterations() * 391);
+}
+BENCHMARK(BM_Datetime_range_minutes);
@@ -0,0 +1,112 @@
+#include <benchmark/benchmark.h>
+#include <datetime/datetime.h>
+#include <stringhelpers/stringhelpers.h>
+#include <sstream>
+
+namespace
+{
+/**
+ * Formats 'datetime' the way 'to_string' did before 'to_chars': through a
+ * 'std::stringstream', with each field going through 'std::to_string' and 'strh::align'.
+ *
+ * Kept here so the benchmarks below can compare against it.
+ */
+std::string stringstream_to_string(const Datetime& datetime)
+{
+    std::string date = std::to_string(datetime.year)
+                       + '-'
+                       + strh::align(std::to_string(datetime.month), strh::Alignment::LEFT, 2, '0')
+                       + '-'
+                       + strh::align(std::to_string(datetime.day), strh::Alignment::LEFT, 2, '0');
+
+    std::stringstream ss;
+    ss << static_cast<int>(datetime.hour);
+    ss << ':' << strh::align(std::to_string(datetime.minute), strh::Alignment::LEFT, 2, '0');
+    ss << ':' << strh::align(std::to_string(datetime.second), strh::Alignment::LEFT, 2, '0');
+    ss << '.' << static_cast<int>(datetime.millisecond);
+    ss << '.' << static_cast<int>(datetime.microsecond);
+    ss << '.' << static_cast<int>(datetime.nanosecond);
+
+    std::stringstream time;
+    time << ss.str() << '+' << fmt::format("{}:00", datetime.timezone.utc_offset_minutes / 60);
+
+    return date + ' ' + time.str();
+}
+}
+
+static void BM_Datetime_to_string_stringstream(benchmark::State& state)
+{
+    Datetime datetime = Datetime(2024, 1, 2, 9, 30, 15, 123, 456, 789);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(datetime);
+        benchmark::DoNotOptimize(stringstream_to_string(datetime));
+    }
+}
+BENCHMARK(BM_Datetime_to_string_stringstream);
+
+static void BM_Datetime_to_string(benchmark::State& state)
+{
+    Datetime datetime = Datetime(2024, 1, 2, 9, 30, 15, 123, 456, 789);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(datetime);
+        benchmark::DoNotOptimize(datetime.to_string());
+    }
+}
+BENCHMARK(BM_Datetime_to_string);
+
+static void BM_Datetime_to_chars(benchmark::State& state)
+{
+    Datetime datetime = Datetime(2024, 1, 2, 9, 30, 15, 123, 456, 789);
+    char buffer[Datetime::MAX_CHARS];
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(datetime);
+        benchmark::DoNotOptimize(datetime.to_chars(buffer, buffer + Datetime::MAX_CHARS));
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_Datetime_to_chars);
+
+static void BM_Datetime_ostream(benchmark::State& state)
+{
+    Datetime datetime = Datetime(2024, 1, 2, 9, 30, 15, 123, 456, 789);
+    std::stringstream ss;
+    for (auto _ : state)
+    {
+        ss.str(std::string());
+        benchmark::DoNotOptimize(datetime);
+        ss << datetime;
+        benchmark::DoNotOptimize(ss);
+    }
+}
+BENCHMARK(BM_Datetime_ostream);
+
+static void BM_Datetime_fmt_format_to_default(benchmark::State& state)
+{
+    Datetime datetime = Datetime(2024, 1, 2, 9, 30, 15, 123, 456, 789);
+    fmt::memory_buffer buffer;
+    for (auto _ : state)
+    {
+        buffer.clear();
+        benchmark::DoNotOptimize(datetime);
+        fmt::format_to(fmt::appender(buffer), "{}", datetime);
+        benchmark::DoNotOptimize(buffer.data());
+    }
+}
+BENCHMARK(BM_Datetime_fmt_format_to_default);
+
+static void BM_Datetime_fmt_format_to_iso(benchmark::State& state)
+{
+    Datetime datetime = Datetime(2024, 1, 2, 9, 30, 15, 123, 456, 789);
+    fmt::memory_buffer buffer;
+    for (auto _ : state)
+    {
+        buffer.clear();
+        benchmark::DoNotOptimize(datetime);
+        fmt::format_to(fmt::appender(buffer), "{:%Y-%m-%dT%H:%M:%S.%9f%z}", datetime);
+        benchmark::DoNotOptimize(buffer.data());
+    }
+}
+BENCHMARK(BM_Datetime_fmt_format_to_iso);
@@ -0,0 +1,162 @@
+#include <benchmark/benchmark.h>
+#include <datetime/datetime.h>
+#include <stringhelpers/stringhelpers.h>
+#include "bench_data.h"
+#include <string>
+#include <vector>
+
+namespace
+{
+/**
+ * Parses 'string' the way the string constructors did before the allocation free parser:
+ * split into a 'std::vector<std::string>' and 'std::stoi' on each number.
+ *
+ * Kept here so the benchmarks below can compare against it.
+ */
+Datetime split_stoi_parse(std::string_view string)
+{
+    std::vector<std::string> strs = strh::split_alphabetical(string);
+    return Datetime(std::stoi(strs[0]), std::stoi(strs[1]), std::stoi(strs[2]),
+                    std::stoi(strs[3]), std::stoi(strs[4]), std::stoi(strs[5]),
+                    std::stoi(strs[6]), std::stoi(strs[7]), std::stoi(strs[8]),
+                    Timezone(std::stoi(strs[9])));
+}
+}
+
+static void BM_Datetime_parse_split_stoi(benchmark::State& state)
+{
+    std::string_view string = "2024-01-02 9:30:15.123.456.789+5:00";
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(string);
+        benchmark::DoNotOptimize(split_stoi_parse(string));
+    }
+}
+BENCHMARK(BM_Datetime_parse_split_stoi);
+
+static void BM_Datetime_parse_components(benchmark::State& state)
+{
+    std::string_view string = "2024-01-02 9:30:15.123.456.789+5:00";
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(string);
+        benchmark::DoNotOptimize(Datetime(string,
+                                          DateComponent::YEAR,
+                                          DateComponent::MONTH,
+                                          DateComponent::DAY,
+                                          TimeComponent::HOUR,
+                                          TimeComponent::MINUTE,
+                                          TimeComponent::SECOND,
+                                          TimeComponent::MILLISECOND,
+                                          TimeComponent::MICROSECOND,
+                                          TimeComponent::NANOSECOND,
+                                          TimeComponent::TIMEZONE));
+    }
+}
+BENCHMARK(BM_Datetime_parse_components);
+
+static void BM_Datetime_parse_iso(benchmark::State& state)
+{
+    std::string_view string = "2024-01-02 09:30:15.123456789-05:00";
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(string);
+        benchmark::DoNotOptimize(Datetime(string));
+    }
+}
+BENCHMARK(BM_Datetime_parse_iso);
+
+namespace
+{
+/**
+ * Creates 'count' ISO 8601 rows, every 20th of which is invalid.
+ */
+std::vector<std::string> make_dirty_rows(size_t count)
+{
+    std::vector<std::string> rows;
+    rows.reserve(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        rows.push_back(i % 20 == 0 ? "2024-01-02 09:30:15.12345678x"
+                                   : "2024-01-02 09:30:15.123456789");
+    }
+    return rows;
+}
+}
+
+static void BM_Datetime_parse_dirty_throwing(benchmark::State& state)
+{
+    std::vector<std::string> rows = make_dirty_rows(1000);
+    for (auto _ : state)
+    {
+        for (const std::string& row : rows)
+        {
+            try
+            {
+                benchmark::DoNotOptimize(Datetime(row));
+            }
+            catch (const std::invalid_argument&) {}
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * rows.size());
+}
+BENCHMARK(BM_Datetime_parse_dirty_throwing);
+
+static void BM_Datetime_parse_dirty_try_parse(benchmark::State& state)
+{
+    std::vector<std::string> rows = make_dirty_rows(1000);
+    for (auto _ : state)
+    {
+        for (const std::string& row : rows)
+            benchmark::DoNotOptimize(Datetime::try_parse(row));
+    }
+    state.SetItemsProcessed(state.iterations() * rows.size());
+}
+BENCHMARK(BM_Datetime_parse_dirty_try_parse);
+
+namespace
+{
+/**
+ * Creates 'count' fixed width rows of microseconds, like the timestamp column of a vendor file.
+ */
+std::vector<std::string> make_fixed_rows(size_t count)
+{
+    std::vector<std::string> rows;
+    rows.reserve(count);
+    for (const Datetime& datetime : bench::make_ticks(count))
+        rows.push_back(fmt::format("{:%Y-%m-%d %H:%M:%S.%6f}", datetime));
+    return rows;
+}
+}
+
+static void BM_parse_fixed(benchmark::State& state)
+{
+    std::vector<std::string> strings = make_fixed_rows(bench::LARGE);
+    std::vector<std::string_view> rows(strings.begin(), strings.end());
+    std::vector<Timestamp> timestamps(rows.size());
+    FixedFormat format = FixedFormat("%Y-%m-%d %H:%M:%S.%6f", TZ::EST);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(parse_fixed(rows, format, timestamps));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * bench::LARGE);
+    state.SetBytesProcessed(state.iterations() * bench::LARGE * format.get_width());
+}
+BENCHMARK(BM_parse_fixed);
+
+static void BM_parse_fixed_datetime_constructor(benchmark::State& state)
+{
+    std::vector<std::string> rows = make_fixed_rows(bench::LARGE);
+    std::vector<Timestamp> timestamps(rows.size());
+    ScopedDefaultTimezone est = ScopedDefaultTimezone(TZ::EST);
+    for (auto _ : state)
+    {
+        for (size_t i = 0; i < rows.size(); i++)
+            timestamps[i] = Timestamp(Datetime(rows[i]));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * bench::LARGE);
+    state.SetBytesProcessed(state.iterations() * bench::LARGE * rows[0].size());
+}
+BENCHMARK(BM_parse_fixed_datetime_constructor);
@@ -0,0 +1,10 @@
+#include <datetime/datetime.h>
+
+/**
+ * Program that uses the library and does nothing else, run by 'BM_startup' to time how long a
+ * program using the library takes to start and exit.
+ */
+int main()
+{
+    return Datetime::now(0, 0, 0, 0, 0, 0, 0, TZ::UTC).year >= 1970 ? 0 : 1;
+}
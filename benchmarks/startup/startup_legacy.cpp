@@ -0,0 +1,36 @@
+#include <datetime/datetime.h>
+#include <chrono>
+#include <ctime>
+
+namespace
+{
+/**
+ * 'TZ::helpers::get_local_tz' as it was when 'TZ::LOCAL' was initialized during static
+ * initialization: the '%Z' name of the local time, matched against known names.
+ */
+Timezone legacy_get_local_tz()
+{
+    std::chrono::system_clock::time_point now = std::chrono::system_clock::now();
+    std::time_t now_time_t = std::chrono::system_clock::to_time_t(now);
+    std::tm* now_tm = std::localtime(&now_time_t);
+    char timezone_name[128];
+    std::strftime(timezone_name, sizeof(timezone_name), "%Z", now_tm);
+
+    return TZ::helpers::get_from_str(timezone_name);
+}
+
+/**
+ * Initialized during static initialization, as 'TZ::LOCAL' was in every program that included
+ * the library.
+ */
+[[maybe_unused]] const Timezone LEGACY_LOCAL = legacy_get_local_tz();
+}
+
+/**
+ * 'startup.cpp' with the local timezone read during static initialization, run by
+ * 'BM_startup_legacy' to compare against.
+ */
+int main()
+{
+    return Datetime::now(0, 0, 0, 0, 0, 0, 0, TZ::UTC).year >= 1970 ? 0 : 1;
+}
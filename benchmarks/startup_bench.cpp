@@ -0,0 +1,92 @@
+#include <benchmark/benchmark.h>
+#include <datetime/datetime.h>
+#include <chrono>
+#include <ctime>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <spawn.h>
+#include <sys/wait.h>
+
+extern char** environ;
+#endif
+
+namespace
+{
+/**
+ * 'TZ::LOCAL' as it was before it was read lazily: the '%Z' name of the local time, matched
+ * against known names, which throws for any other name.
+ */
+Timezone legacy_get_local_tz()
+{
+    std::chrono::system_clock::time_point now = std::chrono::system_clock::now();
+    std::time_t now_time_t = std::chrono::system_clock::to_time_t(now);
+    std::tm* now_tm = std::localtime(&now_time_t);
+    char timezone_name[128];
+    std::strftime(timezone_name, sizeof(timezone_name), "%Z", now_tm);
+
+    return TZ::helpers::get_from_str(timezone_name);
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+/**
+ * Starts the program at 'path' and waits for it to exit, on each iteration of 'state'.
+ */
+void run_program(benchmark::State& state, const char* path)
+{
+    char* argv[] = {const_cast<char*>(path), nullptr};
+    for (auto _ : state)
+    {
+        pid_t pid;
+        if (posix_spawn(&pid, path, nullptr, nullptr, argv, environ) != 0)
+        {
+            state.SkipWithError("could not start the program");
+            break;
+        }
+
+        int status = 0;
+        if (waitpid(pid, &status, 0) != pid || !WIFEXITED(status) || WEXITSTATUS(status) != 0)
+        {
+            state.SkipWithError("the program failed");
+            break;
+        }
+    }
+}
+#endif
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+static void BM_startup(benchmark::State& state)
+{
+    // A program using the library, which reads the local timezone only if it uses it.
+    run_program(state, DATETIME_STARTUP);
+}
+BENCHMARK(BM_startup)->Unit(benchmark::kMicrosecond)->UseRealTime();
+
+static void BM_startup_legacy(benchmark::State& state)
+{
+    // The same program reading the local timezone during static initialization.
+    run_program(state, DATETIME_STARTUP_LEGACY);
+}
+BENCHMARK(BM_startup_legacy)->Unit(benchmark::kMicrosecond)->UseRealTime();
+#endif
+
+static void BM_TZ_local(benchmark::State& state)
+{
+    for (auto _ : state)
+        benchmark::DoNotOptimize(TZ::local());
+}
+BENCHMARK(BM_TZ_local)->ThreadRange(1, 64);
+
+static void BM_TZ_get_local_tz(benchmark::State& state)
+{
+    for (auto _ : state)
+        benchmark::DoNotOptimize(TZ::helpers::get_local_tz());
+}
+BENCHMARK(BM_TZ_get_local_tz);
+
+static void BM_TZ_get_local_tz_legacy(benchmark::State& state)
+{
+    for (auto _ : state)
+        benchmark::DoNotOptimize(legacy_get_local_tz());
+}
+BENCHMARK(BM_TZ_get_local_tz_legacy);
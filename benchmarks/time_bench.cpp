@@ -0,0 +1,319 @@
+#include <benchmark/benchmark.h>
+#include <datetime/datetime.h>
+#include "bench_data.h"
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace
+{
+/**
+ * Time arithmetic as it was before the single-step normalization: each 'add_*' recomputes the
+ * 'total_*' of its component, then cascades the carry into the next larger component.
+ *
+ * Kept here so the benchmarks below can compare against it.
+ */
+class CascadeTime : public BasicTime
+{
+public:
+
+    using BasicTime::BasicTime;
+
+    virtual int64_t add_hours(int64_t hours_to_add)
+    {
+        int64_t hours = static_cast<int64_t>(hour) + hours_to_add;
+        hour = static_cast<uint8_t>(hours % HOURS_PER_DAY);
+        if (hours < 0)
+        {
+            hour += HOURS_PER_DAY;
+            return (hours - 23) / HOURS_PER_DAY;
+        }
+        else
+            return static_cast<int64_t>(hours) / HOURS_PER_DAY;
+    }
+
+    virtual void add_minutes(int64_t minutes_to_add)
+    {
+        int64_t new_total_minutes = total_minutes() + minutes_to_add;
+        int64_t new_total_hours = new_total_minutes / static_cast<int64_t>(MINUTES_PER_HOUR);
+        int64_t hour_change = new_total_hours - hour;
+        int new_minute = static_cast<int>(new_total_minutes % static_cast<int64_t>(MINUTES_PER_HOUR));
+        if (new_minute < 0)
+        {
+            new_minute += MINUTES_PER_HOUR;
+            hour_change--;
+        }
+        minute = new_minute;
+        add_hours(hour_change);
+    }
+
+    virtual void add_seconds(int64_t seconds_to_add)
+    {
+        int64_t new_total_seconds = total_seconds() + seconds_to_add;
+        int64_t new_total_minutes = new_total_seconds / static_cast<int64_t>(SECONDS_PER_MINUTE);
+        int64_t minute_change = new_total_minutes - total_minutes();
+        int new_second = static_cast<int>(new_total_seconds % static_cast<int64_t>(SECONDS_PER_MINUTE));
+        if (new_second < 0)
+        {
+            new_second += SECONDS_PER_MINUTE;
+            minute_change--;
+        }
+        second = new_second;
+        add_minutes(minute_change);
+    }
+
+    virtual void add_milliseconds(int64_t milliseconds_to_add)
+    {
+        int64_t new_total_milliseconds = total_milliseconds() + milliseconds_to_add;
+        int64_t new_total_seconds = new_total_milliseconds
+                                    / static_cast<int64_t>(MILLISECONDS_PER_SECOND);
+        int64_t second_change = new_total_seconds - total_seconds();
+        int new_millisecond = static_cast<int>(new_total_milliseconds
+                                               % static_cast<int64_t>(MILLISECONDS_PER_SECOND));
+        if (new_millisecond < 0)
+        {
+            new_millisecond += MILLISECONDS_PER_SECOND;
+            second_change--;
+        }
+        millisecond = new_millisecond;
+        add_seconds(second_change);
+    }
+
+    virtual void add_microseconds(int64_t microseconds_to_add)
+    {
+        int64_t new_total_microseconds = total_microseconds() + microseconds_to_add;
+        int64_t new_total_milliseconds = new_total_microseconds
+                                         / static_cast<int64_t>(MICROSECONDS_PER_MILLISECOND);
+        int64_t millisecond_change = new_total_milliseconds - total_milliseconds();
+        int new_microsecond = static_cast<int>(new_total_microseconds
+                                               % static_cast<int64_t>(MICROSECONDS_PER_MILLISECOND));
+        if (new_microsecond < 0)
+        {
+            new_microsecond += MICROSECONDS_PER_MILLISECOND;
+            millisecond_change--;
+        }
+        microsecond = new_microsecond;
+        add_milliseconds(millisecond_change);
+    }
+
+    virtual void add_nanoseconds(int64_t nanoseconds_to_add)
+    {
+        int64_t new_total_nanoseconds = total_nanoseconds() + nanoseconds_to_add;
+        int64_t new_total_microseconds = new_total_nanoseconds
+                                         / static_cast<int64_t>(NANOSECONDS_PER_MICROSECOND);
+        int64_t microsecond_change = new_total_microseconds - total_microseconds();
+        int new_nanosecond = static_cast<int>(new_total_nanoseconds
+                                              % static_cast<int64_t>(NANOSECONDS_PER_MICROSECOND));
+        if (new_nanosecond < 0)
+        {
+            new_nanosecond += NANOSECONDS_PER_MICROSECOND;
+            microsecond_change--;
+        }
+        nanosecond = new_nanosecond;
+        add_microseconds(microsecond_change);
+    }
+};
+
+/**
+ * Lock callers put around construction, and 'set_default_timezone', while the default
+ * 'Timezone' was a plain static.
+ */
+std::mutex construction_mutex;
+}
+
+static void BM_Time_add_nanoseconds_cascade(benchmark::State& state)
+{
+    CascadeTime time = CascadeTime(12, 30, 30, 500, 500, 500);
+    for (auto _ : state)
+    {
+        time.add_nanoseconds(1);
+        benchmark::DoNotOptimize(time);
+    }
+}
+BENCHMARK(BM_Time_add_nanoseconds_cascade);
+
+static void BM_Time_add_nanoseconds(benchmark::State& state)
+{
+    Time time = Time(12, 30, 30, 500, 500, 500);
+    for (auto _ : state)
+    {
+        time += Nanoseconds(1);
+        benchmark::DoNotOptimize(time);
+    }
+}
+BENCHMARK(BM_Time_add_nanoseconds);
+
+static void BM_Time_add_seconds_cascade(benchmark::State& state)
+{
+    CascadeTime time = CascadeTime(12, 30, 30, 500, 500, 500);
+    for (auto _ : state)
+    {
+        time.add_seconds(1);
+        benchmark::DoNotOptimize(time);
+    }
+}
+BENCHMARK(BM_Time_add_seconds_cascade);
+
+static void BM_Time_add_seconds(benchmark::State& state)
+{
+    Time time = Time(12, 30, 30, 500, 500, 500);
+    for (auto _ : state)
+    {
+        time += Seconds(1);
+        benchmark::DoNotOptimize(time);
+    }
+}
+BENCHMARK(BM_Time_add_seconds);
+
+static void BM_Datetime_add_nanoseconds(benchmark::State& state)
+{
+    Datetime datetime = Datetime(2000, 1, 1, 12, 30, 30, 500, 500, 500);
+    for (auto _ : state)
+    {
+        datetime += Nanoseconds(1);
+        benchmark::DoNotOptimize(datetime);
+    }
+}
+BENCHMARK(BM_Datetime_add_nanoseconds);
+
+static void BM_Datetime_add_hours(benchmark::State& state)
+{
+    Datetime datetime = Datetime(2000, 1, 1, 12, 30, 30, 500, 500, 500);
+    for (auto _ : state)
+    {
+        datetime += Hours(1);
+        datetime -= Hours(1);
+        benchmark::DoNotOptimize(datetime);
+    }
+}
+BENCHMARK(BM_Datetime_add_hours);
+
+static void BM_Datetime_construct_default_timezone_mutex(benchmark::State& state)
+{
+    // Construction as callers had to guard it before the default was atomic.
+    int hour = 3;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(hour);
+        std::lock_guard lock = std::lock_guard(construction_mutex);
+        benchmark::DoNotOptimize(Datetime(2000, 1, 2, hour, 4));
+    }
+}
+BENCHMARK(BM_Datetime_construct_default_timezone_mutex)->ThreadRange(1, 64);
+
+static void BM_Datetime_construct_default_timezone(benchmark::State& state)
+{
+    int hour = 3;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(hour);
+        benchmark::DoNotOptimize(Datetime(2000, 1, 2, hour, 4));
+    }
+}
+BENCHMARK(BM_Datetime_construct_default_timezone)->ThreadRange(1, 64);
+
+static void BM_Datetime_construct_scoped_default_timezone(benchmark::State& state)
+{
+    ScopedDefaultTimezone scope = ScopedDefaultTimezone(Timezone(state.thread_index() % 12));
+    int hour = 3;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(hour);
+        benchmark::DoNotOptimize(Datetime(2000, 1, 2, hour, 4));
+    }
+}
+BENCHMARK(BM_Datetime_construct_scoped_default_timezone)->ThreadRange(1, 64);
+
+static void BM_Datetime_construct_explicit_timezone(benchmark::State& state)
+{
+    int hour = 3;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(hour);
+        benchmark::DoNotOptimize(Datetime(2000, 1, 2, hour, 4, 0, 0, 0, 0, TZ::UTC));
+    }
+}
+BENCHMARK(BM_Datetime_construct_explicit_timezone)->ThreadRange(1, 64);
+
+static void BM_set_default_timezone(benchmark::State& state)
+{
+    // Writers do not slow down readers in other threads beyond sharing a cache line.
+    Timezone original = Time::get_default_timezone();
+    for (auto _ : state)
+        Time::set_default_timezone(state.iterations() % 2 == 0 ? TZ::UTC : TZ::EST);
+    Time::set_default_timezone(original);
+}
+BENCHMARK(BM_set_default_timezone);
+
+static void BM_Time_construct_string(benchmark::State& state)
+{
+    std::vector<std::string> strings = bench::to_strings(bench::make_times(state.range(0)));
+    for (auto _ : state)
+        for (const std::string& string : strings)
+            benchmark::DoNotOptimize(Time(string, TimeComponent::HOUR, TimeComponent::MINUTE,
+                                          TimeComponent::SECOND, TimeComponent::MILLISECOND,
+                                          TimeComponent::MICROSECOND, TimeComponent::NANOSECOND,
+                                          TimeComponent::TIMEZONE));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Time_construct_string)->Arg(bench::SMALL)->Arg(bench::LARGE);
+
+static void BM_Time_to_string(benchmark::State& state)
+{
+    std::vector<Time> times = bench::make_times(state.range(0));
+    for (auto _ : state)
+        for (const Time& time : times)
+            benchmark::DoNotOptimize(time.to_string());
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Time_to_string)->Arg(bench::SMALL)->Arg(bench::LARGE);
+
+static void BM_Time_less_than(benchmark::State& state)
+{
+    std::vector<Time> times = bench::make_times(state.range(0));
+    for (auto _ : state)
+    {
+        size_t less = 0;
+        for (size_t i = 1; i < times.size(); i++)
+            less += times[i - 1] < times[i];
+        benchmark::DoNotOptimize(less);
+    }
+    state.SetItemsProcessed(state.iterations() * (state.range(0) - 1));
+}
+BENCHMARK(BM_Time_less_than)->Arg(bench::SMALL)->Arg(bench::LARGE);
+
+static void BM_Time_add_minutes_array(benchmark::State& state)
+{
+    std::vector<Time> times = bench::make_times(state.range(0));
+    for (auto _ : state)
+    {
+        for (Time& time : times)
+            time += Minutes(95);
+        benchmark::DoNotOptimize(times.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Time_add_minutes_array)->Arg(bench::SMALL)->Arg(bench::LARGE);
+
+static void BM_Time_hash(benchmark::State& state)
+{
+    std::vector<Time> times = bench::make_times(state.range(0));
+    for (auto _ : state)
+        for (const Time& time : times)
+            benchmark::DoNotOptimize(hash_value(time));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Time_hash)->Arg(bench::SMALL)->Arg(bench::LARGE);
+
+static void BM_Time_range(benchmark::State& state)
+{
+    // Every second of a trading session.
+    for (auto _ : state)
+    {
+        std::vector<Time> times = Time::range(Time(9, 30, 0, 0, 0, 0, TZ::EST),
+                                              Time(16, 0, 0, 0, 0, 0, TZ::EST), Seconds(1));
+        benchmark::DoNotOptimize(times.data());
+    }
+    state.SetItemsProcessed(state.iterations() * 23'401);
+}
+BENCHMARK(BM_Time_range);
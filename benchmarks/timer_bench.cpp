@@ -0,0 +1,112 @@
+#include <benchmark/benchmark.h>
+#include <datetime/datetime.h>
+#include <functional>
+#include <queue>
+#include <vector>
+
+namespace
+{
+const Datetime START = Datetime(2023, 1, 1, 0, 0, 0, 0, 0, 0, TZ::UTC);
+
+/**
+ * Offsets from 'START', in microseconds, of 'count' deadlines spread over 'spread'
+ * microseconds.
+ */
+std::vector<int64_t> make_offsets(size_t count, uint64_t spread)
+{
+    std::vector<int64_t> offsets;
+    offsets.reserve(count);
+    uint64_t state = 88172645463325252ull;
+    for (size_t i = 0; i < count; i++)
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        offsets.push_back(static_cast<int64_t>(state % spread));
+    }
+    return offsets;
+}
+
+/**
+ * Timer as scheduled before 'TimerWheel': a deadline and a callback in a priority queue.
+ */
+struct QueuedTimer
+{
+    Datetime deadline;
+    std::function<void()> callback;
+
+    bool operator>(const QueuedTimer& other) const
+    {
+        return deadline > other.deadline;
+    }
+};
+
+using TimerQueue = std::priority_queue<QueuedTimer, std::vector<QueuedTimer>,
+                                       std::greater<QueuedTimer>>;
+}
+
+// Schedules timers over ten seconds, then polls every millisecond until all have fired.
+
+static void BM_TimerQueue_schedule_expire(benchmark::State& state)
+{
+    std::vector<int64_t> offsets = make_offsets(state.range(0), 10'000'000);
+    size_t fired = 0;
+    for (auto _ : state)
+    {
+        TimerQueue queue;
+        for (int64_t offset : offsets)
+            queue.push({START + Microseconds(offset), [&fired] { fired++; }});
+
+        for (Datetime now = START; !queue.empty(); now += Milliseconds(1))
+        {
+            while (!queue.empty() && queue.top().deadline <= now)
+            {
+                queue.top().callback();
+                queue.pop();
+            }
+        }
+    }
+    benchmark::DoNotOptimize(fired);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_TimerQueue_schedule_expire)->Arg(1 << 16);
+
+static void BM_TimerWheel_schedule_expire(benchmark::State& state)
+{
+    std::vector<int64_t> offsets = make_offsets(state.range(0), 10'000'000);
+    size_t fired = 0;
+    for (auto _ : state)
+    {
+        TimerWheel wheel = TimerWheel(Milliseconds(1), [] { return START; });
+        for (int64_t offset : offsets)
+            wheel.schedule(START + Microseconds(offset), [&fired] { fired++; });
+
+        for (Datetime now = START; !wheel.empty(); now += Milliseconds(1))
+            wheel.advance(now);
+    }
+    benchmark::DoNotOptimize(fired);
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_TimerWheel_schedule_expire)->Arg(1 << 16);
+
+// Order expiries that are nearly all cancelled before they fire: schedule one timer and cancel
+// the one scheduled 'range(0)' timers ago, with that many pending.
+
+static void BM_TimerWheel_schedule_cancel(benchmark::State& state)
+{
+    std::vector<int64_t> offsets = make_offsets(state.range(0), 60'000'000);
+    TimerWheel wheel = TimerWheel(Microseconds(1), [] { return START; });
+    std::vector<TimerWheel::TimerId> ids;
+    for (int64_t offset : offsets)
+        ids.push_back(wheel.schedule(START + Microseconds(offset), [] {}));
+
+    size_t i = 0;
+    for (auto _ : state)
+    {
+        wheel.cancel(ids[i]);
+        ids[i] = wheel.schedule(START + Microseconds(offsets[i]), [] {});
+        i = (i + 1) % ids.size();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TimerWheel_schedule_cancel)->Arg(1 << 16);
@@ -0,0 +1,131 @@
+#include <benchmark/benchmark.h>
+#include <datetime/datetime.h>
+#include "bench_data.h"
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+/**
+ * Gets the 'Timestamp' of each of 'datetimes'.
+ */
+std::vector<Timestamp> to_timestamps(const std::vector<Datetime>& datetimes)
+{
+    std::vector<Timestamp> timestamps;
+    timestamps.reserve(datetimes.size());
+    for (const Datetime& datetime : datetimes)
+        timestamps.push_back(Timestamp(datetime));
+    return timestamps;
+}
+}
+
+static void BM_Timestamp_from_datetime(benchmark::State& state)
+{
+    std::vector<Datetime> datetimes = bench::make_datetimes(state.range(0));
+    for (auto _ : state)
+        for (const Datetime& datetime : datetimes)
+            benchmark::DoNotOptimize(Timestamp(datetime));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Timestamp_from_datetime)->Arg(bench::SMALL)->Arg(bench::LARGE);
+
+static void BM_Timestamp_to_datetime(benchmark::State& state)
+{
+    std::vector<Timestamp> timestamps = to_timestamps(bench::make_datetimes(state.range(0)));
+    for (auto _ : state)
+        for (Timestamp timestamp : timestamps)
+            benchmark::DoNotOptimize(timestamp.datetime(TZ::EST));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Timestamp_to_datetime)->Arg(bench::SMALL)->Arg(bench::LARGE);
+
+static void BM_Timestamp_add_nanoseconds(benchmark::State& state)
+{
+    std::vector<Timestamp> timestamps = to_timestamps(bench::make_datetimes(state.range(0)));
+    for (auto _ : state)
+    {
+        for (Timestamp& timestamp : timestamps)
+            timestamp = timestamp + Nanoseconds(1'500);
+        benchmark::DoNotOptimize(timestamps.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Timestamp_add_nanoseconds)->Arg(bench::SMALL)->Arg(bench::LARGE);
+
+static void BM_Timestamp_less_than(benchmark::State& state)
+{
+    std::vector<Timestamp> timestamps = to_timestamps(bench::make_datetimes(state.range(0)));
+    for (auto _ : state)
+    {
+        size_t less = 0;
+        for (size_t i = 1; i < timestamps.size(); i++)
+            less += timestamps[i - 1] < timestamps[i];
+        benchmark::DoNotOptimize(less);
+    }
+    state.SetItemsProcessed(state.iterations() * (state.range(0) - 1));
+}
+BENCHMARK(BM_Timestamp_less_than)->Arg(bench::SMALL)->Arg(bench::LARGE);
+
+static void BM_Timestamp_sort(benchmark::State& state)
+{
+    std::vector<Timestamp> timestamps = to_timestamps(bench::make_datetimes(state.range(0)));
+    for (auto _ : state)
+    {
+        state.PauseTiming();
+        std::vector<Timestamp> copy = timestamps;
+        state.ResumeTiming();
+        std::sort(copy.begin(), copy.end());
+        benchmark::DoNotOptimize(copy.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Timestamp_sort)->Arg(bench::LARGE);
+
+static void BM_Timestamp_subtract_timestamp(benchmark::State& state)
+{
+    std::vector<Timestamp> timestamps = to_timestamps(bench::make_ticks(state.range(0)));
+    for (auto _ : state)
+        for (size_t i = 1; i < timestamps.size(); i++)
+            benchmark::DoNotOptimize(timestamps[i] - timestamps[i - 1]);
+    state.SetItemsProcessed(state.iterations() * (state.range(0) - 1));
+}
+BENCHMARK(BM_Timestamp_subtract_timestamp)->Arg(bench::SMALL)->Arg(bench::LARGE);
+
+static void BM_Timestamp_hash(benchmark::State& state)
+{
+    std::vector<Timestamp> timestamps = to_timestamps(bench::make_datetimes(state.range(0)));
+    for (auto _ : state)
+        for (Timestamp timestamp : timestamps)
+            benchmark::DoNotOptimize(hash_value(timestamp));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Timestamp_hash)->Arg(bench::SMALL)->Arg(bench::LARGE);
+
+static void BM_TimeDelta_to_chars(benchmark::State& state)
+{
+    std::vector<Datetime> ticks = bench::make_ticks(state.range(0));
+    std::vector<TimeDelta> deltas;
+    for (size_t i = 1; i < ticks.size(); i++)
+        deltas.push_back(ticks[i] - ticks.front());
+
+    char buffer[64];
+    for (auto _ : state)
+        for (TimeDelta delta : deltas)
+            benchmark::DoNotOptimize(delta.to_chars(buffer, buffer + sizeof(buffer)));
+    state.SetItemsProcessed(state.iterations() * deltas.size());
+}
+BENCHMARK(BM_TimeDelta_to_chars)->Arg(bench::SMALL)->Arg(bench::LARGE);
+
+static void BM_TimeDelta_total_nanoseconds(benchmark::State& state)
+{
+    std::vector<Datetime> ticks = bench::make_ticks(state.range(0));
+    std::vector<TimeDelta> deltas;
+    for (size_t i = 1; i < ticks.size(); i++)
+        deltas.push_back(ticks[i] - ticks[i - 1]);
+
+    for (auto _ : state)
+        for (TimeDelta delta : deltas)
+            benchmark::DoNotOptimize(delta.total_nanoseconds());
+    state.SetItemsProcessed(state.iterations() * deltas.size());
+}
+BENCHMARK(BM_TimeDelta_total_nanoseconds)->Arg(bench::SMALL)->Arg(bench::LARGE);
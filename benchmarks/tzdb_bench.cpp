@@ -0,0 +1,174 @@
+#include <benchmark/benchmark.h>
+#include <datetime/datetime.h>
+#include <cstdlib>
+#include <ctime>
+#include <random>
+#include <vector>
+
+namespace
+{
+/**
+ * Number of instants converted per iteration.
+ */
+constexpr size_t COUNT = 100'000;
+
+/**
+ * Random instants from 1970 to 2100, in seconds since the unix epoch.
+ */
+const std::vector<int64_t>& instants()
+{
+    static const std::vector<int64_t> values = [] {
+        std::mt19937_64 random(42);
+        std::uniform_int_distribution<int64_t> distribution(0, 4'133'980'799);
+        std::vector<int64_t> result(COUNT);
+        for (int64_t& value : result)
+            value = distribution(random);
+        return result;
+    }();
+    return values;
+}
+}
+
+static void BM_localtime_r(benchmark::State& state)
+{
+    // The conversion an application would make without 'TimeZoneDB'.
+    setenv("TZ", "America/New_York", 1);
+    tzset();
+    for (auto _ : state)
+    {
+        for (int64_t instant : instants())
+        {
+            std::time_t time = static_cast<std::time_t>(instant);
+            std::tm local;
+            benchmark::DoNotOptimize(localtime_r(&time, &local));
+        }
+    }
+    unsetenv("TZ");
+    tzset();
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK(BM_localtime_r);
+
+static void BM_ZoneInfo_offset_at(benchmark::State& state, const char* name)
+{
+    const ZoneInfo& zone = TimeZoneDB::system().get(name);
+    for (auto _ : state)
+        for (int64_t instant : instants())
+            benchmark::DoNotOptimize(zone.offset_at(instant));
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+// Zones with a long and a short history, which take the same time.
+BENCHMARK_CAPTURE(BM_ZoneInfo_offset_at, new_york, "America/New_York");
+BENCHMARK_CAPTURE(BM_ZoneInfo_offset_at, kolkata, "Asia/Kolkata");
+BENCHMARK_CAPTURE(BM_ZoneInfo_offset_at, utc, "UTC");
+
+static void BM_ZoneInfo_local_to_utc(benchmark::State& state)
+{
+    const ZoneInfo& zone = TimeZoneDB::system().get("America/New_York");
+    for (auto _ : state)
+        for (int64_t instant : instants())
+            benchmark::DoNotOptimize(zone.local_to_utc(instant));
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK(BM_ZoneInfo_local_to_utc);
+
+static void BM_ZoneInfo_to_local(benchmark::State& state)
+{
+    const ZoneInfo& zone = TimeZoneDB::system().get("America/New_York");
+    std::vector<Datetime> datetimes;
+    for (int64_t instant : instants())
+        datetimes.push_back(Timestamp(instant * Timestamp::NANOSECONDS_PER_SECOND)
+                                .datetime(TZ::UTC));
+
+    for (auto _ : state)
+        for (const Datetime& datetime : datetimes)
+            benchmark::DoNotOptimize(zone.to_local(datetime));
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK(BM_ZoneInfo_to_local);
+
+static void BM_TimeZoneDB_load(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        TimeZoneDB db = TimeZoneDB(TimeZoneDB::system().get_directory());
+        benchmark::DoNotOptimize(db.get("America/New_York"));
+    }
+}
+BENCHMARK(BM_TimeZoneDB_load);
+
+namespace
+{
+/**
+ * Local times in New York every second for 'COUNT' seconds, sorted like a column of a time
+ * series. Starts on the day the clocks go forward, so the skipped hour's times all miss.
+ */
+const std::vector<Timestamp>& sorted_local_times()
+{
+    static const std::vector<Timestamp> values = [] {
+        int64_t first = Timestamp(Datetime(2023, 3, 12, 0, 0, 0, 0, 0, 0, TZ::UTC))
+            .epoch_nanoseconds;
+        std::vector<Timestamp> result;
+        for (size_t i = 0; i < COUNT; i++)
+            result.push_back(Timestamp(first + i * Timestamp::NANOSECONDS_PER_SECOND));
+        return result;
+    }();
+    return values;
+}
+}
+
+static void BM_ZoneInfo_convert_sorted(benchmark::State& state)
+{
+    // Looks both zones' rules up for every element.
+    const ZoneInfo& from = TimeZoneDB::system().get("America/New_York");
+    const ZoneInfo& to = TimeZoneDB::system().get("Europe/London");
+    std::vector<Timestamp> out(COUNT);
+    for (auto _ : state)
+    {
+        const std::vector<Timestamp>& local = sorted_local_times();
+        for (size_t i = 0; i < COUNT; i++)
+        {
+            int64_t seconds = local[i].epoch_nanoseconds / Timestamp::NANOSECONDS_PER_SECOND;
+            int64_t utc = from.local_to_utc(seconds);
+            out[i] = Timestamp(local[i].epoch_nanoseconds
+                               + (utc - seconds - to.offset_at(utc).utc_offset_seconds)
+                                 * Timestamp::NANOSECONDS_PER_SECOND);
+        }
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+}
+BENCHMARK(BM_ZoneInfo_convert_sorted);
+
+static void BM_ZoneConverter_convert_sorted(benchmark::State& state)
+{
+    ZoneConverter converter = ZoneConverter(TimeZoneDB::system().get("America/New_York"),
+                                            TimeZoneDB::system().get("Europe/London"));
+    std::vector<Timestamp> out(COUNT);
+    for (auto _ : state)
+    {
+        converter.convert(sorted_local_times(), out);
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+    state.counters["hit_rate"] = converter.get_stats().hit_rate();
+}
+BENCHMARK(BM_ZoneConverter_convert_sorted);
+
+static void BM_ZoneConverter_convert_random(benchmark::State& state)
+{
+    ZoneConverter converter = ZoneConverter(TimeZoneDB::system().get("America/New_York"),
+                                            TimeZoneDB::system().get("Europe/London"));
+    std::vector<Timestamp> local;
+    for (int64_t instant : instants())
+        local.push_back(Timestamp(instant * Timestamp::NANOSECONDS_PER_SECOND));
+    std::vector<Timestamp> out(COUNT);
+    for (auto _ : state)
+    {
+        converter.convert(local, out);
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * COUNT);
+    state.counters["hit_rate"] = converter.get_stats().hit_rate();
+}
+BENCHMARK(BM_ZoneConverter_convert_random);
@@ -0,0 +1,108 @@
+#ifndef DATETIME_CLOCK_H
+#define DATETIME_CLOCK_H
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+
+/**
+ * Source of the current time read by 'Time::now', 'Date::today', 'Datetime::now', and
+ * 'Timestamp::now'.
+ *
+ * Every read is one call through a function pointer to a 'Source', which gives nanoseconds since
+ * the unix epoch in UTC. Timezones are applied afterwards with arithmetic, so reading the time
+ * takes no locks and never reads the system's timezone state.
+ *
+ * The source defaults to 'Clock::system'. 'Clock::tsc' is faster on x86 processors with an
+ * invariant TSC. Any other function can be plugged in, for example to replay recorded times.
+ *
+ * @code
+ * Clock::set_source(Clock::tsc);
+ * Datetime datetime = Datetime::now();
+ * @endcode
+ */
+class Clock
+{
+public:
+    /**
+     * Function that gets nanoseconds since the unix epoch in UTC.
+     */
+    using Source = int64_t (*)();
+
+    /**
+     * Gets the current time from the current source.
+     *
+     * @return nanoseconds since the unix epoch in UTC.
+     */
+    static int64_t now()
+    {
+        return source.load(std::memory_order_relaxed)();
+    }
+
+    /**
+     * Sets the source 'now' reads from. Safe to call while other threads read the time.
+     *
+     * Calibrates the TSC first if 'new_source' is 'Clock::tsc', so no read pays for it.
+     *
+     * @param new_source function to get the current time from.
+     */
+    static void set_source(Source new_source);
+
+    /**
+     * Gets the source 'now' reads from.
+     *
+     * @return the current source.
+     */
+    static Source get_source()
+    {
+        return source.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Reads the system's realtime clock.
+     *
+     * Uses 'clock_gettime', which on Linux is served from the vDSO without a system call.
+     *
+     * @return nanoseconds since the unix epoch in UTC.
+     */
+    static int64_t system()
+    {
+#if defined(__unix__) || defined(__APPLE__)
+        timespec time;
+        clock_gettime(CLOCK_REALTIME, &time);
+        return static_cast<int64_t>(time.tv_sec) * 1'000'000'000 + time.tv_nsec;
+#else
+        auto since_epoch = std::chrono::system_clock::now().time_since_epoch();
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(since_epoch).count();
+#endif
+    }
+
+    /**
+     * Reads the processor's time stamp counter, scaled to nanoseconds since the unix epoch.
+     *
+     * The scale is calibrated against 'system' once, by spinning for about 20 milliseconds the
+     * first time it is needed. Later adjustments of the system clock, such as by NTP, are not
+     * followed. Falls back to 'system' if the processor has no invariant TSC.
+     *
+     * @return nanoseconds since the unix epoch in UTC.
+     */
+    static int64_t tsc();
+
+    /**
+     * Checks if 'tsc' reads the time stamp counter, rather than falling back to 'system'.
+     *
+     * Calibrates the TSC if it has not been already.
+     *
+     * @return 'true' if the processor has an invariant TSC, 'false' otherwise.
+     */
+    static bool tsc_available();
+
+private:
+    /**
+     * Source 'now' reads from.
+     */
+    inline static std::atomic<Source> source = &Clock::system;
+};
+
+#endif //DATETIME_CLOCK_H
@@ -0,0 +1,210 @@
+#ifndef DATETIME_COARSE_CLOCK_H
+#define DATETIME_COARSE_CLOCK_H
+
+#include "datetime/datetime/datetime.h"
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+
+/**
+ * Current time refreshed by a background thread, for callers that read the time very often but
+ * only need it to the length of the refresh interval, such as logging and metrics.
+ *
+ * Every 'interval' the thread reads 'Clock::now()' once and publishes it three ways: as
+ * nanoseconds since the unix epoch, as a 'Datetime' in the clock's timezone, and as that
+ * 'Datetime's' 'to_string' representation. The nanoseconds are a single atomic load. The
+ * 'Datetime' and the string are published together under a sequence lock, so readers never
+ * block, never write shared memory, and never see a half-written value. Readers only retry if
+ * they overlap a refresh.
+ *
+ * The thread runs from construction until destruction. The first value is published before
+ * the constructor returns.
+ *
+ * @code
+ * CoarseClock clock = CoarseClock(Milliseconds(1), TZ::UTC);
+ *
+ * char buffer[Datetime::MAX_CHARS];
+ * std::to_chars_result result = clock.to_chars(buffer, buffer + Datetime::MAX_CHARS);
+ * log(std::string_view(buffer, result.ptr), message);
+ * @endcode
+ */
+class CoarseClock
+{
+public:
+    /**
+     * Starts a thread that refreshes the time every 'interval'.
+     *
+     * @param interval time between refreshes.
+     * @param timezone 'Timezone' of the published 'Datetime' and string.
+     * (default get_default_timezone())
+     *
+     * @throws std::invalid_argument if 'interval' is not positive.
+     */
+    explicit CoarseClock(Milliseconds interval,
+                         Timezone timezone = Time::get_default_timezone());
+
+    /**
+     * Starts a thread that refreshes the time every 'interval'.
+     *
+     * @param interval time between refreshes.
+     * @param timezone 'Timezone' of the published 'Datetime' and string.
+     * (default get_default_timezone())
+     *
+     * @throws std::invalid_argument if 'interval' is not positive.
+     */
+    explicit CoarseClock(Microseconds interval,
+                         Timezone timezone = Time::get_default_timezone());
+
+    /**
+     * Stops and joins the refresh thread.
+     */
+    ~CoarseClock();
+
+    CoarseClock(const CoarseClock&) = delete;
+    CoarseClock& operator=(const CoarseClock&) = delete;
+
+    /**
+     * Gets the time of the last refresh.
+     *
+     * @return nanoseconds since the unix epoch in UTC.
+     */
+    int64_t now_nanoseconds() const
+    {
+        return nanoseconds.load(std::memory_order_acquire);
+    }
+
+    /**
+     * Gets the time of the last refresh as a 'Datetime' in the clock's timezone.
+     *
+     * @return the last published 'Datetime'.
+     */
+    Datetime now() const;
+
+    /**
+     * Gets the 'to_string' representation of the time of the last refresh.
+     *
+     * Allocates. Use 'to_chars' to copy the string without allocating.
+     *
+     * @return the last published string.
+     */
+    std::string to_string() const;
+
+    /**
+     * Copies the 'to_string' representation of the time of the last refresh into
+     * '[first, last)', without allocating.
+     *
+     * @param first start of the buffer to write into.
+     * @param last one past the end of the buffer to write into.
+     *
+     * @return one past the last character written, or 'last' with
+     * 'std::errc::value_too_large' if the buffer is too small.
+     */
+    std::to_chars_result to_chars(char* first, char* last) const;
+
+    /**
+     * Gets the 'Timezone' the time is published in.
+     *
+     * @return the clock's timezone.
+     */
+    Timezone get_timezone() const;
+
+private:
+    /**
+     * Everything published under the sequence lock.
+     */
+    struct Snapshot
+    {
+        /**
+         * Time of the refresh.
+         */
+        Datetime datetime;
+
+        /**
+         * 'to_string' representation of 'datetime'.
+         */
+        std::array<char, Datetime::MAX_CHARS> string;
+
+        /**
+         * Length of 'string'.
+         */
+        uint8_t length;
+    };
+
+    static_assert(std::is_trivially_copyable_v<Snapshot>);
+
+    /**
+     * Number of words 'Snapshot' is stored in.
+     */
+    static constexpr size_t SNAPSHOT_WORDS = (sizeof(Snapshot) + sizeof(uint64_t) - 1)
+                                             / sizeof(uint64_t);
+
+    /**
+     * Starts a thread that refreshes the time every 'interval_nanoseconds'.
+     */
+    CoarseClock(int64_t interval_nanoseconds, Timezone timezone);
+
+    /**
+     * Reads the clock and publishes the time.
+     */
+    void refresh();
+
+    /**
+     * Copies a consistent 'Snapshot' out from under the sequence lock.
+     *
+     * @return the last published 'Snapshot'.
+     */
+    Snapshot load() const;
+
+    /**
+     * Refreshes the time every 'interval_nanoseconds' until 'stop' is set.
+     */
+    void run();
+
+    /**
+     * Time between refreshes in nanoseconds.
+     */
+    int64_t interval_nanoseconds;
+
+    /**
+     * 'Timezone' of the published 'Datetime' and string.
+     */
+    Timezone timezone;
+
+    /**
+     * Time of the last refresh in nanoseconds since the unix epoch.
+     */
+    alignas(64) std::atomic<int64_t> nanoseconds = 0;
+
+    /**
+     * Sequence lock over 'words'. Odd while a refresh is writing them.
+     */
+    std::atomic<uint64_t> sequence = 0;
+
+    /**
+     * Last published 'Snapshot'. Atomic words, so readers racing a refresh are not data races.
+     */
+    std::array<std::atomic<uint64_t>, SNAPSHOT_WORDS> words{};
+
+    /**
+     * Guards 'stop', and wakes the refresh thread early to stop it.
+     */
+    alignas(64) std::mutex mutex;
+    std::condition_variable stopped;
+
+    /**
+     * Set to stop the refresh thread.
+     */
+    bool stop = false;
+
+    /**
+     * Refresh thread.
+     */
+    std::thread thread;
+};
+
+#endif //DATETIME_COARSE_CLOCK_H
@@ -15,7 +15,7 @@ struct Days : Component
      *
      * @param day Number of days to represent.
      */
-    explicit Days(int64_t day) :
+    explicit constexpr Days(int64_t day) :
         Component(day) {}
 };
 
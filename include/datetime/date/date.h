@@ -6,12 +6,17 @@
 #include "datetime/time/time.h"
 #include <fmt/format.h>
 #include <../../../src/util/macros.h>
+#include <../../../src/util/parse.h>
 #include <stringhelpers/stringhelpers.h>
 #include "date_component.h"
+#include "datetime/parse/parse_error.h"
+#include "datetime/iota_view.h"
+#include "datetime/unchecked.h"
+#include <charconv>
+#include <concepts>
+#include <expected>
 #include <optional>
 
-class TimeDelta;
-
 /**
  * Date with components: 'year', 'month', and 'day'.
  */
@@ -45,7 +50,23 @@ public:
      * @param month Month the 'Date' will be set to (default EPOCH.month).
      * @param day Days the 'Date' will be set to (default EPOCH.day).
      */
-    explicit Date(uint16_t year = EPOCH.year, uint8_t month = EPOCH.month, uint8_t day = EPOCH.day);
+    explicit constexpr Date(uint16_t year = EPOCH.year, uint8_t month = EPOCH.month,
+                            uint8_t day = EPOCH.day);
+
+    /**
+     * Creates a 'Date' whose components match the values of 'year', 'month', and 'day',
+     * without checking that they are a valid date.
+     *
+     * @param year Year the 'Date' will be set to.
+     * @param month Month the 'Date' will be set to.
+     * @param day Days the 'Date' will be set to.
+     *
+     * @see Unchecked
+     */
+    constexpr Date(Unchecked, uint16_t year, uint8_t month, uint8_t day) :
+        year(year),
+        month(month),
+        day(day) {}
 
     /**
      * Creates a 'Date' from a std::string.
@@ -61,6 +82,7 @@ public:
      * @see Component
      */
     template<typename... DateComponents>
+        requires (std::same_as<DateComponents, DateComponent> && ...)
     explicit Date(std::string_view string, DateComponents... date_components);
 
     /**
@@ -74,14 +96,44 @@ public:
     explicit Date(std::string_view string) :
         Date(string, DateComponent::YEAR, DateComponent::MONTH, DateComponent::DAY) {}
 
+    /**
+     * Parses a 'Date' from a string without throwing.
+     *
+     * @tparam DateComponents Should be of type 'Component'.
+     *
+     * @param string String representation of the date.
+     * @param date_components 'Components' that correspond to each number in 'string'.
+     *
+     * @return the parsed 'Date', or a 'ParseError' describing why 'string' could not be parsed.
+     */
+    template<typename... DateComponents>
+        requires (std::same_as<DateComponents, DateComponent> && ...)
+    static std::expected<Date, ParseError> try_parse(std::string_view string,
+                                                     DateComponents... date_components);
+
+    /**
+     * Parses a 'Date' in the format %Y-%m-%d from a string without throwing.
+     *
+     * @param string string representation of the date.
+     *
+     * @return the parsed 'Date', or a 'ParseError' describing why 'string' could not be parsed.
+     */
+    static std::expected<Date, ParseError> try_parse(std::string_view string)
+    {
+        return try_parse(string, DateComponent::YEAR, DateComponent::MONTH, DateComponent::DAY);
+    }
+
     /**
      * Creates a 'Date' that matches today's date.
      *
+     * The time is read from 'Clock::now()'.
+     *
+     * @param day_offset days to add to today's date. (default 0)
      * @param timezone timezone to get the current date of.
      *
      * @return a 'Date' that matches today's date.
      */
-    static Date today(int day_offset = 0, Timezone timezone =  Time::default_timezone);
+    static Date today(int day_offset = 0, Timezone timezone = Time::get_default_timezone());
 
     /**
      * Creates a 'Date' that matches tomorrow's date.
@@ -90,7 +142,7 @@ public:
      *
      * @return a 'Date' that matches tomorrow's date.
      */
-    static Date tomorrow(Timezone timezone =  Time::default_timezone);
+    static Date tomorrow(Timezone timezone = Time::get_default_timezone());
 
     /**
      * Gets the dates within a range.
@@ -103,12 +155,29 @@ public:
      */
     static std::vector<Date> range(Date start, Date end, Days increment = Days(1));
 
+    /**
+     * Gets a lazy view of the dates within a range.
+     *
+     * Unlike 'range', no dates are stored: each one is computed when it is read.
+     *
+     * @param start starting date of the range.
+     * @param end ending date of the range. Included if it is a whole number of 'step' after
+     * 'start'.
+     * @param step days between each date in the range. Must be positive. (default Days(1))
+     *
+     * @return random access view of the dates within 'start' to 'end'. Empty if 'end' is before
+     * 'start'.
+     *
+     * @throws std::invalid_argument if 'step' is not positive.
+     */
+    static constexpr IotaView<Date, Days> iota(Date start, Date end, Days step = Days(1));
+
     /**
      * Gets the 'DayOfWeek' of this 'Date'.
      *
      * @return 'DayOfWeek' of 'Date'.
      */
-    DayOfWeek day_of_week() const;
+    constexpr DayOfWeek day_of_week() const;
 
     /**
      * Returns whether this 'Date' is a weekday.
@@ -118,7 +187,7 @@ public:
      *
      * @return 'true' if this 'Date' is a weekday, 'false' otherwise.
      */
-    bool is_weekday() const;
+    constexpr bool is_weekday() const;
 
     /**
      * Returns whether this 'Date' is a weekend.
@@ -127,7 +196,7 @@ public:
      *
      * @return True if this 'Date' is a weekend, 'false' otherwise.
      */
-    bool is_weekend() const;
+    constexpr bool is_weekend() const;
 
     /**
      * Represents this 'Date' as a std::string.
@@ -145,14 +214,32 @@ public:
      *
      * // output: 2000-01-30
      */
-    virtual std::string to_string(char delim = '-') const;
+    std::string to_string(char delim = '-') const;
+
+    /**
+     * Writes the 'to_string' representation of this 'Date' into '[first, last)', without
+     * allocating.
+     *
+     * @param first start of the buffer to write into.
+     * @param last one past the end of the buffer to write into.
+     * @param delim delimiter between year/month and month/date.
+     *
+     * @return one past the last character written, or 'last' with
+     * 'std::errc::value_too_large' if the buffer is too small.
+     */
+    std::to_chars_result to_chars(char* first, char* last, char delim = '-') const;
+
+    /**
+     * Most characters 'to_chars' can write.
+     */
+    static constexpr size_t MAX_CHARS = 13;
 
     /**
      * Returns whether 'year' is a leap year.
      *
      * @return 'true' if 'year' is a leap year.
      */
-    static bool is_leap_year(uint16_t year);
+    static constexpr bool is_leap_year(uint16_t year);
 
     /**
      * Gets the maximum number of days in the month that corresponds to 'month_idx'.
@@ -166,7 +253,36 @@ public:
      *
      * // output: 31
      */
-    static size_t max_days_in_month(uint8_t month_idx, std::optional<uint16_t> year = {});
+    static constexpr size_t max_days_in_month(uint8_t month_idx, std::optional<uint16_t> year = {});
+
+    /**
+     * Gets the serial day number of this 'Date'.
+     *
+     * The serial day number is the number of days since 'EPOCH' (1970-01-01). Runs in constant
+     * time regardless of 'year'.
+     *
+     * @return days since 'EPOCH'.
+     *
+     * @example
+     * Date date = Date(1970, 1, 11);
+     * std::cout << date.to_day_number();
+     *
+     * // output: 10
+     */
+    constexpr int64_t to_day_number() const;
+
+    /**
+     * Creates a 'Date' from a serial day number.
+     *
+     * Runs in constant time regardless of 'day_number'.
+     *
+     * @param day_number days since 'EPOCH' (1970-01-01).
+     *
+     * @return the 'Date' 'day_number' days after 'EPOCH'.
+     *
+     * @throws std::invalid_argument if the resulting 'Date' is invalid.
+     */
+    static constexpr Date from_day_number(int64_t day_number);
 
     /**
      * Adds 'days' to this 'Date'.
@@ -175,7 +291,7 @@ public:
      *
      * @return A reference to this modified 'Date'.
      */
-    virtual Date& operator+=(const Days& days);
+    constexpr Date& operator+=(const Days& days);
 
     /**
      * Subtracts 'days' from this 'Date'.
@@ -184,7 +300,7 @@ public:
      *
      * @return A reference to this modified 'Date'.
      */
-    virtual Date& operator-=(const Days& days);
+    constexpr Date& operator-=(const Days& days);
 
     /**
      * Adds 'days' to 'this'.
@@ -193,7 +309,7 @@ public:
      *
      * @return a new 'Date' with 'days' added.
      */
-    Date operator+(const Days& days) const;
+    constexpr Date operator+(const Days& days) const;
 
     /**
      * Subtracts 'days' to 'this'.
@@ -202,21 +318,21 @@ public:
      *
      * @return a new 'Date' with 'days' subtracted.
      */
-    Date operator-(const Days& days) const;
+    constexpr Date operator-(const Days& days) const;
 
     /**
      * Adds a day to this 'Date'.
      *
      * @return A reference to this modified 'Date'.
      */
-    virtual Date& operator++();
+    constexpr Date& operator++();
 
     /**
      * Subtracts a day from this 'Date'.
      *
      * @return A reference to this modified 'Date'.
      */
-    virtual Date& operator--();
+    constexpr Date& operator--();
 
     /**
      * Subtracts 'other' from 'date'.
@@ -226,7 +342,7 @@ public:
      *
      * @return 'TimeDelta' of the difference in days between 'date' and 'other'.
      */
-    friend TimeDelta operator-(Date date, Date other);
+    friend constexpr TimeDelta operator-(Date date, Date other);
 
     /**
      * Checks if 'this' is greater than 'other'.
@@ -235,7 +351,7 @@ public:
      *
      * @return 'true' if 'this' is greater than 'other', 'false' otherwise.
      */
-    bool operator>(const Date& other) const;
+    constexpr bool operator>(const Date& other) const;
 
     /**
      * Checks if 'this' is greater than or equal to 'other'.
@@ -244,7 +360,7 @@ public:
      *
      * @return 'true' if 'this' is greater than or equal to 'other', 'false' otherwise.
      */
-    bool operator>=(const Date& other) const;
+    constexpr bool operator>=(const Date& other) const;
 
     /**
      * Checks if 'this' is less than 'other'.
@@ -253,7 +369,7 @@ public:
      *
      * @return 'true' if 'this' is less than 'other', 'false' otherwise.
      */
-    bool operator<(const Date& other) const;
+    constexpr bool operator<(const Date& other) const;
 
     /**
      * Checks if 'this' is less than or equal to 'other'.
@@ -262,7 +378,7 @@ public:
      *
      * @return 'true' if 'this' is less than or equal to than 'other', 'false' otherwise.
      */
-    bool operator<=(const Date& other) const;
+    constexpr bool operator<=(const Date& other) const;
 
     /**
      * Checks if 'other' is equal to this 'Date'.
@@ -271,7 +387,7 @@ public:
      *
      * @return 'true' if 'other' is equal to this 'Date', 'false' otherwise.
      */
-    bool operator==(const Date& other) const;
+    constexpr bool operator==(const Date& other) const;
 
     /**
      * Checks if 'other' is not equal to this 'Date'.
@@ -280,7 +396,7 @@ public:
      *
      * @return 'true' if 'other' is not equal to this 'Date', 'false' otherwise.
      */
-    bool operator!=(const Date& other) const;
+    constexpr bool operator!=(const Date& other) const;
 
     /**
      * Outputs 'date' into 'os'.
@@ -302,33 +418,19 @@ protected:
     /**
      * Adds days to this 'Date'.
      *
-     * @param days_to_add number of days to add to this 'Date'.
+     * @param days_to_add number of days to add to this 'Date'. Subtracts if negative.
      */
-    void add_days(size_t days_to_add);
-
-    /**
-     * Subtracts days from this 'Date'.
-     *
-     * @param days_to_subtract number of days to subtract from this 'Date'.
-     */
-    void subtract_days(size_t days_to_subtract);
+    constexpr void add_days(int64_t days_to_add);
 
     /**
      * Number of days in a non-leap year.
      */
-    static const uint16_t DAYS_PER_NON_LEAP_YEAR;
+    static constexpr uint16_t DAYS_PER_NON_LEAP_YEAR = 365;
 
     /**
      * Number of days in a leap year.
      */
-    static const uint16_t DAYS_PER_LEAP_YEAR;
-
-private:
-
-    /**
-     * Number of months in a year.
-     */
-    static const int MONTHS_PER_YEAR;
+    static constexpr uint16_t DAYS_PER_LEAP_YEAR = 366;
 
     /**
      * Checks if this 'Date' is valid.
@@ -337,7 +439,14 @@ private:
      *
      * @return 'true' if this 'Date' is valid, 'false' otherwise.
      */
-    bool is_valid_date() const;
+    constexpr bool is_valid_date() const;
+
+private:
+
+    /**
+     * Number of months in a year.
+     */
+    static constexpr int MONTHS_PER_YEAR = 12;
 
     /**
      * Checks if 'year' is valid.
@@ -346,7 +455,7 @@ private:
      *
      * @return 'true' if 'year' is valid, 'false' otherwise.
      */
-    bool is_valid_year() const;
+    constexpr bool is_valid_year() const;
 
     /**
      * Checks if 'month' is valid.
@@ -355,7 +464,7 @@ private:
      *
      * @return 'true' is 'month' is valid, 'false' otherwise.
      */
-    bool is_valid_month() const;
+    constexpr bool is_valid_month() const;
 
     /**
      * Checks if 'day' is valid.
@@ -365,56 +474,299 @@ private:
      *
      * @return 'true' if 'day' is valid, 'false' otherwise.
      */
-    bool is_valid_day() const;
+    constexpr bool is_valid_day() const;
 
     /**
-     * Gets the total elapsed days of 'this' since 'EPOCH'.
+     * Sets 'year', 'month', and 'day' to the date 'day_number' days after 'EPOCH'.
+     *
+     * Does not check if the resulting date is valid.
      *
-     * @return total elapsed days of 'this' since 'EPOCH'.
+     * @param day_number days since 'EPOCH'.
      */
-    size_t get_total_days() const;
+    constexpr void set_day_number(int64_t day_number);
 };
 
-template<typename... DateComponents>
-Date::Date(std::string_view string, DateComponents... date_components)
+static_assert(sizeof(Date) == 4);
+static_assert(std::is_trivially_copyable_v<Date>);
+
+constexpr Date::Date(uint16_t year, uint8_t month, uint8_t day) :
+    year(year),
+    month(month),
+    day(day)
+{
+    ASSERT(is_valid_date(),
+           std::invalid_argument(fmt::format("'{}' is an invalid date", Date::to_string())));
+}
+
+constexpr bool Date::is_leap_year(uint16_t year)
 {
-    std::vector<std::string> date_components_strs = strh::split_alphabetical(string);
+    if (year % 4 != 0)
+        return false;
+    else if (year % 100 != 0)
+        return true;
+    else if (year % 400 != 0)
+        return false;
+    return true;
+}
 
-    ASSERT(date_components_strs.size() >= sizeof...(date_components),
-           std::invalid_argument(fmt::format("components with size '{}' does not match date "
-                                             "strings: '{}' with size '{}'",
-                                             sizeof...(date_components),
-                                             fmt::join(date_components_strs, ", "),
-                                             date_components_strs.size())));
+constexpr size_t Date::max_days_in_month(uint8_t month_idx, std::optional<uint16_t> year)
+{
+    ASSERT(month_idx >= 1 && month_idx <= 12,
+           std::runtime_error(fmt::format("'{}' is not a valid month", month_idx)));
+
+    switch (month_idx) {
+    case 2:
+        return year.has_value() && is_leap_year(year.value()) ? 29 : 28;
+    case 4:
+    case 6:
+    case 9:
+    case 11:
+        return 30;
+    default:
+        return 31;
+    }
+}
 
-    size_t idx = 0;
+constexpr int64_t Date::to_day_number() const
+{
+    // Shift the start of the year to March so the leap day is the last day of the year.
+    int64_t _year = year - (month <= 2);
+
+    // 400 year cycle (era) the year is in, and the year of that era [0, 399].
+    int64_t era = (_year >= 0 ? _year : _year - 399) / 400;
+    int64_t year_of_era = _year - era * 400;
+
+    // Day of the March based year [0, 365], and day of the era [0, 146096].
+    int64_t day_of_year = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    int64_t day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+
+    // 719468 is the number of days from 0000-03-01 to 1970-01-01.
+    return era * 146097 + day_of_era - 719468;
+}
+
+constexpr Date Date::from_day_number(int64_t day_number)
+{
+    // Not default constructed, as the defaults read 'EPOCH', which is defined after this.
+    Date date = Date(1970, 1, 1);
+    date.set_day_number(day_number);
+
+    ASSERT(date.is_valid_date(),
+           std::invalid_argument(fmt::format("'{}' is an invalid day number", day_number)));
+
+    return date;
+}
+
+constexpr Date::DayOfWeek Date::day_of_week() const
+{
+    // 'EPOCH' (1970-01-01) was a Thursday.
+    int64_t day_of_week = (to_day_number() + THURSDAY) % 7;
+    if (day_of_week < 0)
+        day_of_week += 7;
+
+    return static_cast<DayOfWeek>(day_of_week);
+}
+
+constexpr bool Date::is_weekday() const
+{
+    return !is_weekend();
+}
+
+constexpr bool Date::is_weekend() const
+{
+    switch (day_of_week()) {
+    case SATURDAY:
+    case SUNDAY:
+        return true;
+    default:
+        return false;
+    }
+}
+
+constexpr Date& Date::operator+=(const Days& days)
+{
+    add_days(days.value);
+    return *this;
+}
+
+constexpr Date& Date::operator-=(const Days& days)
+{
+    add_days(-days.value);
+    return *this;
+}
+
+constexpr Date Date::operator+(const Days& days) const
+{
+    Date date = (*this);
+    date += days;
+    return date;
+}
+
+constexpr Date Date::operator-(const Days& days) const
+{
+    Date date = (*this);
+    date -= days;
+    return date;
+}
+
+constexpr Date& Date::operator++()
+{
+    add_days(1);
+    return *this;
+}
+
+constexpr Date& Date::operator--()
+{
+    add_days(-1);
+    return *this;
+}
+
+constexpr TimeDelta operator-(Date date, Date other)
+{
+    return TimeDelta(date.to_day_number() - other.to_day_number());
+}
+
+constexpr bool Date::operator>(const Date& other) const
+{
+    return year > other.year
+        || year == other.year && month > other.month
+        || year == other.year && month == other.month && day > other.day;
+}
+
+constexpr bool Date::operator>=(const Date& other) const
+{
+    return year > other.year
+        || year == other.year && month > other.month
+        || year == other.year && month == other.month && day >= other.day;
+}
+
+constexpr bool Date::operator<(const Date& other) const
+{
+    return year < other.year
+        || year == other.year && month < other.month
+        || year == other.year && month == other.month && day < other.day;
+}
+
+constexpr bool Date::operator<=(const Date& other) const
+{
+    return year < other.year
+        || year == other.year && month < other.month
+        || year == other.year && month == other.month && day <= other.day;
+}
+
+constexpr bool Date::operator==(const Date& other) const
+{
+    return year == other.year
+        && month == other.month
+        && day == other.day;
+}
+
+constexpr bool Date::operator!=(const Date& other) const
+{
+    return year != other.year
+        || month != other.month
+        || day != other.day;
+}
+
+constexpr IotaView<Date, Days> Date::iota(Date start, Date end, Days step)
+{
+    return IotaView<Date, Days>(start, end.to_day_number() - start.to_day_number(), step);
+}
+
+constexpr void Date::add_days(int64_t days_to_add)
+{
+    set_day_number(to_day_number() + days_to_add);
+}
+
+constexpr bool Date::is_valid_date() const
+{
+    return is_valid_year() && is_valid_month() && is_valid_day();
+}
+
+constexpr bool Date::is_valid_year() const
+{
+    // Even though year would technically be valid, we don't expect to have a date passed
+    // these values. 1970 is 'EPOCH's' year, which can not be read here because 'EPOCH' is
+    // itself validated by this check.
+    return year <= 2100 && year >= 1970;
+}
+
+constexpr bool Date::is_valid_month() const
+{
+    return month <= 12 && month >= 1;
+}
+
+constexpr bool Date::is_valid_day() const
+{
+    return day <= max_days_in_month(month, year) && day >= 1;
+}
+
+constexpr void Date::set_day_number(int64_t day_number)
+{
+    // Shift to days since 0000-03-01.
+    int64_t days = day_number + 719468;
+
+    int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+    int64_t day_of_era = days - era * 146097;
+    int64_t year_of_era =
+        (day_of_era - day_of_era / 1460 + day_of_era / 36524 - day_of_era / 146096) / 365;
+    int64_t day_of_year = day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+
+    // Month of the March based year [0, 11].
+    int64_t march_month = (5 * day_of_year + 2) / 153;
+
+    day = day_of_year - (153 * march_month + 2) / 5 + 1;
+    month = march_month < 10 ? march_month + 3 : march_month - 9;
+    year = year_of_era + era * 400 + (month <= 2);
+}
+
+inline constexpr Date Date::EPOCH = Date(1970, 1, 1);
+
+template<typename... DateComponents>
+    requires (std::same_as<DateComponents, DateComponent> && ...)
+Date::Date(std::string_view string, DateComponents... date_components) :
+    Date(parse::value_or_throw(try_parse(string, date_components...), string)) {}
+
+template<typename... DateComponents>
+    requires (std::same_as<DateComponents, DateComponent> && ...)
+std::expected<Date, ParseError> Date::try_parse(std::string_view string,
+                                                DateComponents... date_components)
+{
+    Date date = Date(UNCHECKED, EPOCH.year, EPOCH.month, EPOCH.day);
+    ParseError error{};
+    size_t pos = 0;
+
+    // Lambda to set each date component value from the next number in 'string'. Returns
+    // 'false' once a number can not be read, which stops the remaining components being read.
+    auto set_date_component_from_str = [&](const auto& date_component) {
+        std::expected<int64_t, ParseError> value = parse::next_component(string, pos);
+        if (!value.has_value())
+        {
+            error = value.error();
+            return false;
+        }
 
-    // Lambda to get each date component value from each corresponding date component string
-    auto set_date_components_from_str = [&](const auto& date_component, size_t idx) {
         switch (date_component) {
         case DateComponent::YEAR:
-            year = std::stoi(date_components_strs[idx]);
+            date.year = *value;
             break;
         case DateComponent::MONTH:
-            if (date_components_strs[idx][0] == '0')
-                month = date_components_strs[idx][1] - '0'; // char to int
-            else
-                month = std::stoi(date_components_strs[idx]);
+            date.month = *value;
             break;
         case DateComponent::DAY:
-            if (date_components_strs[idx][0] == '0')
-                day = date_components_strs[idx][1] - '0'; // char to int
-            else
-                day = std::stoi(date_components_strs[idx]);
+            date.day = *value;
             break;
         }
+        return true;
     };
 
     // Call the lambda function on each date component
-    (set_date_components_from_str(date_components, idx++), ...);
+    if (!(set_date_component_from_str(date_components) && ...))
+        return std::unexpected(error);
 
-    ASSERT(is_valid_date(),
-           std::invalid_argument(fmt::format("'{}' is an invalid date", Date::to_string())));
+    if (!date.is_valid_date())
+        return std::unexpected(ParseError{ParseError::Code::INVALID_DATE, 0});
+
+    return date;
 }
 
 inline size_t hash_value(const Date& date)
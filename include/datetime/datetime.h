@@ -5,5 +5,14 @@
 #include "date/date_range.h"
 #include "time/time_range.h"
 #include "datetime/datetime_range.h"
+#include "timestamp/timestamp.h"
+#include "timestamp/datetime_array.h"
+#include "timer/timer_wheel.h"
+#include "clock/coarse_clock.h"
+#include "time/scoped_default_timezone.h"
+#include "tzdb/time_zone_db.h"
+#include "tzdb/zone_converter.h"
+#include "parse/fixed_format.h"
+#include "format/formatter.h"
 
 #endif //DATETIME_H
@@ -17,7 +17,7 @@ public:
      *
      * @param date 'Date' to set the date values of 'Datetime' to.
      */
-    explicit Datetime(const Date& date) :
+    explicit constexpr Datetime(const Date& date) :
         Date(date.year, date.month, date.day),
         Time() {}
 
@@ -27,7 +27,7 @@ public:
      * @param date 'Date' to set the date values of 'Datetime' to.
      * @param time 'Time' to set the time values of 'Datetime' to.
      */
-    explicit Datetime(const Date& date, const Time& time) :
+    explicit constexpr Datetime(const Date& date, const Time& time) :
         Date(date.year, date.month, date.day),
         Time(time.hour, time.minute, time.second, time.millisecond, time.microsecond,
              time.nanosecond, time.timezone) {}
@@ -44,19 +44,39 @@ public:
      * @param millisecond millisecond value that 'Datetime' will be set to. (default 0)
      * @param microsecond microsecond value that 'Datetime' will be set to. (default 0)
      * @param nanosecond nanosecond value that 'Datetime' will be set to. (default 0)
-     * @param timezone timezone that 'Datetime' will be set to. (default Time::default_timezone)
+     * @param timezone timezone that 'Datetime' will be set to.
+     * (default Time::get_default_timezone())
      */
-    explicit Datetime(uint16_t year = EPOCH.year, uint8_t month = EPOCH.month,
-                      uint8_t day = EPOCH.day, uint8_t hour = 0, uint8_t minute = 0,
-                      uint8_t second = 0, uint16_t millisecond = 0, uint16_t microsecond = 0,
-                      uint16_t nanosecond = 0, Timezone timezone = Time::default_timezone)
+    explicit constexpr Datetime(uint16_t year = EPOCH.year, uint8_t month = EPOCH.month,
+                                uint8_t day = EPOCH.day, uint8_t hour = 0, uint8_t minute = 0,
+                                uint8_t second = 0, uint16_t millisecond = 0,
+                                uint16_t microsecond = 0, uint16_t nanosecond = 0,
+                                Timezone timezone = get_default_timezone())
         :
         Date(year, month, day),
         Time(hour, minute, second, millisecond, microsecond, nanosecond, timezone) {}
 
+    /**
+     * Creates a 'Datetime' based on the given arguments, without checking that they are a valid
+     * date and time.
+     *
+     * @see Unchecked
+     */
+    constexpr Datetime(Unchecked, uint16_t year, uint8_t month, uint8_t day, uint8_t hour,
+                       uint8_t minute, uint8_t second, uint16_t millisecond,
+                       uint16_t microsecond, uint16_t nanosecond, Timezone timezone) :
+        Date(UNCHECKED, year, month, day),
+        Time(UNCHECKED, hour, minute, second, millisecond, microsecond, nanosecond, timezone) {}
+
     /**
      * Creates a 'Datetime' whose components' values match the current date and time.
      *
+     * The date and the time both come from one read of 'Clock::now()', so they always agree,
+     * even at midnight. The offsets are added to it.
+     *
+     * Each thread caches the day it last read the time in for each timezone, so the date is only
+     * worked out again once the time crosses midnight.
+     *
      * @param timezone 'Timezone' to set the current date and time to.
      *
      * @return created 'Datetime'.
@@ -64,7 +84,7 @@ public:
     static Datetime now(uint8_t day_offset = 0, uint8_t hour_offset = 0, uint8_t minute_offset =0,
                         uint8_t second_offset = 0, uint16_t millisecond_offset = 0,
                         uint16_t microsecond_offset = 0, uint16_t nanosecond_offset = 0,
-                        Timezone timezone = default_timezone);
+                        Timezone timezone = get_default_timezone());
 
     /**
      * Constructs a datetime object from a millisecond unix timestamp.
@@ -75,9 +95,35 @@ public:
      *
      * @return the datetime object converted from the 'timestamp'.
      */
-    static Datetime from_ms(size_t timestamp,
-                            Timezone to_timezone = default_timezone,
-                            Timezone from_timezone = TZ::UTC);
+    static constexpr Datetime from_ms(size_t timestamp,
+                                      Timezone to_timezone = get_default_timezone(),
+                                      Timezone from_timezone = TZ::UTC);
+
+    /**
+     * Constructs a datetime object from a microsecond unix timestamp.
+     *
+     * @param timestamp microsecond unix timestamp.
+     * @param to_timezone timezone that 'Datetime' will be set to.
+     * @param from_timezone timezone of 'timestamp'.
+     *
+     * @return the datetime object converted from the 'timestamp'.
+     */
+    static constexpr Datetime from_us(size_t timestamp,
+                                      Timezone to_timezone = get_default_timezone(),
+                                      Timezone from_timezone = TZ::UTC);
+
+    /**
+     * Constructs a datetime object from a nanosecond unix timestamp.
+     *
+     * @param timestamp nanosecond unix timestamp.
+     * @param to_timezone timezone that 'Datetime' will be set to.
+     * @param from_timezone timezone of 'timestamp'.
+     *
+     * @return the datetime object converted from the 'timestamp'.
+     */
+    static constexpr Datetime from_ns(size_t timestamp,
+                                      Timezone to_timezone = get_default_timezone(),
+                                      Timezone from_timezone = TZ::UTC);
 
     /**
      * Converts 'this' to ms timestamp.
@@ -86,7 +132,25 @@ public:
      *
      * @return 'this' as a ms timestamp.
      */
-    size_t to_ms(Timezone timezone = TZ::UTC) const;
+    constexpr size_t to_ms(Timezone timezone = TZ::UTC) const;
+
+    /**
+     * Converts 'this' to us timestamp.
+     *
+     * @param timezone the timezone to convert the us timestamp to. (default UTC)
+     *
+     * @return 'this' as a us timestamp.
+     */
+    constexpr size_t to_us(Timezone timezone = TZ::UTC) const;
+
+    /**
+     * Converts 'this' to ns timestamp.
+     *
+     * @param timezone the timezone to convert the ns timestamp to. (default UTC)
+     *
+     * @return 'this' as a ns timestamp.
+     */
+    constexpr size_t to_ns(Timezone timezone = TZ::UTC) const;
 
     /**
      * Creates a 'Datetime' from a std::string.
@@ -105,6 +169,10 @@ public:
      */
     template<typename DateComponent1, typename DateComponent2, typename DateComponent3,
         typename... TimeComponents>
+        requires std::same_as<DateComponent1, DateComponent>
+            && std::same_as<DateComponent2, DateComponent>
+            && std::same_as<DateComponent3, DateComponent>
+            && (std::same_as<TimeComponents, TimeComponent> && ...)
     explicit Datetime(std::string_view string, DateComponent1 date_component1,
                       DateComponent2 date_component2, DateComponent3 date_component3,
                       TimeComponents... time_components) :
@@ -114,6 +182,73 @@ public:
         Time(string.substr(10, string.length()),
              std::forward<TimeComponents>(time_components)...) {}
 
+    /**
+     * Creates a 'Datetime' from an ISO 8601 string, without allocating.
+     *
+     * 'string' is a 'YYYY-MM-DD' date, optionally followed by 'T' or ' ' and a 'HH:MM',
+     * 'HH:MM:SS' or 'HH:MM:SS.fffffffff' time with 1 to 9 fractional digits, optionally followed
+     * by 'Z' or a '+HH:MM' / '-HH:MM' UTC offset. Without an offset, the timezone is
+     * 'Time::get_default_timezone()'.
+     *
+     * @example
+     * Datetime datetime = Datetime("2024-01-02 09:30:00.123456789-05:00");
+     *
+     * @param string ISO 8601 representation of the date and time.
+     *
+     * @throws std::invalid_argument if 'string' is not in the form above, has an offset with 60
+     * or more minutes, or is an invalid datetime.
+     */
+    explicit Datetime(std::string_view string);
+
+    /**
+     * Parses a 'Datetime' from an ISO 8601 string without throwing.
+     *
+     * Accepts the same forms as 'Datetime(std::string_view)'.
+     *
+     * @example
+     * std::expected<Datetime, ParseError> datetime = Datetime::try_parse(line);
+     * if (!datetime)
+     *     std::cerr << datetime.error().message(line) << '\n';
+     *
+     * @param string ISO 8601 representation of the date and time.
+     *
+     * @return the parsed 'Datetime', or a 'ParseError' describing why 'string' could not be
+     * parsed.
+     */
+    static std::expected<Datetime, ParseError> try_parse(std::string_view string);
+
+    /**
+     * Parses a 'Datetime' from a string without throwing.
+     *
+     * The first 10 characters of 'string' are parsed as the date, the rest as the time.
+     *
+     * @tparam DateComponent1 should be of type 'DateComponent'.
+     * @tparam DateComponent2 should be of type 'DateComponent'.
+     * @tparam DateComponent3 should be of type 'DateComponent'.
+     * @tparam TimeComponents should be of type 'Time::Component'.
+     *
+     * @param string string representation of the date and time.
+     * @param date_component1 'Date' component that the first number in 'string' represents.
+     * @param date_component2 'Date' component that the second number in 'string'
+     * represents.
+     * @param date_component3 'Date' component that the third number in 'string' represents.
+     * @param time_components 'Time' components that correspond to each number in 'string'.
+     *
+     * @return the parsed 'Datetime', or a 'ParseError' describing why 'string' could not be
+     * parsed.
+     */
+    template<typename DateComponent1, typename DateComponent2, typename DateComponent3,
+        typename... TimeComponents>
+        requires std::same_as<DateComponent1, DateComponent>
+            && std::same_as<DateComponent2, DateComponent>
+            && std::same_as<DateComponent3, DateComponent>
+            && (std::same_as<TimeComponents, TimeComponent> && ...)
+    static std::expected<Datetime, ParseError> try_parse(std::string_view string,
+                                                         DateComponent1 date_component1,
+                                                         DateComponent2 date_component2,
+                                                         DateComponent3 date_component3,
+                                                         TimeComponents... time_components);
+
     /**
     * Gets the datetimes within a range.
     *
@@ -191,6 +326,128 @@ public:
     */
     static std::vector<Datetime> range(Datetime start, Datetime end, Nanoseconds increment);
 
+    /**
+    * Gets a lazy view of the datetimes within a range.
+    *
+    * Unlike 'range', no datetimes are stored: each one is computed when it is read.
+    *
+    * @param start starting datetime of the range.
+    * @param end ending datetime of the range. Included if it is a whole number of 'step' after
+    * 'start'.
+    * @param step days between each datetime in the range. Must be positive.
+    *
+    * @return random access view of the datetimes within 'start' to 'end'. Empty if 'end' is
+    * before 'start'.
+    *
+    * @throws std::invalid_argument if 'step' is not positive.
+    */
+    static constexpr IotaView<Datetime, Days> iota(Datetime start, Datetime end, Days step);
+
+    /**
+    * Gets a lazy view of the datetimes within a range.
+    *
+    * Unlike 'range', no datetimes are stored: each one is computed when it is read.
+    *
+    * @param start starting datetime of the range.
+    * @param end ending datetime of the range. Included if it is a whole number of 'step' after
+    * 'start'.
+    * @param step hours between each datetime in the range. Must be positive.
+    *
+    * @return random access view of the datetimes within 'start' to 'end'. Empty if 'end' is
+    * before 'start'.
+    *
+    * @throws std::invalid_argument if 'step' is not positive.
+    */
+    static constexpr IotaView<Datetime, Hours> iota(Datetime start, Datetime end, Hours step);
+
+    /**
+    * Gets a lazy view of the datetimes within a range.
+    *
+    * Unlike 'range', no datetimes are stored: each one is computed when it is read.
+    *
+    * @param start starting datetime of the range.
+    * @param end ending datetime of the range. Included if it is a whole number of 'step' after
+    * 'start'.
+    * @param step minutes between each datetime in the range. Must be positive.
+    *
+    * @return random access view of the datetimes within 'start' to 'end'. Empty if 'end' is
+    * before 'start'.
+    *
+    * @throws std::invalid_argument if 'step' is not positive.
+    */
+    static constexpr IotaView<Datetime, Minutes> iota(Datetime start, Datetime end, Minutes step);
+
+    /**
+    * Gets a lazy view of the datetimes within a range.
+    *
+    * Unlike 'range', no datetimes are stored: each one is computed when it is read.
+    *
+    * @param start starting datetime of the range.
+    * @param end ending datetime of the range. Included if it is a whole number of 'step' after
+    * 'start'.
+    * @param step seconds between each datetime in the range. Must be positive.
+    *
+    * @return random access view of the datetimes within 'start' to 'end'. Empty if 'end' is
+    * before 'start'.
+    *
+    * @throws std::invalid_argument if 'step' is not positive.
+    */
+    static constexpr IotaView<Datetime, Seconds> iota(Datetime start, Datetime end, Seconds step);
+
+    /**
+    * Gets a lazy view of the datetimes within a range.
+    *
+    * Unlike 'range', no datetimes are stored: each one is computed when it is read.
+    *
+    * @param start starting datetime of the range.
+    * @param end ending datetime of the range. Included if it is a whole number of 'step' after
+    * 'start'.
+    * @param step milliseconds between each datetime in the range. Must be positive.
+    *
+    * @return random access view of the datetimes within 'start' to 'end'. Empty if 'end' is
+    * before 'start'.
+    *
+    * @throws std::invalid_argument if 'step' is not positive.
+    */
+    static constexpr IotaView<Datetime, Milliseconds> iota(Datetime start, Datetime end,
+                                                           Milliseconds step);
+
+    /**
+    * Gets a lazy view of the datetimes within a range.
+    *
+    * Unlike 'range', no datetimes are stored: each one is computed when it is read.
+    *
+    * @param start starting datetime of the range.
+    * @param end ending datetime of the range. Included if it is a whole number of 'step' after
+    * 'start'.
+    * @param step microseconds between each datetime in the range. Must be positive.
+    *
+    * @return random access view of the datetimes within 'start' to 'end'. Empty if 'end' is
+    * before 'start'.
+    *
+    * @throws std::invalid_argument if 'step' is not positive.
+    */
+    static constexpr IotaView<Datetime, Microseconds> iota(Datetime start, Datetime end,
+                                                           Microseconds step);
+
+    /**
+    * Gets a lazy view of the datetimes within a range.
+    *
+    * Unlike 'range', no datetimes are stored: each one is computed when it is read.
+    *
+    * @param start starting datetime of the range.
+    * @param end ending datetime of the range. Included if it is a whole number of 'step' after
+    * 'start'.
+    * @param step nanoseconds between each datetime in the range. Must be positive.
+    *
+    * @return random access view of the datetimes within 'start' to 'end'. Empty if 'end' is
+    * before 'start'.
+    *
+    * @throws std::invalid_argument if 'step' is not positive.
+    */
+    static constexpr IotaView<Datetime, Nanoseconds> iota(Datetime start, Datetime end,
+                                                          Nanoseconds step);
+
 
     /**
      * Creates a new 'Date' whose components' values match the date values of this
@@ -198,7 +455,7 @@ public:
      *
      * @return newly created 'Date'.
      */
-    Date date() const;
+    constexpr Date date() const;
 
     /**
      * Creates a new 'Time' whose components' values match the time values of this
@@ -206,7 +463,7 @@ public:
      *
      * @return newly created 'Time'.
      */
-    Time time() const;
+    constexpr Time time() const;
 
     /**
      * Represents this 'Datetime' as a std::string.
@@ -238,6 +495,50 @@ public:
                           char delim_ms_us_ns = '.',
                           char delim_tz = '+') const;
 
+    /**
+     * Writes the 'to_string' representation of this 'Datetime' into '[first, last)', without
+     * allocating.
+     *
+     * @param first start of the buffer to write into.
+     * @param last one past the end of the buffer to write into.
+     * @param include_to Include the time components up until 'include_to' in the resulting
+     * string (inclusive). (default TimeComponent::TIMEZONE)
+     * @param delim_date delimiter between year/month and month/date.
+     * @param delim_date_and_time delimiter between the date and the time.
+     * @param delim_h_m_s 'char' separating hours, minutes, and seconds.
+     * @param delim_ms_us_ns 'char' separating milliseconds, microseconds, and nanoseconds.
+     * @param delim_tz delimiter between nanosecond and timezone.
+     *
+     * @example
+     * char buffer[Datetime::MAX_CHARS];
+     * std::to_chars_result result = datetime.to_chars(buffer, buffer + Datetime::MAX_CHARS);
+     * std::string_view datetime_string = std::string_view(buffer, result.ptr);
+     *
+     * @return one past the last character written, or 'last' with
+     * 'std::errc::value_too_large' if the buffer is too small.
+     */
+    std::to_chars_result to_chars(char* first, char* last,
+                                  TimeComponent include_to = TimeComponent::TIMEZONE,
+                                  char delim_date = '-',
+                                  char delim_date_and_time = ' ',
+                                  char delim_h_m_s = ':',
+                                  char delim_ms_us_ns = '.',
+                                  char delim_tz = '+') const;
+
+    /**
+     * Most characters 'to_chars' can write.
+     */
+    static constexpr size_t MAX_CHARS = Date::MAX_CHARS + 1 + Time::MAX_CHARS;
+
+    /**
+     * Sets the 'timezone' of this 'Datetime'.
+     *
+     * Accounts for day changes.
+     *
+     * @param new_timezone 'Timezone' to set 'timezone' to.
+     */
+    constexpr void set_timezone(Timezone new_timezone);
+
     /**
      * Rounds the components of this 'Datetime', stopping at 'to'.
      *
@@ -250,21 +551,21 @@ public:
      *
      * // output: 2000-01-01 1:03:00.0.0.0
      */
-    Datetime& round(TimeComponent to) override;
+    constexpr Datetime& round(TimeComponent to);
 
     /**
      * Rounds up the components of this 'Datetime', stopping at 'to'.
      *
      * @param to finish the rounding up of this 'Datetime's' components at this 'Component'.
      */
-    Datetime& ceil(TimeComponent to) override;
+    constexpr Datetime& ceil(TimeComponent to);
 
     /**
      * Rounds down the components of this 'Datetime', stopping at 'to'.
      *
      * @param to finish the rounding down of this 'Datetime's' components at this 'Component'.
      */
-    Datetime& floor(TimeComponent to) override;
+    constexpr Datetime& floor(TimeComponent to);
 
     /**
      * Checks if 'this' is greater than 'other'.
@@ -273,7 +574,7 @@ public:
      *
      * @return 'true' if 'this' is greater than this 'other', 'false' otherwise.
      */
-    bool operator>(Datetime other) const;
+    constexpr bool operator>(Datetime other) const;
 
     /**
      * Checks if 'this' is greater than or equal to 'other'.
@@ -282,7 +583,7 @@ public:
      *
      * @return 'true' if 'this' is greater than or equal to this 'other', 'false' otherwise.
      */
-    bool operator>=(Datetime other) const;
+    constexpr bool operator>=(Datetime other) const;
 
     /**
      * Checks if 'this' is less than 'other'.
@@ -291,7 +592,7 @@ public:
      *
      * @return 'true' if 'this' is less than this 'other', 'false' otherwise.
      */
-    bool operator<(Datetime other) const;
+    constexpr bool operator<(Datetime other) const;
 
     /**
      * Checks if 'this' is less than or equal to 'other'.
@@ -300,7 +601,7 @@ public:
      *
      * @return 'true' if 'this' is less than or equal to 'other', 'false' otherwise.
      */
-    bool operator<=(Datetime other) const;
+    constexpr bool operator<=(Datetime other) const;
 
     /**
      * Checks if 'this' is equal to 'other'.
@@ -309,7 +610,7 @@ public:
      *
      * @return 'true' if 'this' is equal to 'other', 'false' otherwise.
      */
-    bool operator==(Datetime other) const;
+    constexpr bool operator==(Datetime other) const;
 
     /**
      * Checks if 'this' is not equal to 'other'.
@@ -318,21 +619,21 @@ public:
      *
      * @return 'true' if 'this' is not equal to 'other', 'false' otherwise.
      */
-    bool operator!=(Datetime other) const;
+    constexpr bool operator!=(Datetime other) const;
 
     /**
      * Adds a day to this 'Datetime'.
      *
      * @return A reference to this modified 'Datetime'.
      */
-    Datetime& operator++() override;
+    constexpr Datetime& operator++();
 
     /**
      * Subtracts a day from this 'Datetime'.
      *
      * @return A reference to this modified 'Datetime'.
      */
-    Datetime& operator--() override;
+    constexpr Datetime& operator--();
 
     /**
      * Adds 'time' to this 'Datetime'.
@@ -341,7 +642,7 @@ public:
      *
      * @return reference to this modified 'Datetime'.
      */
-    Datetime& operator+=(Time time);
+    constexpr Datetime& operator+=(Time time);
 
     /**
      * Subtracts 'time' to this 'Datetime'.
@@ -350,7 +651,7 @@ public:
      *
      * @return reference to this modified 'Datetime'.
      */
-    Datetime& operator-=(Time time);
+    constexpr Datetime& operator-=(Time time);
 
     /**
      * Adds 'time_delta' to 'datetime'.
@@ -360,7 +661,7 @@ public:
      *
      * @return 'datetime' with 'time_delta' added.
      */
-    friend Datetime operator+(Datetime datetime, TimeDelta time_delta);
+    friend constexpr Datetime operator+(Datetime datetime, TimeDelta time_delta);
 
     /**
      * Subtracts 'time_delta' from 'datetime'.
@@ -370,7 +671,7 @@ public:
      *
      * @return 'datetime' with 'time_delta' subtracted.
      */
-    friend Datetime operator-(Datetime datetime, TimeDelta time_delta);
+    friend constexpr Datetime operator-(Datetime datetime, TimeDelta time_delta);
 
     /**
      * Adds 'time_delta' to 'this'.
@@ -379,7 +680,7 @@ public:
      *
      * @return 'this' with 'time_delta' added.
      */
-    Datetime& operator+=(TimeDelta time_delta);
+    constexpr Datetime& operator+=(TimeDelta time_delta);
 
     /**
      * Subtracts 'time_delta' from 'this'.
@@ -388,7 +689,7 @@ public:
      *
      * @return 'this' with 'time_delta' subtracted.
      */
-    Datetime& operator-=(TimeDelta time_delta);
+    constexpr Datetime& operator-=(TimeDelta time_delta);
 
     /**
      * Adds 'days' to this 'Datetime'.
@@ -397,7 +698,7 @@ public:
      *
      * @return A reference to this modified 'Datetime'.
      */
-    Datetime& operator+=(const Days& days) override;
+    constexpr Datetime& operator+=(const Days& days);
 
     /**
      * Subtracts 'days' from this 'Datetime'.
@@ -406,7 +707,7 @@ public:
      *
      * @return A reference to this modified 'Datetime'.
      */
-    Datetime& operator-=(const Days& days) override;
+    constexpr Datetime& operator-=(const Days& days);
 
     /**
      * Adds 'hours' to this 'Datetime'.
@@ -415,7 +716,7 @@ public:
      *
      * @return A reference to this modified 'Datetime'.
      */
-    Datetime& operator+=(const Hours& hours) override;
+    constexpr Datetime& operator+=(const Hours& hours);
 
     /**
      * Subtracts 'hours' from this 'Datetime'.
@@ -424,7 +725,7 @@ public:
      *
      * @return A reference to this modified 'Datetime'.
      */
-    Datetime& operator-=(const Hours& hours) override;
+    constexpr Datetime& operator-=(const Hours& hours);
 
     /**
      * Adds 'minutes' to this 'Datetime'.
@@ -433,7 +734,7 @@ public:
      *
      * @return A reference to this modified 'Datetime'.
      */
-    Datetime& operator+=(const Minutes& minutes) override;
+    constexpr Datetime& operator+=(const Minutes& minutes);
 
     /**
      * Subtracts 'minutes' from this 'Datetime'.
@@ -442,7 +743,7 @@ public:
      *
      * @return A reference to this modified 'Datetime'.
      */
-    Datetime& operator-=(const Minutes& minutes) override;
+    constexpr Datetime& operator-=(const Minutes& minutes);
 
     /**
      * Adds 'seconds' to this 'Datetime'.
@@ -451,7 +752,7 @@ public:
      *
      * @return A reference to this modified 'Datetime'.
      */
-    Datetime& operator+=(const Seconds& seconds) override;
+    constexpr Datetime& operator+=(const Seconds& seconds);
 
     /**
      * Subtracts 'seconds' from this 'Datetime'.
@@ -460,7 +761,7 @@ public:
      *
      * @return A reference to this modified 'Datetime'.
      */
-    Datetime& operator-=(const Seconds& seconds) override;
+    constexpr Datetime& operator-=(const Seconds& seconds);
 
     /**
      * Adds 'milliseconds' to this 'Datetime'.
@@ -469,7 +770,7 @@ public:
      *
      * @return A reference to this modified 'Datetime'.
      */
-    Datetime& operator+=(const Milliseconds& milliseconds) override;
+    constexpr Datetime& operator+=(const Milliseconds& milliseconds);
 
     /**
      * Subtracts 'milliseconds' from this 'Datetime'.
@@ -478,7 +779,7 @@ public:
      *
      * @return A reference to this modified 'Datetime'.
      */
-    Datetime& operator-=(const Milliseconds& milliseconds) override;
+    constexpr Datetime& operator-=(const Milliseconds& milliseconds);
 
     /**
      * Adds 'microseconds' to this 'Datetime'.
@@ -487,7 +788,7 @@ public:
      *
      * @return A reference to this modified 'Datetime'.
      */
-    Datetime& operator+=(const Microseconds& microseconds) override;
+    constexpr Datetime& operator+=(const Microseconds& microseconds);
 
     /**
      * Subtracts 'microseconds' from this 'Datetime'.
@@ -496,7 +797,7 @@ public:
      *
      * @return A reference to this modified 'Datetime'.
      */
-    Datetime& operator-=(const Microseconds& microseconds) override;
+    constexpr Datetime& operator-=(const Microseconds& microseconds);
 
     /**
      * Adds 'nanoseconds' to this 'Datetime'.
@@ -505,7 +806,7 @@ public:
      *
      * @return A reference to this modified 'Datetime'.
      */
-    Datetime& operator+=(const Nanoseconds& nanoseconds) override;
+    constexpr Datetime& operator+=(const Nanoseconds& nanoseconds);
 
     /**
      * Subtracts 'nanoseconds' from this 'Datetime'.
@@ -514,7 +815,7 @@ public:
      *
      * @return A reference to this modified 'Datetime'.
      */
-    Datetime& operator-=(const Nanoseconds& nanoseconds) override;
+    constexpr Datetime& operator-=(const Nanoseconds& nanoseconds);
 
     /**
      * Adds 'hours' to 'datetime'.
@@ -524,7 +825,7 @@ public:
      *
      * @return a new 'Datetime' with 'hours' added.
      */
-    friend Datetime operator+(Datetime datetime, const Hours& hours);
+    friend constexpr Datetime operator+(Datetime datetime, const Hours& hours);
 
     /**
      * Subtracts 'hours' from 'datetime'.
@@ -534,7 +835,7 @@ public:
      *
      * @return a new 'Datetime' with 'hours' subtracted.
      */
-    friend Datetime operator-(Datetime datetime, const Hours& hours);
+    friend constexpr Datetime operator-(Datetime datetime, const Hours& hours);
 
     /**
      * Adds 'minutes' to 'datetime'.
@@ -544,7 +845,7 @@ public:
      *
      * @return a new 'Datetime' with 'minutes' added.
      */
-    friend Datetime operator+(Datetime datetime, const Minutes& minutes);
+    friend constexpr Datetime operator+(Datetime datetime, const Minutes& minutes);
 
     /**
      * Subtracts 'minutes' from 'datetime'.
@@ -554,7 +855,7 @@ public:
      *
      * @return a new 'Datetime' with 'minutes' subtracted.
      */
-    friend Datetime operator-(Datetime datetime, const Minutes& minutes);
+    friend constexpr Datetime operator-(Datetime datetime, const Minutes& minutes);
 
     /**
      * Adds 'seconds' to 'datetime'.
@@ -564,7 +865,7 @@ public:
      *
      * @return a new 'Datetime' with 'seconds' added.
      */
-    friend Datetime operator+(Datetime datetime, const Seconds& seconds);
+    friend constexpr Datetime operator+(Datetime datetime, const Seconds& seconds);
 
     /**
      * Subtracts 'seconds' from 'datetime'.
@@ -574,7 +875,7 @@ public:
      *
      * @return a new 'Datetime' with 'seconds' subtracted.
      */
-    friend Datetime operator-(Datetime datetime, const Seconds& seconds);
+    friend constexpr Datetime operator-(Datetime datetime, const Seconds& seconds);
 
     /**
       * Adds 'milliseconds' to 'datetime'.
@@ -584,7 +885,7 @@ public:
       *
       * @return a new 'Datetime' with 'milliseconds' added.
       */
-    friend Datetime operator+(Datetime datetime, const Milliseconds& milliseconds);
+    friend constexpr Datetime operator+(Datetime datetime, const Milliseconds& milliseconds);
 
     /**
      * Subtracts 'milliseconds' from 'datetime'.
@@ -594,7 +895,7 @@ public:
      *
      * @return a new 'Datetime' with 'milliseconds' subtracted.
      */
-    friend Datetime operator-(Datetime datetime, const Milliseconds& milliseconds);
+    friend constexpr Datetime operator-(Datetime datetime, const Milliseconds& milliseconds);
 
     /**
     * Adds 'microseconds' to 'datetime'.
@@ -604,7 +905,7 @@ public:
     *
     * @return a new 'Datetime' with 'microseconds' added.
     */
-    friend Datetime operator+(Datetime datetime, const Microseconds& microseconds);
+    friend constexpr Datetime operator+(Datetime datetime, const Microseconds& microseconds);
 
     /**
      * Subtracts 'microseconds' from 'datetime'.
@@ -614,7 +915,7 @@ public:
      *
      * @return a new 'Datetime' with 'microseconds' subtracted.
      */
-    friend Datetime operator-(Datetime datetime, const Microseconds& microseconds);
+    friend constexpr Datetime operator-(Datetime datetime, const Microseconds& microseconds);
 
     /**
      * Adds 'nanoseconds' to 'datetime'.
@@ -624,7 +925,7 @@ public:
      *
      * @return a new 'Datetime' with 'nanoseconds' added.
      */
-    friend Datetime operator+(Datetime datetime, const Nanoseconds& nanoseconds);
+    friend constexpr Datetime operator+(Datetime datetime, const Nanoseconds& nanoseconds);
 
     /**
     * Subtracts 'nanoseconds' from 'datetime'.
@@ -634,7 +935,7 @@ public:
     *
     * @return a new 'Datetime' with 'nanoseconds' subtracted.
     */
-    friend Datetime operator-(Datetime datetime, const Nanoseconds& nanoseconds);
+    friend constexpr Datetime operator-(Datetime datetime, const Nanoseconds& nanoseconds);
 
     /**
      * Adds this 'Datetime' and 'other' 'Datetime'.
@@ -644,7 +945,7 @@ public:
      *
      * @return new 'Datetime' object of this 'Datetime' added with 'other' 'Datetime'.
      */
-    friend Datetime operator+(Datetime datetime, Time other);
+    friend constexpr Datetime operator+(Datetime datetime, Time other);
 
     /**
      * Subtracts 'other' from 'datetime'.
@@ -654,7 +955,7 @@ public:
      *
      * @return 'TimeDelta' of the 'other' subtracted from 'datetime'.
      */
-    friend TimeDelta operator-(Datetime datetime, Datetime other);
+    friend constexpr TimeDelta operator-(Datetime datetime, Datetime other);
 
     /**
      * Subtracts this 'Datetime' and 'other' 'Datetime'.
@@ -664,7 +965,7 @@ public:
      *
      * @return new 'Datetime' object of this 'Datetime' subtracted with 'other' 'Datetime'.
      */
-    friend Datetime operator-(Datetime datetime, Time other);
+    friend constexpr Datetime operator-(Datetime datetime, Time other);
 
     /**
      * Outputs 'datetime' into 'os'.
@@ -678,52 +979,539 @@ public:
 
 private:
 
-    template<typename Func>
-    requires std::is_invocable_v<Func, Datetime&>
-    static std::vector<Datetime> range(Datetime& start, Datetime& end, Func increment);
-
     /**
-     * Adds hours to this 'Datetime'.
+     * Gets a lazy view of the datetimes from 'start' to 'end', 'step' apart.
      *
-     * @param hours_to_add number of hours to add.
+     * @tparam NanosecondsPerUnit nanoseconds in one unit of 'Step'.
+     * @tparam Step component 'step' is counted in.
      *
-     * @return the number of days changed by the hours added.
-     */
-    int64_t add_hours(int64_t hours_to_add) override;
-
-    /**
-     * Milliseconds in a day.
+     * @param start starting datetime of the range.
+     * @param end ending datetime of the range.
+     * @param step distance between each datetime in the range.
+     *
+     * @return view of the datetimes within 'start' to 'end'.
      */
-    static const size_t MILLISECONDS_PER_DAY;
+    template<int64_t NanosecondsPerUnit, typename Step>
+    static constexpr IotaView<Datetime, Step> iota_in_units(Datetime start, Datetime end,
+                                                            Step step);
 
     /**
-     * Milliseconds in a year that is not a leap year.
+     * Adds the days carried out of the time components to this 'Datetime's' date.
+     *
+     * @param day_change number of days to add.
      */
-    static const size_t MILLISECONDS_PER_NON_LEAP_YEAR;
+    constexpr void apply_day_change(int64_t day_change);
 
     /**
-     * Milliseconds in a year that is a leap year.
+     * Gets the nanoseconds since 'EPOCH' in UTC of the instant this 'Datetime' represents.
+     *
+     * Equal instants have equal keys regardless of their timezones, so comparisons and hashing
+     * can use it instead of converting one 'Datetime' to the other's timezone.
+     *
+     * @return nanoseconds since 'EPOCH' in UTC.
      */
-    static const size_t MILLISECONDS_PER_LEAP_YEAR;
+    constexpr int64_t utc_nanoseconds() const;
 
     // These methods are no longer intuitive, so hide from user.
 
-    int total_minutes() const override;
+    constexpr int total_minutes() const;
 
-    int total_seconds() const override;
+    constexpr int total_seconds() const;
 
-    int64_t total_milliseconds() const override;
+    constexpr int64_t total_milliseconds() const;
 
-    int64_t total_microseconds() const override;
+    constexpr int64_t total_microseconds() const;
 
-    int64_t total_nanoseconds() const override;
+    constexpr int64_t total_nanoseconds() const;
 };
 
+static_assert(sizeof(Datetime) == 16);
+static_assert(std::is_trivially_copyable_v<Datetime>);
+
+constexpr int64_t Datetime::utc_nanoseconds() const
+{
+    // 'utc_offset_minutes' is the minutes behind UTC, so add it to get from local time to UTC.
+    return to_day_number() * NANOSECONDS_PER_DAY + total_nanoseconds()
+           + timezone.utc_offset_minutes * static_cast<int64_t>(NANOSECONDS_PER_MINUTE);
+}
+
+constexpr IotaView<Datetime, Days> Datetime::iota(Datetime start, Datetime end,
+                                                  Days step)
+{
+    return iota_in_units<NANOSECONDS_PER_DAY>(start, end, step);
+}
+
+constexpr IotaView<Datetime, Hours> Datetime::iota(Datetime start, Datetime end,
+                                                   Hours step)
+{
+    return iota_in_units<NANOSECONDS_PER_HOUR>(start, end, step);
+}
+
+constexpr IotaView<Datetime, Minutes> Datetime::iota(Datetime start, Datetime end,
+                                                     Minutes step)
+{
+    return iota_in_units<NANOSECONDS_PER_MINUTE>(start, end, step);
+}
+
+constexpr IotaView<Datetime, Seconds> Datetime::iota(Datetime start, Datetime end,
+                                                     Seconds step)
+{
+    return iota_in_units<NANOSECONDS_PER_SECOND>(start, end, step);
+}
+
+constexpr IotaView<Datetime, Milliseconds> Datetime::iota(Datetime start, Datetime end,
+                                                          Milliseconds step)
+{
+    return iota_in_units<NANOSECONDS_PER_MILLISECOND>(start, end, step);
+}
+
+constexpr IotaView<Datetime, Microseconds> Datetime::iota(Datetime start, Datetime end,
+                                                          Microseconds step)
+{
+    return iota_in_units<NANOSECONDS_PER_MICROSECOND>(start, end, step);
+}
+
+constexpr IotaView<Datetime, Nanoseconds> Datetime::iota(Datetime start, Datetime end,
+                                                         Nanoseconds step)
+{
+    return iota_in_units<1>(start, end, step);
+}
+
+template<int64_t NanosecondsPerUnit, typename Step>
+constexpr IotaView<Datetime, Step> Datetime::iota_in_units(Datetime start, Datetime end,
+                                                           Step step)
+{
+    // Kept as days and nanoseconds, rather than 'utc_nanoseconds()', so ranges counted in
+    // large units can span any pair of valid dates.
+    int64_t days_to_end = end.to_day_number() - start.to_day_number();
+    int64_t nanoseconds_to_end = end.total_nanoseconds() - start.total_nanoseconds()
+                                 + (end.timezone.utc_offset_minutes
+                                    - start.timezone.utc_offset_minutes)
+                                   * static_cast<int64_t>(NANOSECONDS_PER_MINUTE);
+
+    return IotaView<Datetime, Step>(start,
+                                    days_to_end * (NANOSECONDS_PER_DAY / NanosecondsPerUnit)
+                                    + arithmetic::floor_div(nanoseconds_to_end,
+                                                            NanosecondsPerUnit),
+                                    step);
+}
+
+constexpr void Datetime::apply_day_change(int64_t day_change)
+{
+    if (day_change != 0)
+        add_days(day_change);
+}
+
+constexpr void Datetime::set_timezone(Timezone new_timezone)
+{
+    apply_day_change(add_minutes(timezone.get_utc_offset_diff(new_timezone).value));
+    timezone = new_timezone;
+}
+
+constexpr Date Datetime::date() const
+{
+    return Date(year, month, day);
+}
+
+constexpr Time Datetime::time() const
+{
+    return Time(hour, minute, second, millisecond, microsecond, nanosecond, timezone);
+}
+
+constexpr bool Datetime::operator>(Datetime other) const
+{
+    return utc_nanoseconds() > other.utc_nanoseconds();
+}
+
+constexpr bool Datetime::operator>=(Datetime other) const
+{
+    return utc_nanoseconds() >= other.utc_nanoseconds();
+}
+
+constexpr bool Datetime::operator<(Datetime other) const
+{
+    return utc_nanoseconds() < other.utc_nanoseconds();
+}
+
+constexpr bool Datetime::operator<=(Datetime other) const
+{
+    return utc_nanoseconds() <= other.utc_nanoseconds();
+}
+
+constexpr bool Datetime::operator==(Datetime other) const
+{
+    return utc_nanoseconds() == other.utc_nanoseconds();
+}
+
+constexpr bool Datetime::operator!=(Datetime other) const
+{
+    return utc_nanoseconds() != other.utc_nanoseconds();
+}
+
+constexpr Datetime &Datetime::operator+=(const Days& days)
+{
+    Date::operator+=(days);
+    return *this;
+}
+
+constexpr Datetime &Datetime::operator-=(const Days& days)
+{
+    Date::operator-=(days);
+    return *this;
+}
+
+constexpr Datetime &Datetime::operator+=(const Hours& hours)
+{
+    apply_day_change(add_hours(hours.value));
+    return *this;
+}
+
+constexpr Datetime &Datetime::operator-=(const Hours& hours)
+{
+    apply_day_change(add_hours(-hours.value));
+    return *this;
+}
+
+constexpr Datetime &Datetime::operator+=(const Minutes& minutes)
+{
+    apply_day_change(add_minutes(minutes.value));
+    return *this;
+}
+
+constexpr Datetime &Datetime::operator-=(const Minutes& minutes)
+{
+    apply_day_change(add_minutes(-minutes.value));
+    return *this;
+}
+
+constexpr Datetime &Datetime::operator+=(const Seconds& seconds)
+{
+    apply_day_change(add_seconds(seconds.value));
+    return *this;
+}
+
+constexpr Datetime &Datetime::operator-=(const Seconds& seconds)
+{
+    apply_day_change(add_seconds(-seconds.value));
+    return *this;
+}
+
+constexpr Datetime &Datetime::operator+=(const Milliseconds& milliseconds)
+{
+    apply_day_change(add_milliseconds(milliseconds.value));
+    return *this;
+}
+
+constexpr Datetime &Datetime::operator-=(const Milliseconds& milliseconds)
+{
+    apply_day_change(add_milliseconds(-milliseconds.value));
+    return *this;
+}
+
+constexpr Datetime &Datetime::operator+=(const Microseconds& microseconds)
+{
+    apply_day_change(add_microseconds(microseconds.value));
+    return *this;
+}
+
+constexpr Datetime &Datetime::operator-=(const Microseconds& microseconds)
+{
+    apply_day_change(add_microseconds(-microseconds.value));
+    return *this;
+}
+
+constexpr Datetime &Datetime::operator+=(const Nanoseconds& nanoseconds)
+{
+    apply_day_change(add_nanoseconds(nanoseconds.value));
+    return *this;
+}
+
+constexpr Datetime &Datetime::operator-=(const Nanoseconds& nanoseconds)
+{
+    apply_day_change(add_nanoseconds(-nanoseconds.value));
+    return *this;
+}
+
+constexpr Datetime &Datetime::operator++()
+{
+    Date::operator++();
+    return *this;
+}
+
+constexpr Datetime &Datetime::operator--()
+{
+    Date::operator--();
+    return *this;
+}
+
+constexpr Datetime Datetime::from_ms(size_t timestamp, Timezone to_timezone, Timezone from_timezone)
+{
+    return from_ns(timestamp * NANOSECONDS_PER_MILLISECOND, to_timezone, from_timezone);
+}
+
+constexpr Datetime Datetime::from_us(size_t timestamp, Timezone to_timezone, Timezone from_timezone)
+{
+    return from_ns(timestamp * NANOSECONDS_PER_MICROSECOND, to_timezone, from_timezone);
+}
+
+constexpr Datetime Datetime::from_ns(size_t timestamp, Timezone to_timezone, Timezone from_timezone)
+{
+    Date date = from_day_number(static_cast<int64_t>(timestamp / NANOSECONDS_PER_DAY));
+    timestamp %= NANOSECONDS_PER_DAY;
+
+    Datetime ret = Datetime(UNCHECKED, date.year, date.month, date.day,
+                            timestamp / NANOSECONDS_PER_HOUR,
+                            timestamp / NANOSECONDS_PER_MINUTE % MINUTES_PER_HOUR,
+                            timestamp / NANOSECONDS_PER_SECOND % SECONDS_PER_MINUTE,
+                            timestamp / NANOSECONDS_PER_MILLISECOND % MILLISECONDS_PER_SECOND,
+                            timestamp / NANOSECONDS_PER_MICROSECOND % MICROSECONDS_PER_MILLISECOND,
+                            timestamp % NANOSECONDS_PER_MICROSECOND,
+                            from_timezone);
+
+    ret.set_timezone(to_timezone);
+
+    return ret;
+}
+
+constexpr Datetime operator+(Datetime datetime, const Hours& hours)
+{
+    datetime += hours;
+    return datetime;
+}
+
+constexpr Datetime operator-(Datetime datetime, const Hours& hours)
+{
+    datetime -= hours;
+    return datetime;
+}
+
+constexpr Datetime operator+(Datetime datetime, const Minutes& minutes)
+{
+    datetime += minutes;
+    return datetime;
+}
+
+constexpr Datetime operator-(Datetime datetime, const Minutes& minutes)
+{
+    datetime -= minutes;
+    return datetime;
+}
+
+constexpr Datetime operator+(Datetime datetime, const Seconds& seconds)
+{
+    datetime += seconds;
+    return datetime;
+}
+
+constexpr Datetime operator-(Datetime datetime, const Seconds& seconds)
+{
+    datetime -= seconds;
+    return datetime;
+}
+
+constexpr Datetime operator+(Datetime datetime, const Milliseconds& milliseconds)
+{
+    datetime += milliseconds;
+    return datetime;
+}
+
+constexpr Datetime operator-(Datetime datetime, const Milliseconds& milliseconds)
+{
+    datetime -= milliseconds;
+    return datetime;
+}
+
+constexpr Datetime operator+(Datetime datetime, const Microseconds& microseconds)
+{
+    datetime += microseconds;
+    return datetime;
+}
+
+constexpr Datetime operator-(Datetime datetime, const Microseconds& microseconds)
+{
+    datetime -= microseconds;
+    return datetime;
+}
+
+constexpr Datetime operator+(Datetime datetime, const Nanoseconds& nanoseconds)
+{
+    datetime += nanoseconds;
+    return datetime;
+}
+
+constexpr Datetime operator-(Datetime datetime, const Nanoseconds& nanoseconds)
+{
+    datetime -= nanoseconds;
+    return datetime;
+}
+
+constexpr Datetime operator+(Datetime datetime, Time other)
+{
+    other.set_timezone(datetime.timezone);
+    datetime += other;
+    return datetime;
+}
+
+constexpr Datetime operator-(Datetime datetime, Time other)
+{
+    other.set_timezone(datetime.timezone);
+    datetime -= other;
+    return datetime;
+}
+
+constexpr Datetime& Datetime::operator+=(Time time)
+{
+    TimeDelta time_delta = this->time() + std::move(time);
+    nanosecond = time_delta.nanosecond;
+    microsecond = time_delta.microsecond;
+    millisecond = time_delta.millisecond;
+    second = time_delta.second;
+    minute = time_delta.minute;
+    hour = time_delta.hour;
+    (*this) += Days(time_delta.days);
+    return *this;
+}
+
+constexpr Datetime& Datetime::operator-=(Time time)
+{
+    TimeDelta time_delta = this->time() - std::move(time);
+    nanosecond = time_delta.nanosecond;
+    microsecond = time_delta.microsecond;
+    millisecond = time_delta.millisecond;
+    second = time_delta.second;
+    minute = time_delta.minute;
+    hour = time_delta.hour;
+    (*this) -= Days(-time_delta.days);
+    return *this;
+}
+
+constexpr size_t Datetime::to_ms(Timezone timezone) const
+{
+    return to_ns(timezone) / NANOSECONDS_PER_MILLISECOND;
+}
+
+constexpr size_t Datetime::to_us(Timezone timezone) const
+{
+    return to_ns(timezone) / NANOSECONDS_PER_MICROSECOND;
+}
+
+constexpr size_t Datetime::to_ns(Timezone timezone) const
+{
+    return utc_nanoseconds()
+           - timezone.utc_offset_minutes * static_cast<int64_t>(NANOSECONDS_PER_MINUTE);
+}
+
+constexpr Datetime& Datetime::operator+=(TimeDelta time_delta)
+{
+    (*this) += Days(time_delta.days);
+    (*this) += Time(time_delta, timezone);
+    return *this;
+}
+
+constexpr Datetime& Datetime::operator-=(TimeDelta time_delta)
+{
+    (*this) -= Days(time_delta.days);
+    (*this) -= Time(time_delta, timezone);
+    return *this;
+}
+
+constexpr Datetime operator+(Datetime datetime, TimeDelta time_delta)
+{
+    datetime += std::move(time_delta);
+    return datetime;
+}
+
+constexpr Datetime operator-(Datetime datetime, TimeDelta time_delta)
+{
+    datetime -= std::move(time_delta);
+    return datetime;
+}
+
+constexpr TimeDelta operator-(Datetime datetime, Datetime other)
+{
+    TimeDelta date_delta = datetime.date() - other.date();
+    TimeDelta time_delta = datetime.time() - other.time();
+    return TimeDelta(date_delta.days, time_delta.hour, time_delta.minute, time_delta.second,
+                     time_delta.millisecond, time_delta.microsecond, time_delta.nanosecond);
+}
+
+constexpr int Datetime::total_minutes() const
+{
+    return BasicTime::total_minutes();
+}
+
+constexpr int Datetime::total_seconds() const
+{
+    return BasicTime::total_seconds();
+}
+
+constexpr int64_t Datetime::total_milliseconds() const
+{
+    return BasicTime::total_milliseconds();
+}
+
+constexpr int64_t Datetime::total_microseconds() const
+{
+    return BasicTime::total_microseconds();
+}
+
+constexpr int64_t Datetime::total_nanoseconds() const
+{
+    return BasicTime::total_nanoseconds();
+}
+
+constexpr Datetime& Datetime::round(TimeComponent to)
+{
+    apply_day_change(round_components(to));
+    return *this;
+}
+
+constexpr Datetime& Datetime::ceil(TimeComponent to)
+{
+    apply_day_change(ceil_components(to));
+    return *this;
+}
+
+constexpr Datetime& Datetime::floor(TimeComponent to)
+{
+    Time::floor(to);
+    return *this;
+}
+
+template<typename DateComponent1, typename DateComponent2, typename DateComponent3,
+    typename... TimeComponents>
+    requires std::same_as<DateComponent1, DateComponent>
+        && std::same_as<DateComponent2, DateComponent>
+        && std::same_as<DateComponent3, DateComponent>
+        && (std::same_as<TimeComponents, TimeComponent> && ...)
+std::expected<Datetime, ParseError> Datetime::try_parse(std::string_view string,
+                                                        DateComponent1 date_component1,
+                                                        DateComponent2 date_component2,
+                                                        DateComponent3 date_component3,
+                                                        TimeComponents... time_components)
+{
+    // First 10 characters in 'string' will be for the date, remaining will be for the time.
+    std::expected<Date, ParseError> date = Date::try_parse(string.substr(0, 10), date_component1,
+                                                           date_component2, date_component3);
+    if (!date.has_value())
+        return std::unexpected(date.error());
+
+    size_t time_start = std::min<size_t>(10, string.size());
+    std::expected<Time, ParseError> time = Time::try_parse(string.substr(time_start),
+                                                           time_components...);
+    if (!time.has_value())
+        return std::unexpected(ParseError{time.error().code,
+                                          static_cast<uint32_t>(time.error().offset + time_start)});
+
+    return Datetime(*date, *time);
+}
+
 inline size_t hash_value(const Datetime& datetime)
 {
+    // Hash the instant rather than the components, so equal instants in different timezones
+    // hash the same.
     size_t seed = 0;
-    boost::hash_combine(seed, datetime.date());
-    boost::hash_combine(seed, datetime.time());
+    boost::hash_combine(seed, datetime.to_ns(TZ::UTC));
     return seed;
 }
 
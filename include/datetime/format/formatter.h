@@ -0,0 +1,333 @@
+#ifndef DATETIME_FORMATTER_H
+#define DATETIME_FORMATTER_H
+
+#include "datetime/datetime/datetime.h"
+#include "datetime/timedelta/timedelta.h"
+#include "datetime/time/timezone.h"
+#include <fmt/format.h>
+#include <array>
+#include <string_view>
+#include <type_traits>
+
+/**
+ * Implementation of the 'fmt::formatter' specializations for 'Date', 'Time', 'Datetime',
+ * 'TimeDelta', and 'Timezone'.
+ */
+namespace datetime_format
+{
+/**
+ * Parsed format spec, such as '%Y-%m-%dT%H:%M:%S.%9f%z'.
+ *
+ * Directives:
+ *  %Y  year, 4 digits.
+ *  %m  month, 2 digits.
+ *  %d  day, 2 digits.
+ *  %D  days of a 'TimeDelta'.
+ *  %H  hour, 2 digits.
+ *  %M  minute, 2 digits.
+ *  %S  second, 2 digits.
+ *  %f  fraction of the second, 1 to 9 digits given before the 'f'. (default 9)
+ *  %z  UTC offset, '+HH:MM' or '-HH:MM'.
+ *  %%  a literal '%'.
+ *
+ * Any other character is written as is. An empty spec writes what 'to_string' does.
+ */
+class Spec
+{
+public:
+    /**
+     * Most directives and characters a spec can have.
+     */
+    static constexpr size_t MAX_ITEMS = 32;
+
+    /**
+     * Most characters one directive can write, which is a negative 'int64_t' for '%D'.
+     */
+    static constexpr size_t MAX_CHARS_PER_ITEM = 20;
+
+    /**
+     * Most characters 'write' can write.
+     */
+    static constexpr size_t MAX_CHARS = MAX_ITEMS * MAX_CHARS_PER_ITEM;
+    /**
+     * Parses the spec in '[begin, end)', up to the closing '}'.
+     *
+     * Evaluated at compile time for format strings known at compile time, so an invalid spec
+     * fails to compile.
+     *
+     * @param begin start of the spec.
+     * @param end end of the format string.
+     * @param directives directives allowed for the type being formatted.
+     *
+     * @return pointer to the closing '}'.
+     *
+     * @throws fmt::format_error if the spec has a directive that is not in 'directives', an
+     * invalid '%f' digit count, or more than 'MAX_ITEMS' directives and characters.
+     */
+    constexpr const char* parse(const char* begin, const char* end, std::string_view directives)
+    {
+        const char* it = begin;
+        for (; it != end && *it != '}'; it++)
+        {
+            if (size == MAX_ITEMS)
+                throw fmt::format_error("format spec is too long");
+
+            Item& item = items[size++];
+            item = {0, *it, 0};
+            if (*it != '%')
+                continue;
+
+            if (++it == end)
+                throw fmt::format_error("format spec ends with '%'");
+
+            if (*it == '%')
+                continue;
+
+            item.digits = 9;
+            if (*it >= '1' && *it <= '9')
+            {
+                item.digits = static_cast<uint8_t>(*it - '0');
+                if (++it == end || *it != 'f')
+                    throw fmt::format_error("format spec digit count must be followed by 'f'");
+            }
+
+            if (directives.find(*it) == std::string_view::npos)
+                throw fmt::format_error("format spec directive is not supported for this type");
+
+            item.directive = *it;
+        }
+        return it;
+    }
+
+    /**
+     * Checks if the spec is empty.
+     *
+     * @return 'true' if the spec is empty, 'false' otherwise.
+     */
+    constexpr bool empty() const
+    {
+        return size == 0;
+    }
+
+    /**
+     * Writes 'date', 'time', 'time_delta_days', and 'timezone' into 'out' as the spec
+     * describes. 'out' must have room for 'MAX_CHARS' characters.
+     *
+     * @param out buffer to write to.
+     * @param date date components to write.
+     * @param time time components to write.
+     * @param time_delta_days days to write for '%D'.
+     * @param timezone timezone to write for '%z'.
+     *
+     * @return one past the last character written.
+     */
+    char* write(char* out, const Date& date, const BasicTime& time, int64_t time_delta_days,
+                Timezone timezone) const
+    {
+        for (size_t i = 0; i < size; i++)
+        {
+            const Item& item = items[i];
+            switch (item.directive)
+            {
+            case 'Y':
+                out = write_number(out, date.year, 4);
+                break;
+            case 'm':
+                out = write_number(out, date.month, 2);
+                break;
+            case 'd':
+                out = write_number(out, date.day, 2);
+                break;
+            case 'D':
+                out = write_number(out, time_delta_days, 1);
+                break;
+            case 'H':
+                out = write_number(out, time.hour, 2);
+                break;
+            case 'M':
+                out = write_number(out, time.minute, 2);
+                break;
+            case 'S':
+                out = write_number(out, time.second, 2);
+                break;
+            case 'f':
+            {
+                int64_t fraction = time.millisecond * 1'000'000 + time.microsecond * 1'000
+                                   + time.nanosecond;
+                for (int digits = 9; digits > item.digits; digits--)
+                    fraction /= 10;
+                out = write_number(out, fraction, item.digits);
+                break;
+            }
+            case 'z':
+            {
+                // 'utc_offset_minutes' is the minutes behind UTC, ISO 8601 offsets are ahead of
+                // UTC.
+                int offset = timezone.utc_offset_minutes;
+                *out++ = offset > 0 ? '-' : '+';
+                if (offset < 0)
+                    offset = -offset;
+                out = write_number(out, offset / 60, 2);
+                *out++ = ':';
+                out = write_number(out, offset % 60, 2);
+                break;
+            }
+            default:
+                *out++ = item.character;
+                break;
+            }
+        }
+        return out;
+    }
+
+private:
+
+    /**
+     * A directive, or a character written as is.
+     */
+    struct Item
+    {
+        /**
+         * Directive character, or 0 to write 'character' as is.
+         */
+        char directive;
+
+        /**
+         * Character to write as is.
+         */
+        char character;
+
+        /**
+         * Number of digits to write for '%f'.
+         */
+        uint8_t digits;
+    };
+
+
+    /**
+     * Writes 'value' into 'out', padded with leading zeros to 'min_width' digits.
+     *
+     * @param out buffer to write to.
+     * @param value number to write.
+     * @param min_width minimum number of digits to write.
+     *
+     * @return one past the last character written.
+     */
+    static char* write_number(char* out, int64_t value, int min_width)
+    {
+        chars::Writer writer = {out, out + MAX_CHARS_PER_ITEM};
+        writer.put_number(value, min_width);
+        return writer.pos;
+    }
+
+    std::array<Item, MAX_ITEMS> items{};
+
+    size_t size = 0;
+};
+
+/**
+ * 'fmt::formatter' for 'T', one of 'Date', 'Time', 'Datetime', 'TimeDelta', or 'Timezone'.
+ *
+ * @tparam T type being formatted.
+ */
+template<typename T>
+class Formatter
+{
+public:
+    /**
+     * Parses the format spec.
+     *
+     * @param ctx context holding the format spec.
+     *
+     * @return iterator to the closing '}'.
+     *
+     * @throws fmt::format_error if the spec is invalid for 'T'.
+     */
+    constexpr auto parse(fmt::format_parse_context& ctx)
+    {
+        return spec.parse(ctx.begin(), ctx.end(), directives());
+    }
+
+    /**
+     * Writes 'value' into the output of 'ctx'.
+     *
+     * @param value value to format.
+     * @param ctx context holding the output.
+     *
+     * @return iterator past the written characters.
+     */
+    template<typename FormatContext>
+    auto format(const T& value, FormatContext& ctx) const
+    {
+        // Written into a buffer first, so it is copied into the output all at once.
+        char buffer[Spec::MAX_CHARS];
+        char* last;
+
+        if (spec.empty())
+            last = value.to_chars(buffer, buffer + T::MAX_CHARS).ptr;
+        else if constexpr (std::is_same_v<T, Datetime>)
+            last = spec.write(buffer, value, value, 0, value.timezone);
+        else if constexpr (std::is_same_v<T, Date>)
+            last = spec.write(buffer, value, BasicTime(), 0, TZ::UTC);
+        else if constexpr (std::is_same_v<T, Time>)
+            last = spec.write(buffer, Date::EPOCH, value, 0, value.timezone);
+        else if constexpr (std::is_same_v<T, TimeDelta>)
+            last = spec.write(buffer, Date::EPOCH, value, value.days, TZ::UTC);
+        else
+            last = spec.write(buffer, Date::EPOCH, BasicTime(), 0, value);
+
+        return fmt::formatter<fmt::string_view>().format(fmt::string_view(buffer, last - buffer),
+                                                         ctx);
+    }
+
+private:
+
+    /**
+     * Gets the directives allowed for 'T'.
+     *
+     * @return directives allowed for 'T'.
+     */
+    static constexpr std::string_view directives()
+    {
+        if constexpr (std::is_same_v<T, Datetime>)
+            return "YmdHMSfz";
+        else if constexpr (std::is_same_v<T, Date>)
+            return "Ymd";
+        else if constexpr (std::is_same_v<T, Time>)
+            return "HMSfz";
+        else if constexpr (std::is_same_v<T, TimeDelta>)
+            return "DHMSf";
+        else
+            return "z";
+    }
+
+    Spec spec;
+};
+}
+
+template<>
+struct fmt::formatter<Date> : datetime_format::Formatter<Date> {};
+
+template<>
+struct fmt::formatter<Time> : datetime_format::Formatter<Time> {};
+
+template<>
+struct fmt::formatter<Datetime> : datetime_format::Formatter<Datetime> {};
+
+template<>
+struct fmt::formatter<TimeDelta> : datetime_format::Formatter<TimeDelta> {};
+
+template<>
+struct fmt::formatter<Timezone> : datetime_format::Formatter<Timezone> {};
+
+template<>
+struct fmt::formatter<TZ::helpers::LocalTimezone> : fmt::formatter<Timezone>
+{
+    template<typename FormatContext>
+    auto format(TZ::helpers::LocalTimezone local_timezone, FormatContext& ctx) const
+    {
+        return fmt::formatter<Timezone>::format(local_timezone, ctx);
+    }
+};
+
+#endif //DATETIME_FORMATTER_H
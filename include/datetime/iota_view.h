@@ -0,0 +1,236 @@
+#ifndef DATETIME_IOTA_VIEW_H
+#define DATETIME_IOTA_VIEW_H
+
+#include "../../src/util/macros.h"
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <fmt/format.h>
+#include <iterator>
+#include <ranges>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * Lazy view of the values 'start', 'start + step', 'start + 2 * step', ... up to an end.
+ *
+ * Values are made as they are read instead of being stored, so a view of billions of values is
+ * no more expensive to create than a view of one. The view is random access: 'size()',
+ * 'operator[]' and moving an iterator by 'n' are all O(1), so it can be passed to 'std::ranges'
+ * algorithms or split between threads without allocating.
+ *
+ * Created by 'Date::iota', 'Time::iota', and 'Datetime::iota'.
+ *
+ * @tparam T type of the values in the view.
+ * @tparam Step component the step between values is counted in, such as 'Days' or 'Seconds'.
+ * 'T' must support 'T += Step' and 'T -= Step'.
+ */
+template<typename T, typename Step>
+class IotaView : public std::ranges::view_interface<IotaView<T, Step>>
+{
+public:
+    /**
+     * Random access iterator over an 'IotaView'.
+     *
+     * Keeps the current value, so stepping forward or back one value is a single 'T += Step'.
+     * Iterators are compared by their position in the view.
+     */
+    class Iterator
+    {
+    public:
+        using iterator_concept = std::random_access_iterator_tag;
+        // Values are returned by copy, so to the older iterator categories this is only an
+        // input iterator.
+        using iterator_category = std::input_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+
+        /**
+         * Creates an 'Iterator' which does not point into any view.
+         */
+        constexpr Iterator() = default;
+
+        /**
+         * Creates an 'Iterator' at 'index' in a view whose values are 'step' apart.
+         *
+         * @param current value at 'index'.
+         * @param step units of 'Step' between consecutive values.
+         * @param index position of 'current' in the view.
+         */
+        constexpr Iterator(T current, int64_t step, difference_type index) :
+            current(current),
+            step(step),
+            index(index) {}
+
+        constexpr T operator*() const
+        {
+            return current;
+        }
+
+        constexpr T operator[](difference_type n) const
+        {
+            return *(*this + n);
+        }
+
+        constexpr Iterator& operator++()
+        {
+            current += Step(step);
+            index++;
+            return *this;
+        }
+
+        constexpr Iterator operator++(int)
+        {
+            Iterator ret = *this;
+            ++*this;
+            return ret;
+        }
+
+        constexpr Iterator& operator--()
+        {
+            current -= Step(step);
+            index--;
+            return *this;
+        }
+
+        constexpr Iterator operator--(int)
+        {
+            Iterator ret = *this;
+            --*this;
+            return ret;
+        }
+
+        constexpr Iterator& operator+=(difference_type n)
+        {
+            current += Step(n * step);
+            index += n;
+            return *this;
+        }
+
+        constexpr Iterator& operator-=(difference_type n)
+        {
+            return *this += -n;
+        }
+
+        friend constexpr Iterator operator+(Iterator iterator, difference_type n)
+        {
+            return iterator += n;
+        }
+
+        friend constexpr Iterator operator+(difference_type n, Iterator iterator)
+        {
+            return iterator += n;
+        }
+
+        friend constexpr Iterator operator-(Iterator iterator, difference_type n)
+        {
+            return iterator -= n;
+        }
+
+        friend constexpr difference_type operator-(const Iterator& iterator,
+                                                   const Iterator& other)
+        {
+            return iterator.index - other.index;
+        }
+
+        friend constexpr bool operator==(const Iterator& iterator, const Iterator& other)
+        {
+            return iterator.index == other.index;
+        }
+
+        friend constexpr std::strong_ordering operator<=>(const Iterator& iterator,
+                                                          const Iterator& other)
+        {
+            return iterator.index <=> other.index;
+        }
+
+    private:
+        /**
+         * Value at 'index'.
+         */
+        T current{};
+
+        /**
+         * Units of 'Step' between consecutive values.
+         */
+        int64_t step = 0;
+
+        /**
+         * Position in the view.
+         */
+        difference_type index = 0;
+    };
+
+    /**
+     * Creates an empty 'IotaView'.
+     */
+    constexpr IotaView() = default;
+
+    /**
+     * Creates an 'IotaView' of the values from 'start' that are at most 'units_to_end' units of
+     * 'Step' after it, 'step' apart.
+     *
+     * @param start first value of the view.
+     * @param units_to_end whole units of 'Step' from 'start' to the end of the range, rounded
+     * down. Negative if the end is before 'start', which makes the view empty.
+     * @param step distance between consecutive values.
+     *
+     * @throws std::invalid_argument if 'step' is not positive.
+     */
+    constexpr IotaView(T start, int64_t units_to_end, Step step) :
+        start(start),
+        step(step.value)
+    {
+        ASSERT(step.value > 0,
+               std::invalid_argument(fmt::format("Step must be positive, got {}", step.value)));
+
+        count = units_to_end < 0 ? 0 : static_cast<size_t>(units_to_end / step.value + 1);
+    }
+
+    constexpr Iterator begin() const
+    {
+        return Iterator(start, step, 0);
+    }
+
+    constexpr Iterator end() const
+    {
+        return begin() + static_cast<std::ptrdiff_t>(count);
+    }
+
+    constexpr size_t size() const
+    {
+        return count;
+    }
+
+    /**
+     * Copies the values of this view into a 'std::vector'.
+     *
+     * @return 'std::vector' of the values of this view, with a single allocation.
+     */
+    std::vector<T> to_vector() const
+    {
+        std::vector<T> ret;
+        ret.reserve(count);
+        for (T value : *this)
+            ret.push_back(value);
+        return ret;
+    }
+
+private:
+    /**
+     * First value of the view.
+     */
+    T start{};
+
+    /**
+     * Units of 'Step' between consecutive values.
+     */
+    int64_t step = 1;
+
+    /**
+     * Number of values in the view.
+     */
+    size_t count = 0;
+};
+
+#endif //DATETIME_IOTA_VIEW_H
@@ -0,0 +1,177 @@
+#ifndef DATETIME_FIXED_FORMAT_H
+#define DATETIME_FIXED_FORMAT_H
+
+#include "datetime/parse/parse_error.h"
+#include "datetime/timestamp/timestamp.h"
+#include <array>
+#include <cstdint>
+#include <expected>
+#include <span>
+#include <string_view>
+
+/**
+ * Layout of fixed width datetime strings, such as the columns of vendor files, for 'parse_fixed'.
+ *
+ * Described with the directives of the 'fmt::formatter' specs, each of which is a fixed number
+ * of digits:
+ *  %Y  year, 4 digits.
+ *  %m  month, 2 digits.
+ *  %d  day, 2 digits.
+ *  %H  hour, 2 digits.
+ *  %M  minute, 2 digits.
+ *  %S  second, 2 digits.
+ *  %f  fraction of the second, 1 to 9 digits given before the 'f'. (default 9)
+ *  %%  a literal '%'.
+ *
+ * Any other character must be in the string as is. '%Y', '%m', and '%d' are required, and the
+ * time directives default to 0 when missing.
+ *
+ * @code
+ * FixedFormat format = FixedFormat("%Y-%m-%d %H:%M:%S.%6f", TZ::UTC);
+ * std::vector<Timestamp> timestamps(rows.size());
+ * auto result = parse_fixed(rows, format, timestamps);
+ * @endcode
+ */
+class FixedFormat
+{
+public:
+    /**
+     * Most characters a string of a 'FixedFormat' can have.
+     */
+    static constexpr size_t MAX_WIDTH = 32;
+
+    /**
+     * Why parsing a string of a batch failed.
+     */
+    struct Error
+    {
+        /**
+         * Index of the first string that failed to parse.
+         */
+        size_t index;
+
+        /**
+         * Why, and where in the string, parsing it failed.
+         */
+        ParseError error;
+
+        /**
+         * Checks if 'index' and 'error' are equal to 'other's'.
+         *
+         * @param other 'Error' to compare against.
+         *
+         * @return 'true' if 'index' and 'error' are equal to 'other's', 'false' otherwise.
+         */
+        bool operator==(const Error& other) const = default;
+    };
+
+    /**
+     * Creates a 'FixedFormat' from the directives and characters of 'format'.
+     *
+     * @param format directives and characters of the strings.
+     * @param timezone 'Timezone' the strings are in. (default Time::get_default_timezone())
+     *
+     * @throws std::invalid_argument if 'format' has an unsupported or repeated directive, is
+     * missing '%Y', '%m', or '%d', or describes strings longer than 'MAX_WIDTH'.
+     */
+    explicit FixedFormat(std::string_view format,
+                         Timezone timezone = Time::get_default_timezone());
+
+    /**
+     * Gets the number of characters of every string of 'this'.
+     *
+     * @return the width of the strings.
+     */
+    size_t get_width() const
+    {
+        return width;
+    }
+
+    /**
+     * Gets the 'Timezone' the strings are in.
+     *
+     * @return the 'Timezone' of the strings.
+     */
+    Timezone get_timezone() const
+    {
+        return timezone;
+    }
+
+    /**
+     * Parses each string of 'strings' as 'format' describes, into 'out'.
+     *
+     * Checks and converts the digits of a whole string at once with AVX2 or SSE4.1 when the CPU
+     * supports them, and 8 characters at a time in 64 bit words otherwise. Does not allocate.
+     *
+     * @param strings strings to parse.
+     * @param format layout of 'strings'.
+     * @param out set to the 'Timestamp' of each of 'strings'.
+     *
+     * @return nothing if every string was parsed, otherwise the 'Error' of the first string that
+     * failed to. 'out' is set up to that string.
+     *
+     * @throws std::invalid_argument if 'out' and 'strings' are not the same size.
+     */
+    friend std::expected<void, Error> parse_fixed(std::span<const std::string_view> strings,
+                                                  const FixedFormat& format,
+                                                  std::span<Timestamp> out);
+
+private:
+    /**
+     * 0xFF for each character of the strings that must be a digit, 0 for the others.
+     */
+    alignas(MAX_WIDTH) std::array<uint8_t, MAX_WIDTH> digits{};
+
+    /**
+     * 0xFF for each character of the strings that must be 'literals', 0 for the others.
+     */
+    alignas(MAX_WIDTH) std::array<uint8_t, MAX_WIDTH> literal_mask{};
+
+    /**
+     * Character each character of the strings that is not a digit must be.
+     */
+    alignas(MAX_WIDTH) std::array<char, MAX_WIDTH> literals{};
+
+    /**
+     * Shuffles of the first and last 16 characters of the strings into the digit pairs of the
+     * fields, as 'sources' describes. Other characters have the top bit set, which shuffles in 0.
+     */
+    alignas(MAX_WIDTH) std::array<std::array<uint8_t, MAX_WIDTH>, 2> gathers{};
+
+    /**
+     * Shuffle of the last 16 characters of the strings that moves those after the first 16 down
+     * to follow them, so the kernels never read outside of a string.
+     */
+    alignas(16) std::array<uint8_t, 16> tail_shuffle{};
+
+    /**
+     * Index in the strings of each digit of the 16 pairs of digits of the fields, or 'MAX_WIDTH'
+     * if the digit is not in the strings.
+     *
+     * The pairs are the first and last 2 digits of the year, then the month, day, hour, minute
+     * and second, an unused pair, and 5 pairs of the fraction aligned to the right.
+     */
+    std::array<uint8_t, MAX_WIDTH> sources{};
+
+    /**
+     * Number of characters of every string.
+     */
+    uint8_t width = 0;
+
+    /**
+     * Number of digits of the fraction of the second, 0 if there is none.
+     */
+    uint8_t fraction_digits = 0;
+
+    /**
+     * Index of the first time directive, reported for invalid times.
+     */
+    uint8_t time_start = 0;
+
+    /**
+     * 'Timezone' the strings are in.
+     */
+    Timezone timezone;
+};
+
+#endif //DATETIME_FIXED_FORMAT_H
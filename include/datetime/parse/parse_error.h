@@ -0,0 +1,94 @@
+#ifndef DATETIME_PARSE_ERROR_H
+#define DATETIME_PARSE_ERROR_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+/**
+ * Why parsing a date or time string failed, and where.
+ *
+ * Kept to a code and an offset so failing to parse costs no more than succeeding. Call
+ * 'message' for a human readable description.
+ *
+ * @see Datetime::try_parse
+ */
+struct ParseError
+{
+    /**
+     * Kinds of parse failures.
+     */
+    enum class Code : uint8_t
+    {
+        /**
+         * A digit was expected at 'offset'.
+         */
+        EXPECTED_DIGIT,
+
+        /**
+         * A separator such as '-', ':', or '.' was expected at 'offset'.
+         */
+        EXPECTED_SEPARATOR,
+
+        /**
+         * The string ended at 'offset' before every requested component was read.
+         */
+        MISSING_COMPONENT,
+
+        /**
+         * The number starting at 'offset' has too many digits.
+         */
+        NUMBER_TOO_LONG,
+
+        /**
+         * The UTC offset starting at 'offset' has 60 or more minutes, or is more than
+         * 'Timezone::MAX_UTC_OFFSET_MINUTES' either way.
+         */
+        UNSUPPORTED_OFFSET,
+
+        /**
+         * Unexpected characters start at 'offset'.
+         */
+        TRAILING_CHARACTERS,
+
+        /**
+         * The date starting at 'offset' was read, but is not a valid date.
+         */
+        INVALID_DATE,
+
+        /**
+         * The time starting at 'offset' was read, but is not a valid time.
+         */
+        INVALID_TIME
+    };
+
+    /**
+     * Kind of failure.
+     */
+    Code code;
+
+    /**
+     * Index in the parsed string that the failure was found at.
+     */
+    uint32_t offset;
+
+    /**
+     * Creates a human readable description of this 'ParseError'.
+     *
+     * @param string the string whose parsing failed.
+     *
+     * @return description of this 'ParseError'.
+     */
+    std::string message(std::string_view string) const;
+
+    /**
+     * Checks if 'code' and 'offset' are equal to 'other's'.
+     *
+     * @param other 'ParseError' to compare against.
+     *
+     * @return 'true' if 'code' and 'offset' are equal to 'other's', 'false' otherwise.
+     */
+    constexpr bool operator==(const ParseError& other) const = default;
+};
+
+#endif //DATETIME_PARSE_ERROR_H
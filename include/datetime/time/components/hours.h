@@ -15,7 +15,7 @@ struct Hours : Component
      *
      * @param hour number of hours.
      */
-    explicit Hours(int64_t hour) :
+    explicit constexpr Hours(int64_t hour) :
         Component(hour) {}
 };
 
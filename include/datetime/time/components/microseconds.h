@@ -15,7 +15,7 @@ struct Microseconds : Component
      *
      * @param microsecond number of microseconds.
      */
-    explicit Microseconds(int64_t microsecond) :
+    explicit constexpr Microseconds(int64_t microsecond) :
         Component(microsecond) {}
 };
 
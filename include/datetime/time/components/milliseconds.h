@@ -15,7 +15,7 @@ struct Milliseconds : Component
      *
      * @param millisecond number of milliseconds.
      */
-    explicit Milliseconds(int64_t millisecond) :
+    explicit constexpr Milliseconds(int64_t millisecond) :
         Component(millisecond) {}
 };
 
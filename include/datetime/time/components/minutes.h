@@ -15,7 +15,7 @@ struct Minutes : Component
      *
      * @param minute number of minutes.
      */
-    explicit Minutes(int64_t minute) :
+    explicit constexpr Minutes(int64_t minute) :
         Component(minute) {}
 };
 
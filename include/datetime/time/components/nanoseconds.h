@@ -15,7 +15,7 @@ struct Nanoseconds : Component
      *
      * @param nanosecond number of nanoseconds.
      */
-    explicit Nanoseconds(int64_t nanosecond) :
+    explicit constexpr Nanoseconds(int64_t nanosecond) :
         Component(nanosecond) {}
 };
 
@@ -15,7 +15,7 @@ struct Seconds : Component
      *
      * @param second number of seconds.
      */
-    explicit Seconds(int64_t second) :
+    explicit constexpr Seconds(int64_t second) :
         Component(second) {}
 };
 
@@ -0,0 +1,46 @@
+#ifndef DATETIME_SCOPED_DEFAULT_TIMEZONE_H
+#define DATETIME_SCOPED_DEFAULT_TIMEZONE_H
+
+#include "datetime/time/time.h"
+#include <optional>
+
+/**
+ * Sets the calling thread's default 'Timezone' for as long as it is in scope, then restores the
+ * thread's previous default.
+ *
+ * 'Time', 'Date' and 'Datetime' objects created in the thread meanwhile take the 'Timezone'
+ * without arguments or locks, while other threads keep their own defaults. Scopes can be nested.
+ *
+ * @code
+ * // In a thread trading on Eurex
+ * ScopedDefaultTimezone eurex = ScopedDefaultTimezone(Timezone(-1));
+ * Datetime open = Datetime(2024, 1, 2, 8, 0);  // 08:00 CET
+ * @endcode
+ */
+class ScopedDefaultTimezone
+{
+public:
+    /**
+     * Sets the calling thread's default 'Timezone' to 'timezone'.
+     *
+     * @param timezone 'Timezone' to set the thread's default to.
+     */
+    explicit ScopedDefaultTimezone(Timezone timezone);
+
+    ScopedDefaultTimezone(const ScopedDefaultTimezone&) = delete;
+    ScopedDefaultTimezone& operator=(const ScopedDefaultTimezone&) = delete;
+
+    /**
+     * Restores the thread's default 'Timezone' from before construction. Must be destroyed in
+     * the thread that created it.
+     */
+    ~ScopedDefaultTimezone();
+
+private:
+    /**
+     * The thread's own default before construction, if it had one.
+     */
+    std::optional<Timezone> previous;
+};
+
+#endif //DATETIME_SCOPED_DEFAULT_TIMEZONE_H
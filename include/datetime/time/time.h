@@ -8,12 +8,22 @@
 #include "datetime/time/components/seconds.h"
 #include "datetime/time/components/microseconds.h"
 #include "datetime/time/components/nanoseconds.h"
+#include "datetime/clock/clock.h"
 #include "datetime/time/timezone.h"
 #include "datetime/time/components/milliseconds.h"
 #include "stringhelpers/stringhelpers.h"
 #include "../src/util/macros.h"
+#include "../../../src/util/arithmetic.h"
+#include "../../../src/util/parse.h"
 #include "../../../src/time/basic_time.h"
 #include "datetime/timedelta/timedelta.h"
+#include "datetime/parse/parse_error.h"
+#include "datetime/iota_view.h"
+#include "datetime/unchecked.h"
+#include <atomic>
+#include <concepts>
+#include <expected>
+#include <optional>
 
 
 /**
@@ -27,14 +37,34 @@ public:
     /**
      * 'Timezone' of the 'Time'.
      */
-    Timezone timezone = default_timezone;
+    Timezone timezone = get_default_timezone();
 
     /**
-     * Default 'Timezone' of all 'Time' objects.
+     * Gets the default 'Timezone' of newly created 'Time' objects in this thread.
      *
-     * All newly created 'Time' objects' 'timezone' will be set to this value.
+     * That is the thread's own default if it has one, and the process' default otherwise.
+     * Reading it takes no locks. Neither default can be read in a constant expression, so
+     * constructing a 'constexpr' or 'constinit' value needs an explicit 'Timezone', such as
+     * 'Datetime(2024, 1, 2, 9, 30, 0, 0, 0, 0, TZ::EST)'. Any other static is initialized at
+     * runtime with the real default.
+     *
+     * @return the default 'Timezone' of this thread.
+     *
+     * @see ScopedDefaultTimezone
      */
-    static Timezone default_timezone;
+    static constexpr Timezone get_default_timezone()
+    {
+        if consteval
+        {
+            return load_default_timezone();
+        }
+        else
+        {
+            if (thread_default_timezone.has_value())
+                return *thread_default_timezone;
+            return default_timezone.load(std::memory_order_relaxed);
+        }
+    }
 
     /**
      * Creates a 'Time' whose components match the values of 'hour', 'minute',
@@ -46,10 +76,24 @@ public:
      * @param millisecond millisecond the 'Time' will be set to. (default 0)
      * @param microsecond microsecond the 'Time' will be set to. (default 0)
      * @param nanosecond nanosecond the 'Time' will be set to. (default 0)
-     * @param timezone timezone the 'Time' will be set to. (default default_timezone)
+     * @param timezone timezone the 'Time' will be set to. (default get_default_timezone())
+     */
+    explicit constexpr Time(uint8_t hour = 0, uint8_t minute = 0, uint8_t second = 0,
+                            uint16_t millisecond = 0, uint16_t microsecond = 0,
+                            uint16_t nanosecond = 0, Timezone timezone = get_default_timezone());
+
+    /**
+     * Creates a 'Time' whose components match the values of 'hour', 'minute',
+     * 'second', 'millisecond', 'microsecond', 'nanosecond', and 'timezone', without checking
+     * that they are a valid time.
+     *
+     * @see Unchecked
      */
-    explicit Time(uint8_t hour = 0, uint8_t minute = 0, uint8_t second = 0, uint16_t millisecond = 0,
-                  uint16_t microsecond = 0, uint16_t nanosecond = 0, Timezone timezone = default_timezone);
+    constexpr Time(Unchecked, uint8_t hour, uint8_t minute, uint8_t second,
+                   uint16_t millisecond, uint16_t microsecond, uint16_t nanosecond,
+                   Timezone timezone) :
+        BasicTime(hour, minute, second, millisecond, microsecond, nanosecond),
+        timezone(timezone) {}
 
     /**
      * Creates a 'Time' from a std::string.
@@ -60,26 +104,48 @@ public:
      * @param time_components 'Components' that correspond to each number in 'string'.
      */
     template<typename... Component>
+        requires (std::same_as<Component, TimeComponent> && ...)
     explicit Time(std::string_view string, Component... time_components);
 
+    /**
+     * Parses a 'Time' from a string without throwing.
+     *
+     * 'TimeComponent::TIMEZONE' reads hours, then optionally ':' and 2 digits of minutes, as
+     * 'to_string' writes them. A '-' sign right before the hours, such as in "1:02+-5:30",
+     * makes the offset east of UTC. Offsets of more than 24 hours either way are not read.
+     *
+     * @tparam TimeComponents should be of type 'Component'.
+     *
+     * @param string string representation of the time.
+     * @param time_components 'Components' that correspond to each number in 'string'.
+     *
+     * @return the parsed 'Time', or a 'ParseError' describing why 'string' could not be parsed.
+     */
+    template<typename... Component>
+        requires (std::same_as<Component, TimeComponent> && ...)
+    static std::expected<Time, ParseError> try_parse(std::string_view string,
+                                                     Component... time_components);
+
     /**
      * Creates a 'Time' object from a 'TimeDelta'.
      *
      * @param time_delta 'TimeDelta' whose time components will used for 'Times' components.
-     * @param timezone timezone the 'Time' will be set to. (default default_timezone)
+     * @param timezone timezone the 'Time' will be set to. (default get_default_timezone())
      */
-    Time(TimeDelta& time_delta, Timezone timezone = default_timezone);
+    constexpr Time(TimeDelta& time_delta, Timezone timezone = get_default_timezone());
 
     /**
      * Creates a 'Time' whose components' values match the current time.
      *
+     * The time is read from 'Clock::now()'. The offsets are added to it, wrapping around midnight.
+     *
      * @param timezone 'Timezone' to set the current time to.
      *
      * @return created 'Time'.
      */
     static Time now(uint8_t hour_offset = 0, uint8_t minute_offset = 0, uint8_t second_offset = 0,
                     uint16_t millisecond_offset = 0, uint16_t microsecond_offset = 0, uint16_t
-                    nanosecond_offset = 0, Timezone timezone = default_timezone);
+                    nanosecond_offset = 0, Timezone timezone = get_default_timezone());
 
     /**
      * Creates a 'Time' object with the max values for 'hour', 'minute', 'second', 'millisecond',
@@ -87,7 +153,7 @@ public:
      *
      * @return 'Time' object with the max components.
      */
-    static Time max();
+    static constexpr Time max();
 
     /**
      * Gets the times within a range.
@@ -155,6 +221,108 @@ public:
      */
     static std::vector<Time> range(Time start, Time end, Nanoseconds increment = Nanoseconds(1));
 
+    /**
+     * Gets a lazy view of the times within a range.
+     *
+     * Unlike 'range', no times are stored: each one is computed when it is read.
+     *
+     * @param start starting time of the range.
+     * @param end ending time of the range. Included if it is a whole number of 'step' after
+     * 'start'.
+     * @param step hours between each time in the range. Must be positive.
+     *
+     * @return random access view of the times within 'start' to 'end'. Empty if 'end' is
+     * before 'start'.
+     *
+     * @throws std::invalid_argument if 'step' is not positive.
+     */
+    static constexpr IotaView<Time, Hours> iota(Time start, Time end, Hours step);
+
+    /**
+     * Gets a lazy view of the times within a range.
+     *
+     * Unlike 'range', no times are stored: each one is computed when it is read.
+     *
+     * @param start starting time of the range.
+     * @param end ending time of the range. Included if it is a whole number of 'step' after
+     * 'start'.
+     * @param step minutes between each time in the range. Must be positive.
+     *
+     * @return random access view of the times within 'start' to 'end'. Empty if 'end' is
+     * before 'start'.
+     *
+     * @throws std::invalid_argument if 'step' is not positive.
+     */
+    static constexpr IotaView<Time, Minutes> iota(Time start, Time end, Minutes step);
+
+    /**
+     * Gets a lazy view of the times within a range.
+     *
+     * Unlike 'range', no times are stored: each one is computed when it is read.
+     *
+     * @param start starting time of the range.
+     * @param end ending time of the range. Included if it is a whole number of 'step' after
+     * 'start'.
+     * @param step seconds between each time in the range. Must be positive.
+     *
+     * @return random access view of the times within 'start' to 'end'. Empty if 'end' is
+     * before 'start'.
+     *
+     * @throws std::invalid_argument if 'step' is not positive.
+     */
+    static constexpr IotaView<Time, Seconds> iota(Time start, Time end, Seconds step);
+
+    /**
+     * Gets a lazy view of the times within a range.
+     *
+     * Unlike 'range', no times are stored: each one is computed when it is read.
+     *
+     * @param start starting time of the range.
+     * @param end ending time of the range. Included if it is a whole number of 'step' after
+     * 'start'.
+     * @param step milliseconds between each time in the range. Must be positive.
+     *
+     * @return random access view of the times within 'start' to 'end'. Empty if 'end' is
+     * before 'start'.
+     *
+     * @throws std::invalid_argument if 'step' is not positive.
+     */
+    static constexpr IotaView<Time, Milliseconds> iota(Time start, Time end, Milliseconds step);
+
+    /**
+     * Gets a lazy view of the times within a range.
+     *
+     * Unlike 'range', no times are stored: each one is computed when it is read.
+     *
+     * @param start starting time of the range.
+     * @param end ending time of the range. Included if it is a whole number of 'step' after
+     * 'start'.
+     * @param step microseconds between each time in the range. Must be positive.
+     *
+     * @return random access view of the times within 'start' to 'end'. Empty if 'end' is
+     * before 'start'.
+     *
+     * @throws std::invalid_argument if 'step' is not positive.
+     */
+    static constexpr IotaView<Time, Microseconds> iota(Time start, Time end, Microseconds step);
+
+    /**
+     * Gets a lazy view of the times within a range.
+     *
+     * Unlike 'range', no times are stored: each one is computed when it is read.
+     *
+     * @param start starting time of the range.
+     * @param end ending time of the range. Included if it is a whole number of 'step' after
+     * 'start'.
+     * @param step nanoseconds between each time in the range. Must be positive.
+     *
+     * @return random access view of the times within 'start' to 'end'. Empty if 'end' is
+     * before 'start'.
+     *
+     * @throws std::invalid_argument if 'step' is not positive.
+     */
+    static constexpr IotaView<Time, Nanoseconds> iota(Time start, Time end, Nanoseconds step);
+
     /**
      * Represents this 'Datetime' as a std::string.
      *
@@ -173,11 +341,41 @@ public:
      *
      * @return resulting std::string.
      */
-    virtual std::string to_string(TimeComponent include_to = TimeComponent::TIMEZONE,
+    std::string to_string(TimeComponent include_to = TimeComponent::TIMEZONE,
+                          char delim_h_m_s = ':',
+                          char delim_ms_us_na = '.',
+                          char delim_tz = '+') const;
+
+    /**
+     * Writes the 'to_string' representation of this 'Time' into '[first, last)', without
+     * allocating.
+     *
+     * @param first start of the buffer to write into.
+     * @param last one past the end of the buffer to write into.
+     * @param include_to Include the time components up until 'include_to' in the resulting
+     * string (inclusive). (default TimeComponent::TIMEZONE)
+     * @param delim_h_m_s 'char' separating hours, minutes, and seconds.
+     * @param delim_ms_us_ns 'char' separating milliseconds, microseconds, and nanoseconds.
+     * @param delim_tz delimiter between nanosecond and timezone.
+     *
+     * @example
+     * char buffer[Time::MAX_CHARS];
+     * std::to_chars_result result = time.to_chars(buffer, buffer + Time::MAX_CHARS);
+     *
+     * @return one past the last character written, or 'last' with
+     * 'std::errc::value_too_large' if the buffer is too small.
+     */
+    std::to_chars_result to_chars(char* first, char* last,
+                                  TimeComponent include_to = TimeComponent::TIMEZONE,
                                   char delim_h_m_s = ':',
                                   char delim_ms_us_na = '.',
                                   char delim_tz = '+') const;
 
+    /**
+     * Most characters 'to_chars' can write.
+     */
+    static constexpr size_t MAX_CHARS = BasicTime::MAX_CHARS + 1 + Timezone::MAX_CHARS;
+
     /**
      * Adds 'time' and 'other'.
      *
@@ -186,7 +384,7 @@ public:
      *
      * @return 'TimeDelta' of 'time' and 'other' added. Accounts for day changes.
      */
-    friend TimeDelta operator+(Time time, Time other);
+    friend constexpr TimeDelta operator+(Time time, Time other);
 
     /**
      * Subtracts 'other' from 'time'.
@@ -196,7 +394,7 @@ public:
      *
      * @return 'TimeDelta' of 'other' subtracted from 'this'. Accounts for day changes.
      */
-    friend TimeDelta operator-(Time time, Time other);
+    friend constexpr TimeDelta operator-(Time time, Time other);
 
     /**
      * Adds 'hours' to this 'Time'.
@@ -205,7 +403,7 @@ public:
      *
      * @return reference to this modified 'Time'.
      */
-    virtual Time& operator+=(const Hours& hours);
+    constexpr Time& operator+=(const Hours& hours);
 
     /**
      * Subtracts 'hours' from this 'Time'.
@@ -214,7 +412,7 @@ public:
      *
      * @return reference to this modified 'Time'.
      */
-    virtual Time& operator-=(const Hours& hours);
+    constexpr Time& operator-=(const Hours& hours);
 
     /**
      * Adds 'minutes' to this 'Time'.
@@ -223,7 +421,7 @@ public:
      *
      * @return reference to this modified 'Time'.
      */
-    virtual Time& operator+=(const Minutes& minutes);
+    constexpr Time& operator+=(const Minutes& minutes);
 
     /**
      * Subtracts 'minutes' from this 'Time'.
@@ -232,7 +430,7 @@ public:
      *
      * @return reference to this modified 'Time'.
      */
-    virtual Time& operator-=(const Minutes& minutes);
+    constexpr Time& operator-=(const Minutes& minutes);
 
     /**
      * Adds 'seconds' to this 'Time'.
@@ -241,7 +439,7 @@ public:
      *
      * @return reference to this modified 'Time'.
      */
-    virtual Time& operator+=(const Seconds& seconds);
+    constexpr Time& operator+=(const Seconds& seconds);
 
     /**
      * Subtracts 'seconds' from this 'Time'.
@@ -250,7 +448,7 @@ public:
      *
      * @return reference to this modified 'Time'.
      */
-    virtual Time& operator-=(const Seconds& seconds);
+    constexpr Time& operator-=(const Seconds& seconds);
 
     /**
      * Adds 'milliseconds' to this 'Time'.
@@ -259,7 +457,7 @@ public:
      *
      * @return reference to this modified 'Time'.
      */
-    virtual Time& operator+=(const Milliseconds& milliseconds);
+    constexpr Time& operator+=(const Milliseconds& milliseconds);
 
     /**
      * Subtracts 'milliseconds' from this 'Time'.
@@ -268,7 +466,7 @@ public:
      *
      * @return reference to this modified 'Time'.
      */
-    virtual Time& operator-=(const Milliseconds& milliseconds);
+    constexpr Time& operator-=(const Milliseconds& milliseconds);
 
     /**
       * Adds 'microseconds' to this 'Time'.
@@ -277,7 +475,7 @@ public:
       *
       * @return reference to this modified 'Time'.
       */
-    virtual Time& operator+=(const Microseconds& microseconds);
+    constexpr Time& operator+=(const Microseconds& microseconds);
 
     /**
      * Subtracts 'microseconds' from this 'Time'.
@@ -286,7 +484,7 @@ public:
      *
      * @return reference to this modified 'Time'.
      */
-    virtual Time& operator-=(const Microseconds& microseconds);
+    constexpr Time& operator-=(const Microseconds& microseconds);
 
     /**
      * Adds 'nanoseconds' to this 'Time'.
@@ -295,7 +493,7 @@ public:
      *
      * @return reference to this modified 'Time'.
      */
-    virtual Time& operator+=(const Nanoseconds& nanoseconds);
+    constexpr Time& operator+=(const Nanoseconds& nanoseconds);
 
     /**
      * Subtracts 'nanoseconds' from this 'Time'.
@@ -304,7 +502,7 @@ public:
      *
      * @return reference to this modified 'Time'.
      */
-    virtual Time& operator-=(const Nanoseconds& nanoseconds);
+    constexpr Time& operator-=(const Nanoseconds& nanoseconds);
 
     /**
      * Checks if 'this' is greater than 'other'.
@@ -313,7 +511,7 @@ public:
      *
      * @return 'true' if 'this' is greater than 'other', 'false' otherwise.
      */
-    bool operator>(Time other) const;
+    constexpr bool operator>(Time other) const;
 
     /**
      * Checks if 'this' is greater than or equal to 'other'.
@@ -322,7 +520,7 @@ public:
      *
      * @return 'true' if 'this' is greater than or equal to 'other', 'false' otherwise.
      */
-    bool operator>=(Time other) const;
+    constexpr bool operator>=(Time other) const;
 
     /**
      * Checks if 'this' is less than 'other'.
@@ -331,7 +529,7 @@ public:
      *
      * @return 'true' if 'this' is less than 'other', 'false' otherwise.
      */
-    bool operator<(Time other) const;
+    constexpr bool operator<(Time other) const;
 
     /**
      * Checks if 'this' is less than or equal to 'other'.
@@ -340,7 +538,7 @@ public:
      *
      * @return 'true' if 'this' is less than or equal to 'other', 'false' otherwise.
      */
-    bool operator<=(Time other) const;
+    constexpr bool operator<=(Time other) const;
 
     /**
      * Checks if 'this' is equal to 'other'.
@@ -349,7 +547,7 @@ public:
      *
      * @return 'true' if 'this' is equal to 'other', 'false' otherwise.
      */
-    bool operator==(Time other) const;
+    constexpr bool operator==(Time other) const;
 
     /**
      * Checks if 'this' is not equal to 'other'.
@@ -358,7 +556,7 @@ public:
      *
      * @return 'true' if 'this' is not equal to 'other', 'false' otherwise.
      */
-    bool operator!=(Time other) const;
+    constexpr bool operator!=(Time other) const;
 
     /**
      * Adds 'hours' to 'time'.
@@ -368,7 +566,7 @@ public:
      *
      * @return a new 'Time' with 'hours' added.
      */
-    friend Time operator+(Time time, const Hours& hours);
+    friend constexpr Time operator+(Time time, const Hours& hours);
 
     /**
      * Subtracts 'hours' from 'time'.
@@ -378,7 +576,7 @@ public:
      *
      * @return a new 'Time' with 'hours' subtracted.
      */
-    friend Time operator-(Time time, const Hours& hours);
+    friend constexpr Time operator-(Time time, const Hours& hours);
 
     /**
      * Adds 'minutes' to 'time'.
@@ -388,7 +586,7 @@ public:
      *
      * @return a new 'Time' with 'minutes' added.
      */
-    friend Time operator+(Time time, const Minutes& minutes);
+    friend constexpr Time operator+(Time time, const Minutes& minutes);
 
     /**
      * Subtracts 'minutes' from 'time'.
@@ -398,7 +596,7 @@ public:
      *
      * @return a new 'Time' with 'minutes' subtracted.
      */
-    friend Time operator-(Time time, const Minutes& minutes);
+    friend constexpr Time operator-(Time time, const Minutes& minutes);
 
     /**
      * Adds 'seconds' to 'time'.
@@ -408,7 +606,7 @@ public:
      *
      * @return a new 'Time' with 'seconds' added.
      */
-    friend Time operator+(Time time, const Seconds& seconds);
+    friend constexpr Time operator+(Time time, const Seconds& seconds);
 
     /**
      * Subtracts 'seconds' from 'time'.
@@ -418,7 +616,7 @@ public:
      *
      * @return a new 'Time' with 'seconds' subtracted.
      */
-    friend Time operator-(Time time, const Seconds& seconds);
+    friend constexpr Time operator-(Time time, const Seconds& seconds);
 
     /**
      * Adds 'milliseconds' to 'time'.
@@ -428,7 +626,7 @@ public:
      *
      * @return a new 'Time' with 'milliseconds' added.
      */
-    friend Time operator+(Time time, const Milliseconds& milliseconds);
+    friend constexpr Time operator+(Time time, const Milliseconds& milliseconds);
 
     /**
      * Subtracts 'milliseconds' from 'time'.
@@ -438,7 +636,7 @@ public:
      *
      * @return a new 'Time' with 'milliseconds' subtracted.
      */
-    friend Time operator-(Time time, const Milliseconds& milliseconds);
+    friend constexpr Time operator-(Time time, const Milliseconds& milliseconds);
 
     /**
     * Adds 'microseconds' to 'time'.
@@ -448,7 +646,7 @@ public:
     *
     * @return a new 'Time' with 'microseconds' added.
     */
-    friend Time operator+(Time time, const Microseconds& microseconds);
+    friend constexpr Time operator+(Time time, const Microseconds& microseconds);
 
     /**
      * Subtracts 'microseconds' from 'time'.
@@ -458,7 +656,7 @@ public:
      *
      * @return a new 'Time' with 'microseconds' subtracted.
      */
-    friend Time operator-(Time time, const Microseconds& microseconds);
+    friend constexpr Time operator-(Time time, const Microseconds& microseconds);
 
     /**
      * Adds 'nanoseconds' to 'time'.
@@ -468,7 +666,7 @@ public:
      *
      * @return a new 'Time' with 'nanoseconds' added.
      */
-    friend Time operator+(Time time, const Nanoseconds& nanoseconds);
+    friend constexpr Time operator+(Time time, const Nanoseconds& nanoseconds);
 
     /**
      * Subtracts 'nanoseconds' from 'time'.
@@ -478,22 +676,41 @@ public:
      *
      * @return a new 'Time' with 'nanoseconds' subtracted.
      */
-    friend Time operator-(Time time, const Nanoseconds& nanoseconds);
+    friend constexpr Time operator-(Time time, const Nanoseconds& nanoseconds);
 
     /**
      * Sets the 'timezone' of this 'Time'.
      *
      * @param new_timezone 'Timezone' to set 'timezone' to.
      */
-    void set_timezone(Timezone new_timezone);
+    constexpr void set_timezone(Timezone new_timezone);
 
     /**
-     * Sets 'default_timezone' of the 'Time' class.
+     * Sets the default 'Timezone' of the process, used by every thread without a default of its
+     * own. Safe to call while other threads create 'Time' objects.
      *
-     * @param timezone 'Timezone' to set 'default_timezone' to.
+     * @param timezone 'Timezone' to set the process' default to.
      */
     static void set_default_timezone(Timezone timezone);
 
+    /**
+     * Gets this thread's own default 'Timezone'.
+     *
+     * @return the thread's default, or 'std::nullopt' if it uses the process' default.
+     */
+    static std::optional<Timezone> get_thread_default_timezone();
+
+    /**
+     * Sets this thread's own default 'Timezone', used instead of the process' default by
+     * 'Time' objects created in this thread. Other threads are not affected.
+     *
+     * @param timezone 'Timezone' to set the thread's default to, or 'std::nullopt' to use the
+     * process' default again.
+     *
+     * @see ScopedDefaultTimezone
+     */
+    static void set_thread_default_timezone(std::optional<Timezone> timezone);
+
     /**
      * Rounds the components of this 'Time', stopping at 'to'.
      *
@@ -506,21 +723,21 @@ public:
      *
      * // output: 1:03:00.0.0.0
      */
-    virtual Time& round(TimeComponent to);
+    constexpr Time& round(TimeComponent to);
 
     /**
      * Rounds up the components of this 'Time', stopping at 'to'.
      *
      * @param to finish the rounding up of this 'Time's' components at this 'Component'.
      */
-    virtual Time& ceil(TimeComponent to);
+    constexpr Time& ceil(TimeComponent to);
 
     /**
      * Rounds down the components of this 'Time', stopping at 'to'.
      *
      * @param to finish the rounding down of this 'Time's' components at this 'Component'.
      */
-    virtual Time& floor(TimeComponent to);
+    constexpr Time& floor(TimeComponent to);
 
     /**
      * Outputs 'time' into 'os'.
@@ -532,6 +749,28 @@ public:
      */
     friend std::ostream& operator<<(std::ostream& os, const Time& time);
 
+private:
+    /**
+     * Gets the default 'Timezone' of this thread without being 'constexpr', so that calling it
+     * stops 'get_default_timezone' from being evaluated at compile time.
+     *
+     * @return the default 'Timezone' of this thread.
+     */
+    static Timezone load_default_timezone();
+
+    /**
+     * Default 'Timezone' of the process.
+     */
+    static inline constinit std::atomic<Timezone> default_timezone = TZ::EST;
+
+    /**
+     * Default 'Timezone' of the thread, if it has its own. 'constinit' so reading it needs no
+     * check that it has been initialized.
+     */
+    static inline constinit thread_local std::optional<Timezone> thread_default_timezone;
+
+    static_assert(std::atomic<Timezone>::is_always_lock_free);
+
 protected:
 
     /**
@@ -541,65 +780,132 @@ protected:
      *
      * @return the number of days changed by the hours added.
      */
-    virtual int64_t add_hours(int64_t hours_to_add);
+    constexpr int64_t add_hours(int64_t hours_to_add);
 
     /**
      * Adds minutes to this 'Time'.
      *
      * @param minutes_to_add number of minutes to add.
+     *
+     * @return the number of days changed by the minutes added.
      */
-    virtual void add_minutes(int64_t minutes_to_add);
+    constexpr int64_t add_minutes(int64_t minutes_to_add);
 
     /**
      * Adds seconds to this 'Time'.
      *
      * @param seconds_to_add number of seconds to add.
+     *
+     * @return the number of days changed by the seconds added.
      */
-    virtual void add_seconds(int64_t seconds_to_add);
+    constexpr int64_t add_seconds(int64_t seconds_to_add);
 
     /**
       * Adds milliseconds to this 'Time'.
       *
       * @param milliseconds_to_add number of milliseconds to add.
+      *
+      * @return the number of days changed by the milliseconds added.
       */
-    virtual void add_milliseconds(int64_t milliseconds_to_add);
+    constexpr int64_t add_milliseconds(int64_t milliseconds_to_add);
 
     /**
       * Adds microseconds to this 'Time'.
       *
       * @param microseconds_to_add number of microseconds to add.
+      *
+      * @return the number of days changed by the microseconds added.
       */
-    virtual void add_microseconds(int64_t microseconds_to_add);
+    constexpr int64_t add_microseconds(int64_t microseconds_to_add);
 
     /**
       * Adds nanoseconds to this 'Time'.
       *
       * @param nanoseconds_to_add number of nanoseconds to add.
+      *
+      * @return the number of days changed by the nanoseconds added.
       */
-    virtual void add_nanoseconds(int64_t nanoseconds_to_add);
+    constexpr int64_t add_nanoseconds(int64_t nanoseconds_to_add);
+
+    /**
+     * Rounds the components of this 'Time', stopping at 'to'.
+     *
+     * @param to finish the rounding of this 'Time's' components at this 'Component'.
+     *
+     * @return the number of days changed by the rounding.
+     */
+    constexpr int64_t round_components(TimeComponent to);
+
+    /**
+     * Rounds up the components of this 'Time', stopping at 'to'.
+     *
+     * @param to finish the rounding up of this 'Time's' components at this 'Component'.
+     *
+     * @return the number of days changed by the rounding.
+     */
+    constexpr int64_t ceil_components(TimeComponent to);
+
+    /**
+     * Checks if this 'Time's' components are all valid.
+     *
+     * @return 'true' if all this 'Time's' components are all valid, 'false' otherwise.
+     */
+    constexpr bool is_valid_time() const;
 
 private:
 
     /**
-     * Gets the times within a range.
+     * Gets a lazy view of the times from 'start' to 'end', 'step' apart.
+     *
+     * @tparam NanosecondsPerUnit nanoseconds in one unit of 'Step'.
+     * @tparam Step component 'step' is counted in.
      *
      * @param start starting time of the range.
      * @param end ending time of the range.
-     * @param increment function which increments the current time during the loop getting each
-     * consecutive time between 'start' and 'end'.
+     * @param step distance between each time in the range.
      *
-     * @return range of times within 'start' to 'end'.
+     * @return view of the times within 'start' to 'end'.
      */
-    template<typename Func>
-    requires std::is_invocable_v<Func, Time&>
-    static std::vector<Time> range(Time& start, Time& end, Func increment);
+    template<int64_t NanosecondsPerUnit, typename Step>
+    static constexpr IotaView<Time, Step> iota_in_units(Time start, Time end, Step step);
 
     /**
-     * Checks if this 'Time's' components are all valid.
+     * Adds 'units_to_add' units of 'NanosecondsPerUnit' nanoseconds each to this 'Time'.
      *
-     * @return 'true' if all this 'Time's' components are all valid, 'false' otherwise.
+     * Whole days are split off before the remaining units are added to the nanoseconds of the
+     * day, so large values of 'units_to_add' do not overflow.
+     *
+     * @tparam NanosecondsPerUnit nanoseconds in one unit.
+     *
+     * @param units_to_add number of units to add.
+     *
+     * @return the number of days changed by the units added.
      */
-    bool is_valid_time() const;
+    template<int64_t NanosecondsPerUnit>
+    constexpr int64_t add_units(int64_t units_to_add);
+
+    /**
+     * Sets this 'Time's' components from the nanoseconds since midnight.
+     *
+     * 'nanoseconds' may be negative or exceed a day, in which case it is wrapped into the day.
+     *
+     * @param nanoseconds nanoseconds since midnight to set this 'Time' to.
+     *
+     * @return the number of days 'nanoseconds' is outside of the day.
+     */
+    constexpr int64_t set_total_nanoseconds(int64_t nanoseconds);
+
+    /**
+     * Gets the nanoseconds in one 'component'.
+     *
+     * 'TimeComponent::TIMEZONE' is treated as 'TimeComponent::HOUR'.
+     *
+     * @param component 'TimeComponent' to get the nanoseconds of.
+     *
+     * @return nanoseconds in one 'component'.
+     */
+    static constexpr int64_t nanoseconds_per(TimeComponent component);
+
 
     /**
      * Checks if 'hour' is valid.
@@ -608,7 +914,7 @@ private:
      *
      * @return 'true' is 'month' is valid, 'false' otherwise.
      */
-    bool is_valid_hour() const;
+    constexpr bool is_valid_hour() const;
 
     /**
      * Checks if 'minute' is valid.
@@ -617,7 +923,7 @@ private:
      *
      * @return 'true' is 'month' is valid, 'false' otherwise.
      */
-    bool is_valid_minute() const;
+    constexpr bool is_valid_minute() const;
 
 
     /**
@@ -627,7 +933,7 @@ private:
      *
      * @return 'true' is 'month' is valid, 'false' otherwise.
      */
-    bool is_valid_second() const;
+    constexpr bool is_valid_second() const;
 
     /**
      * Checks if 'millisecond' is valid.
@@ -636,7 +942,7 @@ private:
      *
      * @return 'true' is 'month' is valid, 'false' otherwise.
      */
-    bool is_valid_millisecond() const;
+    constexpr bool is_valid_millisecond() const;
 
     /**
      * Checks if 'microsecond' is valid.
@@ -645,7 +951,7 @@ private:
      *
      * @return 'true' is 'month' is valid, 'false' otherwise.
      */
-    bool is_valid_microsecond() const;
+    constexpr bool is_valid_microsecond() const;
 
     /**
      * Checks if 'hour' is valid.
@@ -654,65 +960,543 @@ private:
      *
      * @return 'true' is 'nanosecond' is valid, 'false' otherwise.
      */
-    bool is_valid_nanosecond() const;
+    constexpr bool is_valid_nanosecond() const;
 };
 
-template<typename... Component>
-Time::Time(std::string_view string, Component... time_components)
+static_assert(sizeof(Time) == 12);
+static_assert(std::is_trivially_copyable_v<Time>);
+
+constexpr Time::Time(uint8_t hour, uint8_t minute, uint8_t second, uint16_t millisecond,
+                     uint16_t microsecond, uint16_t nanosecond, Timezone timezone) :
+    BasicTime(hour, minute, second, millisecond, microsecond, nanosecond),
+    timezone(timezone)
+{
+    ASSERT(is_valid_time(),
+           std::invalid_argument(fmt::format("Time '{}' is invalid", Time::to_string())));
+}
+
+constexpr Time::Time(TimeDelta& time_delta, Timezone timezone) :
+    BasicTime(time_delta.hour, time_delta.minute, time_delta.second, time_delta.millisecond,
+              time_delta.microsecond, time_delta.nanosecond), timezone(timezone) {}
+
+constexpr Time& Time::operator+=(const Hours& hours)
+{
+    add_hours(hours.value);
+    return *this;
+}
+
+constexpr Time& Time::operator-=(const Hours& hours)
 {
-    std::vector<std::string> time_components_strs = strh::split_alphabetical(string);
+    add_hours(-hours.value);
+    return *this;
+}
+
+constexpr Time& Time::operator+=(const Minutes& minutes)
+{
+    add_minutes(minutes.value);
+    return *this;
+}
+
+constexpr Time& Time::operator-=(const Minutes& minutes)
+{
+    add_minutes(-minutes.value);
+    return *this;
+}
+
+constexpr Time& Time::operator+=(const Seconds& seconds)
+{
+    add_seconds(seconds.value);
+    return *this;
+}
 
-    ASSERT(time_components_strs.size() >= sizeof...(time_components),
-           std::invalid_argument(fmt::format("components with size '{}' does not match date "
-                                             "strings: '{}' with size '{}'",
-                                             sizeof...(time_components),
-                                             fmt::join(time_components_strs, ", "),
-                                             time_components_strs.size())));
+constexpr Time& Time::operator-=(const Seconds& seconds)
+{
+    add_seconds(-seconds.value);
+    return *this;
+}
 
-    size_t idx = 0;
+constexpr Time& Time::operator+=(const Milliseconds& milliseconds)
+{
+    add_milliseconds(milliseconds.value);
+    return *this;
+}
+
+constexpr Time& Time::operator-=(const Milliseconds& milliseconds)
+{
+    add_milliseconds(-milliseconds.value);
+    return *this;
+}
+
+constexpr Time& Time::operator+=(const Microseconds& microseconds)
+{
+    add_microseconds(microseconds.value);
+    return *this;
+}
+
+constexpr Time& Time::operator-=(const Microseconds& microseconds)
+{
+    add_microseconds(-microseconds.value);
+    return *this;
+}
+
+constexpr Time& Time::operator+=(const Nanoseconds& nanoseconds)
+{
+    add_nanoseconds(nanoseconds.value);
+    return *this;
+}
+
+constexpr Time& Time::operator-=(const Nanoseconds& nanoseconds)
+{
+    add_nanoseconds(-nanoseconds.value);
+    return *this;
+}
+
+constexpr Time operator+(Time time, const Hours& hours)
+{
+    time += hours;
+    return time;
+}
+
+constexpr Time operator-(Time time, const Hours& hours)
+{
+    time -= hours;
+    return time;
+}
+
+constexpr Time operator+(Time time, const Minutes& minutes)
+{
+    time += minutes;
+    return time;
+}
+
+constexpr Time operator-(Time time, const Minutes& minutes)
+{
+    time -= minutes;
+    return time;
+}
+
+constexpr Time operator+(Time time, const Seconds& seconds)
+{
+    time += seconds;
+    return time;
+}
+
+constexpr Time operator-(Time time, const Seconds& seconds)
+{
+    time -= seconds;
+    return time;
+}
+
+constexpr Time operator+(Time time, const Milliseconds& milliseconds)
+{
+    time += milliseconds;
+    return time;
+}
+
+constexpr Time operator-(Time time, const Milliseconds& milliseconds)
+{
+    time -= milliseconds;
+    return time;
+}
+
+constexpr Time operator+(Time time, const Microseconds& microseconds)
+{
+    time += microseconds;
+    return time;
+}
+
+constexpr Time operator-(Time time, const Microseconds& microseconds)
+{
+    time -= microseconds;
+    return time;
+}
+
+constexpr Time operator+(Time time, const Nanoseconds& nanoseconds)
+{
+    time += nanoseconds;
+    return time;
+}
+
+constexpr Time operator-(Time time, const Nanoseconds& nanoseconds)
+{
+    time -= nanoseconds;
+    return time;
+}
+
+constexpr TimeDelta operator+(Time time, Time other)
+{
+    other.set_timezone(time.timezone);
+
+    int64_t day_change = time.add_nanoseconds(other.total_nanoseconds());
+
+    return TimeDelta(day_change, time.hour, time.minute, time.second, time.millisecond,
+                     time.microsecond, time.nanosecond);
+}
+
+constexpr TimeDelta operator-(Time time, Time other)
+{
+    other.set_timezone(time.timezone);
+
+    int64_t day_change = time.add_nanoseconds(-other.total_nanoseconds());
+
+    return TimeDelta(day_change, time.hour, time.minute, time.second, time.millisecond,
+                     time.microsecond, time.nanosecond);
+}
+
+constexpr IotaView<Time, Hours> Time::iota(Time start, Time end, Hours step)
+{
+    return iota_in_units<NANOSECONDS_PER_HOUR>(start, end, step);
+}
+
+constexpr IotaView<Time, Minutes> Time::iota(Time start, Time end, Minutes step)
+{
+    return iota_in_units<NANOSECONDS_PER_MINUTE>(start, end, step);
+}
+
+constexpr IotaView<Time, Seconds> Time::iota(Time start, Time end, Seconds step)
+{
+    return iota_in_units<NANOSECONDS_PER_SECOND>(start, end, step);
+}
+
+constexpr IotaView<Time, Milliseconds> Time::iota(Time start, Time end, Milliseconds step)
+{
+    return iota_in_units<NANOSECONDS_PER_MILLISECOND>(start, end, step);
+}
+
+constexpr IotaView<Time, Microseconds> Time::iota(Time start, Time end, Microseconds step)
+{
+    return iota_in_units<NANOSECONDS_PER_MICROSECOND>(start, end, step);
+}
+
+constexpr IotaView<Time, Nanoseconds> Time::iota(Time start, Time end, Nanoseconds step)
+{
+    return iota_in_units<1>(start, end, step);
+}
+
+template<int64_t NanosecondsPerUnit, typename Step>
+constexpr IotaView<Time, Step> Time::iota_in_units(Time start, Time end, Step step)
+{
+    end.set_timezone(start.timezone);
+
+    int64_t nanoseconds_to_end = end.total_nanoseconds() - start.total_nanoseconds();
+    return IotaView<Time, Step>(start,
+                                arithmetic::floor_div(nanoseconds_to_end, NanosecondsPerUnit),
+                                step);
+}
+
+constexpr bool Time::operator>(Time other) const
+{
+    other.set_timezone(timezone);
+    return BasicTime::operator>(other);
+}
+
+constexpr bool Time::operator>=(Time other) const
+{
+    other.set_timezone(timezone);
+    return BasicTime::operator>=(other);
+}
+
+constexpr bool Time::operator==(Time other) const
+{
+    other.set_timezone(timezone);
+    return BasicTime::operator==(other);
+}
+
+constexpr bool Time::operator!=(Time other) const
+{
+    other.set_timezone(timezone);
+    return BasicTime::operator!=(other);
+}
+
+constexpr bool Time::operator<=(Time other) const
+{
+    other.set_timezone(timezone);
+    return BasicTime::operator<=(other);
+}
+
+constexpr bool Time::operator<(Time other) const
+{
+    other.set_timezone(timezone);
+    return BasicTime::operator<(other);
+}
+
+template<int64_t NanosecondsPerUnit>
+constexpr int64_t Time::add_units(int64_t units_to_add)
+{
+    constexpr int64_t units_per_day = NANOSECONDS_PER_DAY / NanosecondsPerUnit;
+
+    return units_to_add / units_per_day
+           + set_total_nanoseconds(BasicTime::total_nanoseconds()
+                                   + units_to_add % units_per_day * NanosecondsPerUnit);
+}
+
+constexpr int64_t Time::add_hours(int64_t hours_to_add)
+{
+    return add_units<NANOSECONDS_PER_HOUR>(hours_to_add);
+}
+
+constexpr int64_t Time::add_minutes(int64_t minutes_to_add)
+{
+    return add_units<NANOSECONDS_PER_MINUTE>(minutes_to_add);
+}
+
+constexpr int64_t Time::add_seconds(int64_t seconds_to_add)
+{
+    return add_units<NANOSECONDS_PER_SECOND>(seconds_to_add);
+}
+
+constexpr int64_t Time::add_milliseconds(int64_t milliseconds_to_add)
+{
+    return add_units<NANOSECONDS_PER_MILLISECOND>(milliseconds_to_add);
+}
+
+constexpr int64_t Time::add_microseconds(int64_t microseconds_to_add)
+{
+    return add_units<NANOSECONDS_PER_MICROSECOND>(microseconds_to_add);
+}
+
+constexpr int64_t Time::add_nanoseconds(int64_t nanoseconds_to_add)
+{
+    return add_units<1>(nanoseconds_to_add);
+}
+
+constexpr int64_t Time::set_total_nanoseconds(int64_t nanoseconds)
+{
+    int64_t day_change = nanoseconds / NANOSECONDS_PER_DAY;
+    nanoseconds %= NANOSECONDS_PER_DAY;
+    if (nanoseconds < 0)
+    {
+        nanoseconds += NANOSECONDS_PER_DAY;
+        day_change--;
+    }
+
+    // Peel off one component at a time, each division being by a small constant.
+    uint64_t remaining = nanoseconds;
+    nanosecond = remaining % NANOSECONDS_PER_MICROSECOND;
+    remaining /= NANOSECONDS_PER_MICROSECOND;
+    microsecond = remaining % MICROSECONDS_PER_MILLISECOND;
+    remaining /= MICROSECONDS_PER_MILLISECOND;
+    millisecond = remaining % MILLISECONDS_PER_SECOND;
+    remaining /= MILLISECONDS_PER_SECOND;
+    second = remaining % SECONDS_PER_MINUTE;
+    remaining /= SECONDS_PER_MINUTE;
+    minute = remaining % MINUTES_PER_HOUR;
+    hour = remaining / MINUTES_PER_HOUR;
+
+    return day_change;
+}
+
+constexpr void Time::set_timezone(Timezone new_timezone)
+{
+    (*this) += timezone.get_utc_offset_diff(new_timezone);
+    timezone = new_timezone;
+}
+
+constexpr Time& Time::round(TimeComponent to)
+{
+    round_components(to);
+    return *this;
+}
+
+constexpr Time& Time::ceil(TimeComponent to)
+{
+    ceil_components(to);
+    return *this;
+}
+
+constexpr Time& Time::floor(TimeComponent to)
+{
+    int64_t nanoseconds = BasicTime::total_nanoseconds();
+    set_total_nanoseconds(nanoseconds - nanoseconds % nanoseconds_per(to));
+    return *this;
+}
+
+constexpr int64_t Time::round_components(TimeComponent to)
+{
+    int64_t nanoseconds = BasicTime::total_nanoseconds();
+    int64_t nanoseconds_per_to = nanoseconds_per(to);
+
+    // Each component rounds the one above it, so a carry from a smaller component can push the
+    // next component over its halfway point.
+    int64_t smaller_unit = 1;
+    for (int64_t unit : {NANOSECONDS_PER_MICROSECOND, NANOSECONDS_PER_MILLISECOND,
+                         NANOSECONDS_PER_SECOND, NANOSECONDS_PER_MINUTE, NANOSECONDS_PER_HOUR})
+    {
+        if (unit > nanoseconds_per_to)
+            break;
+
+        int64_t remainder = nanoseconds % unit;
+        nanoseconds -= remainder;
+        if (remainder >= unit / smaller_unit / 2 * smaller_unit)
+            nanoseconds += unit;
+        smaller_unit = unit;
+    }
+
+    return set_total_nanoseconds(nanoseconds);
+}
+
+constexpr int64_t Time::ceil_components(TimeComponent to)
+{
+    int64_t nanoseconds = BasicTime::total_nanoseconds();
+    int64_t nanoseconds_per_to = nanoseconds_per(to);
+
+    int64_t remainder = nanoseconds % nanoseconds_per_to;
+    if (remainder > 0)
+        nanoseconds += nanoseconds_per_to - remainder;
+
+    return set_total_nanoseconds(nanoseconds);
+}
+
+constexpr int64_t Time::nanoseconds_per(TimeComponent component)
+{
+    switch (component)
+    {
+    case TimeComponent::MINUTE:
+        return NANOSECONDS_PER_MINUTE;
+    case TimeComponent::SECOND:
+        return NANOSECONDS_PER_SECOND;
+    case TimeComponent::MILLISECOND:
+        return NANOSECONDS_PER_MILLISECOND;
+    case TimeComponent::MICROSECOND:
+        return NANOSECONDS_PER_MICROSECOND;
+    case TimeComponent::NANOSECOND:
+        return 1;
+    default:
+        return NANOSECONDS_PER_HOUR;
+    }
+}
+
+constexpr bool Time::is_valid_time() const
+{
+    return is_valid_hour() && is_valid_minute() && is_valid_second() && is_valid_millisecond()
+           && is_valid_microsecond() && is_valid_nanosecond();
+}
+
+constexpr bool Time::is_valid_hour() const
+{
+    return hour < HOURS_PER_DAY && hour >= 0;
+}
+
+constexpr bool Time::is_valid_minute() const
+{
+    return minute < MINUTES_PER_HOUR && minute >= 0;
+}
+
+constexpr bool Time::is_valid_second() const
+{
+    return second < SECONDS_PER_MINUTE && second >= 0;
+}
+
+constexpr bool Time::is_valid_millisecond() const
+{
+    return millisecond < MILLISECONDS_PER_SECOND && millisecond >= 0;
+}
+
+constexpr bool Time::is_valid_microsecond() const
+{
+    return microsecond < MICROSECONDS_PER_MILLISECOND && microsecond >= 0;
+}
+
+constexpr bool Time::is_valid_nanosecond() const
+{
+    return nanosecond < NANOSECONDS_PER_MICROSECOND && nanosecond >= 0;
+}
+
+constexpr Time Time::max()
+{
+    return Time(23, 59, 59, 999, 999, 999);
+}
+
+template<typename... Component>
+    requires (std::same_as<Component, TimeComponent> && ...)
+Time::Time(std::string_view string, Component... time_components) :
+    Time(parse::value_or_throw(try_parse(string, time_components...), string)) {}
+
+template<typename... Component>
+    requires (std::same_as<Component, TimeComponent> && ...)
+std::expected<Time, ParseError> Time::try_parse(std::string_view string,
+                                                Component... time_components)
+{
+    Time time = Time(UNCHECKED, 0, 0, 0, 0, 0, 0, get_default_timezone());
+    ParseError error{};
+    size_t pos = 0;
+
+    // Lambda to set each time component value from the next number in 'string'. Returns
+    // 'false' once a number can not be read, which stops the remaining components being read.
+    auto set_time_component_from_str = [&](const auto& time_component) {
+        std::expected<int64_t, ParseError> value = parse::next_component(string, pos);
+        if (!value.has_value())
+        {
+            error = value.error();
+            return false;
+        }
 
-    // Lambda to get each time component value from each time component string
-    auto get_time_components_from_str = [&](const auto& time_component, size_t idx) {
         switch (time_component)
         {
         case TimeComponent::HOUR:
-            hour = std::stoi(time_components_strs[idx]);
+            time.hour = *value;
             break;
         case TimeComponent::MINUTE:
-            if (time_components_strs[idx].front() == '0')
-                minute = time_components_strs[idx].back()- '0'; // char to int
-            else
-                minute = std::stoi(time_components_strs[idx]);
+            time.minute = *value;
             break;
         case TimeComponent::SECOND:
-            if (time_components_strs[idx].front() == '0')
-                second = time_components_strs[idx].back() - '0'; // char to int
-            else
-                second = std::stoi(time_components_strs[idx]);
+            time.second = *value;
             break;
         case TimeComponent::MILLISECOND:
-            millisecond = std::stoi(time_components_strs[idx]);
+            time.millisecond = *value;
             break;
         case TimeComponent::MICROSECOND:
-            microsecond = std::stoi(time_components_strs[idx]);
+            time.microsecond = *value;
             break;
         case TimeComponent::NANOSECOND:
-            nanosecond = std::stoi(time_components_strs[idx]);
+            time.nanosecond = *value;
             break;
         case TimeComponent::TIMEZONE:
-            if (time_components_strs[idx].front() == '0')
-                timezone = Timezone(time_components_strs[idx].back() - '0');
-            else
-                timezone = Timezone(std::stoi(time_components_strs[idx]));
+        {
+            // Hours, optionally followed by ':' and two digits of minutes, such as "5:30". A '-'
+            // right before the hours makes 'utc_offset_minutes' negative, east of UTC, as
+            // 'Timezone::to_chars' writes it. Anything else before them is a delimiter.
+            size_t hours_start = pos;
+            while (hours_start > 0 && parse::is_digit(string[hours_start - 1]))
+                hours_start--;
+            bool is_east = hours_start > 0 && string[hours_start - 1] == '-'
+                           && (hours_start < 2 || !parse::is_digit(string[hours_start - 2]));
+
+            int64_t minutes = 0;
+            if (pos < string.size() && string[pos] == ':'
+                && parse::fixed_digits(string, pos + 1, 2, minutes))
+            {
+                if (minutes >= static_cast<int64_t>(MINUTES_PER_HOUR))
+                {
+                    error = ParseError{ParseError::Code::UNSUPPORTED_OFFSET,
+                                       static_cast<uint32_t>(pos + 1)};
+                    return false;
+                }
+                pos += 3;
+            }
+
+            int64_t offset = *value * static_cast<int64_t>(MINUTES_PER_HOUR) + minutes;
+            if (offset > Timezone::MAX_UTC_OFFSET_MINUTES)
+            {
+                error = ParseError{ParseError::Code::UNSUPPORTED_OFFSET,
+                                   static_cast<uint32_t>(hours_start)};
+                return false;
+            }
+            time.timezone = Timezone(Minutes(is_east ? -offset : offset));
             break;
         }
+        }
+        return true;
     };
 
     // Call the lambda function on each time component
-    (get_time_components_from_str(time_components, idx++), ...);
+    if (!(set_time_component_from_str(time_components) && ...))
+        return std::unexpected(error);
 
-    ASSERT(is_valid_time(),
-           std::invalid_argument(fmt::format("Time '{}' is invalid", Time::to_string())));
+    if (!time.is_valid_time())
+        return std::unexpected(ParseError{ParseError::Code::INVALID_TIME, 0});
+
+    return time;
 }
 
 inline size_t hash_value(const Time& time)
@@ -724,7 +1508,7 @@ inline size_t hash_value(const Time& time)
     boost::hash_combine(seed, time.millisecond);
     boost::hash_combine(seed, time.microsecond);
     boost::hash_combine(seed, time.nanosecond);
-    boost::hash_combine(seed, time.timezone.utc_offset);
+    boost::hash_combine(seed, time.timezone.utc_offset_minutes);
     return seed;
 }
 
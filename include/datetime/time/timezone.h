@@ -4,75 +4,124 @@
 #include <iostream>
 #include <chrono>
 #include "fmt/format.h"
+#include "../../../src/util/chars.h"
+#include "../../../src/util/macros.h"
+#include "components/minutes.h"
+#include <stdexcept>
 
 /**
  * Timezone.
  *
  * Used in 'Time'.
+ *
+ * Stored as its UTC offset in minutes, which is also what identifies it, so every 'Timezone'
+ * fits in two bytes and offsets such as Asia/Kolkata's +5:30 and Asia/Kathmandu's +5:45 can be
+ * represented.
  */
 struct Timezone
 {
 public:
     /**
-     * The difference in hours between the UTC's hour and the this 'Timezone's' hour.
+     * The difference in minutes between UTC's time and this 'Timezone's' time. Positive west of
+     * UTC, so TZ::EST is 300. Never more than 'MAX_UTC_OFFSET_MINUTES' either way.
+     */
+    int16_t utc_offset_minutes;
+
+    /**
+     * Largest UTC offset in minutes either way, 24 hours. Real zones stay well within it.
+     */
+    static constexpr int16_t MAX_UTC_OFFSET_MINUTES = 24 * 60;
+
+    /**
+     * Creates a 'Timezone' object with a given UTC offset in hours.
+     *
+     * @param utc_offset the difference in hours between UTC's hour and the 'Timezone's' hour,
+     * positive west of UTC.
+     *
+     * @throws std::invalid_argument if 'utc_offset' is more than 24 hours either way.
      */
-    int utc_offset;
+    explicit constexpr Timezone(int utc_offset) :
+            utc_offset_minutes(0)
+    {
+        ASSERT(utc_offset >= -MAX_UTC_OFFSET_MINUTES / 60
+               && utc_offset <= MAX_UTC_OFFSET_MINUTES / 60,
+               std::invalid_argument(fmt::format("UTC offset of {} hours is out of range",
+                                                 utc_offset)));
+        utc_offset_minutes = static_cast<int16_t>(utc_offset * 60);
+    }
 
     /**
-     * Creates a 'Timezone' object with a given UTC offset.
+     * Creates a 'Timezone' object with a given UTC offset in minutes.
+     *
+     * @param utc_offset the difference in minutes between UTC's time and the 'Timezone's' time,
+     * positive west of UTC.
+     *
+     * @throws std::invalid_argument if 'utc_offset' is more than 'MAX_UTC_OFFSET_MINUTES' either
+     * way.
+     *
+     * @example
+     * Timezone kolkata = Timezone(Minutes(-330));
+     * std::cout << kolkata.to_string();
      *
-     * @param utc_offset the UTC offset of the 'Timezone'.
+     * // output: -5:30
      */
-    explicit Timezone(int utc_offset) :
-            utc_offset(utc_offset) {}
+    explicit constexpr Timezone(Minutes utc_offset) :
+            utc_offset_minutes(0)
+    {
+        ASSERT(utc_offset.value >= -MAX_UTC_OFFSET_MINUTES
+               && utc_offset.value <= MAX_UTC_OFFSET_MINUTES,
+               std::invalid_argument(fmt::format("UTC offset of {} minutes is out of range",
+                                                 utc_offset.value)));
+        utc_offset_minutes = static_cast<int16_t>(utc_offset.value);
+    }
 
     /**
      * Gets the difference in UTC offsets between this 'Timezone' and 'other'.
      *
      * @param other the 'Timezone' comparing to.
      *
-     * @return the UTC offset
+     * @return the difference in minutes.
      *
      * @example
-     * int est_cst_utc_offset_diff = TZ::EST.get_utc_offset_diff(TZ::CST);
-     * std::cout << est_cst_utc_offset_diff;
+     * Minutes est_cst_utc_offset_diff = TZ::EST.get_utc_offset_diff(TZ::CST);
+     * std::cout << est_cst_utc_offset_diff.value;
      *
-     * // output: -1
+     * // output: -60
      *
-     * int cst_est_utc_offset_diff = TZ::CST.get_utc_offset_diff(TZ::EST);
-     * std::cout << cst_est_utc_offset_diff;
+     * Minutes cst_est_utc_offset_diff = TZ::CST.get_utc_offset_diff(TZ::EST);
+     * std::cout << cst_est_utc_offset_diff.value;
      *
-     * //output: 1
+     * //output: 60
      */
-    int get_utc_offset_diff(Timezone other) const
+    constexpr Minutes get_utc_offset_diff(Timezone other) const
     {
-        return utc_offset - other.utc_offset;
+        return Minutes(utc_offset_minutes - other.utc_offset_minutes);
     }
 
     /**
-     * Checks if 'other' has the same 'utc_offset' as this 'Timezone'.
+     * Checks if 'other' has the same 'utc_offset_minutes' as this 'Timezone'.
      *
      * @param other the 'Timezone' comparing to.
      *
-     * @return 'true' if the utc_offset of this 'Timezone' is the same as 'other', 'false'
+     * @return 'true' if the utc_offset_minutes of this 'Timezone' is the same as 'other', 'false'
      * otherwise.
      */
-    bool operator==(const Timezone& other) const
+    constexpr bool operator==(const Timezone& other) const
     {
-        return utc_offset == other.utc_offset;
+        return utc_offset_minutes == other.utc_offset_minutes;
     }
 
     /**
-     * Checks if 'other' has a different 'utc_offset' as this 'Timezone'.
+     * Checks if 'other' has a different 'utc_offset_minutes' as this 'Timezone'.
      *
      * @param other the 'Timezone' comparing to.
      *
-     * @return 'true' if the utc_offset of this 'Timezone' is different than 'other', 'false'
-     * otherwise.
+     * @return 'true' if the utc_offset_minutes of this 'Timezone' is different than 'other',
+     * 'false' otherwise.
      */
-    bool operator!=(const Timezone& other) const
+    constexpr bool operator!=(const Timezone& other) const
     {
-        return utc_offset != other.utc_offset;
+        return utc_offset_minutes != other.utc_offset_minutes;
     }
 
     /**
@@ -89,9 +138,40 @@ public:
      */
     std::string to_string() const
     {
-        return fmt::format("{}:00", utc_offset);
+        char buffer[MAX_CHARS];
+        return std::string(buffer, to_chars(buffer, buffer + MAX_CHARS).ptr);
+    }
+
+    /**
+     * Writes the 'to_string' representation of 'this' into '[first, last)', without allocating.
+     *
+     * @param first start of the buffer to write into.
+     * @param last one past the end of the buffer to write into.
+     *
+     * @return one past the last character written, or 'last' with
+     * 'std::errc::value_too_large' if the buffer is too small.
+     */
+    constexpr std::to_chars_result to_chars(char* first, char* last) const
+    {
+        chars::Writer writer = {first, last};
+        int minutes = utc_offset_minutes;
+        if (minutes < 0)
+        {
+            writer.put('-');
+            minutes = -minutes;
+        }
+        writer.put_number(minutes / 60);
+        writer.put(':');
+        writer.put(static_cast<char>('0' + minutes % 60 / 10));
+        writer.put(static_cast<char>('0' + minutes % 10));
+        return writer.result();
     }
 
+    /**
+     * Most characters 'to_chars' can write.
+     */
+    static constexpr size_t MAX_CHARS = 14;
+
     /**
      * Outputs 'timezone' into 'os'.
      *
@@ -111,37 +191,37 @@ namespace TZ
     /**
      * The Universal Time Coordinated (UTC) timezone.
      */
-    const Timezone UTC = Timezone(0);
+    inline constexpr Timezone UTC = Timezone(0);
 
     /**
      * The Pacific Standard Time (PST) timezone.
      */
-    const Timezone PST = Timezone(8);
+    inline constexpr Timezone PST = Timezone(8);
 
     /**
      * The Pacific Daylight Time (PDT) timezone.
      */
-    const Timezone PDT = Timezone(7);
+    inline constexpr Timezone PDT = Timezone(7);
 
     /**
      * The Central Standard Time (CST) timezone.
      */
-    const Timezone CST = Timezone(6);
+    inline constexpr Timezone CST = Timezone(6);
 
     /**
     * The Central Daylight Time (CDT) timezone.
     */
-    const Timezone CDT = Timezone(5);
+    inline constexpr Timezone CDT = Timezone(5);
 
     /**
      * Eastern Standard Time (EST) timezone.
      */
-    const Timezone EST = Timezone(5);
+    inline constexpr Timezone EST = Timezone(5);
 
     /**
     * Eastern Daylight Time (EDT) timezone.
     */
-    const Timezone EDT = Timezone(4);
+    inline constexpr Timezone EDT = Timezone(4);
 
     namespace helpers
     {
@@ -154,7 +234,7 @@ namespace TZ
          *
          * @throws std::invalid_argument Thrown if no timezones matched 'timezone_string'.
          */
-        static Timezone get_from_str(std::string_view timezone_string)
+        inline Timezone get_from_str(std::string_view timezone_string)
         {
             if (timezone_string == "Coordinated Universal Time")
                 return UTC;
@@ -175,31 +255,91 @@ namespace TZ
             throw std::invalid_argument(fmt::format("'{}' is not a valid timezone string", timezone_string));
         }
 
-/**
- * Gets the local 'Timezone' based on the user's location.
- *
- * @return local 'Timezone'.
- */
-        static Timezone get_local_tz()
+        /**
+         * Gets the local 'Timezone' from the UTC offset the C library uses for local time now,
+         * which follows the 'TZ' environment variable, or '/etc/localtime' if it is not set.
+         *
+         * Reads the offset again on every call. Use 'TZ::local()' for the offset read once.
+         *
+         * @return local 'Timezone', or 'TZ::UTC' if the local time can not be read. Does not
+         * throw, whatever the local timezone is called.
+         */
+        Timezone get_local_tz();
+
+        /**
+         * Stands in for the local 'Timezone' until it is used as one, so that the local timezone
+         * is only read by programs that use it.
+         */
+        struct LocalTimezone
         {
-            // Get the current system time
-            std::chrono::system_clock::time_point now = std::chrono::system_clock::now();
-            // Convert the system time to a std::time_t object
-            std::time_t now_time_t = std::chrono::system_clock::to_time_t(now);
-            // Convert the std::time_t object to a std::tm object
-            std::tm *now_tm = std::localtime(&now_time_t);
-            // Get the name of the local timezone
-            char timezone_name[128];
-            std::strftime(timezone_name, sizeof(timezone_name), "%Z", now_tm);
-
-            return helpers::get_from_str(timezone_name);
-        }
+            /**
+             * Gets the local 'Timezone'.
+             *
+             * @return 'TZ::local()'.
+             */
+            operator Timezone() const;
+
+            /**
+             * 'std::string' representation of the local 'Timezone'.
+             *
+             * @return 'TZ::local().to_string()'.
+             */
+            std::string to_string() const;
+
+            /**
+             * Writes the 'to_string' representation of the local 'Timezone' into '[first, last)',
+             * without allocating.
+             *
+             * @param first start of the buffer to write into.
+             * @param last one past the end of the buffer to write into.
+             *
+             * @return 'TZ::local().to_chars(first, last)'.
+             */
+            std::to_chars_result to_chars(char* first, char* last) const;
+
+            /**
+             * Gets the difference in UTC offsets between the local 'Timezone' and 'other'.
+             *
+             * @param other the 'Timezone' comparing to.
+             *
+             * @return 'TZ::local().get_utc_offset_diff(other)'.
+             */
+            Minutes get_utc_offset_diff(Timezone other) const;
+
+            /**
+             * Outputs the local 'Timezone' into 'os'.
+             *
+             * @param os std::ostream' to insert the local 'Timezone' into.
+             * @param local_timezone stands in for the local 'Timezone'.
+             *
+             * @return reference to 'os' after inserting the local 'Timezone' into 'os'.
+             */
+            friend std::ostream& operator<<(std::ostream& os, LocalTimezone local_timezone)
+            {
+                return os << Timezone(local_timezone);
+            }
+        };
     }
 
-/**
- * Local 'Timezone' based on user's location.
- */
-    const Timezone LOCAL = helpers::get_local_tz();
+    /**
+     * Gets the local 'Timezone'.
+     *
+     * Read on first use rather than during static initialization, once per process, and safely
+     * if several threads use it first at once. Later changes to 'TZ' or '/etc/localtime', and
+     * daylight saving time starting or ending, are not picked up.
+     *
+     * @return local 'Timezone', or 'TZ::UTC' if the local time can not be read.
+     *
+     * @see helpers::get_local_tz
+     */
+    Timezone local();
+
+    /**
+     * Local 'Timezone' based on user's location. Converts to 'TZ::local()' where a 'Timezone' is
+     * needed, and has the member functions of a 'Timezone'. Its 'utc_offset_minutes' is read
+     * through 'TZ::local()', and 'auto' deduces 'helpers::LocalTimezone' rather than 'Timezone'.
+     */
+    inline constexpr helpers::LocalTimezone LOCAL = helpers::LocalTimezone();
 }
 
 #endif //DATETIME_TIMEZONE_H
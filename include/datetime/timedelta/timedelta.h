@@ -27,10 +27,11 @@ public:
      * @param millisecond millisecond of the delta. (default 0)
      * @param microsecond microsecond of the delta. (default 0)
      * @param nanosecond nanosecond of the delta. (default 0)
-     * @param timezone timezone the of the delta. (default default_timezone)
+     * @param timezone timezone the of the delta. (default get_default_timezone())
      */
-    TimeDelta(int64_t days = 0, uint8_t hour = 0, uint8_t minute = 0, uint8_t second = 0,
-              uint16_t millisecond = 0, uint16_t microsecond = 0, uint16_t nanosecond = 0) :
+    constexpr TimeDelta(int64_t days = 0, uint8_t hour = 0, uint8_t minute = 0,
+                        uint8_t second = 0, uint16_t millisecond = 0, uint16_t microsecond = 0,
+                        uint16_t nanosecond = 0) :
         days(days), BasicTime(hour, minute, second, millisecond, microsecond, nanosecond) {}
 
     /**
@@ -38,7 +39,7 @@ public:
      *
      * @return 'this' with 'days' equal to the absolute value of 'days'.
      */
-    TimeDelta& abs();
+    constexpr TimeDelta& abs();
 
     /**
      * Outputs 'time_delta' into 'os'.
@@ -50,6 +51,30 @@ public:
      */
     friend std::ostream& operator<<(std::ostream& os, const TimeDelta& time_delta);
 
+    /**
+     * Writes this 'TimeDelta' into '[first, last)' as it is output by 'operator<<', without
+     * allocating.
+     *
+     * @param first start of the buffer to write into.
+     * @param last one past the end of the buffer to write into.
+     *
+     * @example
+     * TimeDelta time_delta = TimeDelta(1, 2, 3, 4, 5, 6, 7);
+     * char buffer[TimeDelta::MAX_CHARS];
+     * std::to_chars_result result = time_delta.to_chars(buffer, buffer + TimeDelta::MAX_CHARS);
+     *
+     * // buffer: 1 days, 2:03:04.5.6.7
+     *
+     * @return one past the last character written, or 'last' with
+     * 'std::errc::value_too_large' if the buffer is too small.
+     */
+    std::to_chars_result to_chars(char* first, char* last) const;
+
+    /**
+     * Most characters 'to_chars' can write.
+     */
+    static constexpr size_t MAX_CHARS = 20 + 7 + BasicTime::MAX_CHARS;
+
     /**
      * Checks if 'this' is greater than 'other'.
      *
@@ -57,7 +82,7 @@ public:
      *
      * @return 'true' if 'this' is greater than 'other', 'false' otherwise.
      */
-    bool operator>(TimeDelta other) const;
+    constexpr bool operator>(TimeDelta other) const;
 
     /**
      * Checks if 'this' is greater than or equal to 'other'.
@@ -66,7 +91,7 @@ public:
      *
      * @return 'true' if 'this' is greater than or equal to 'other', 'false' otherwise.
      */
-    bool operator>=(TimeDelta other) const;
+    constexpr bool operator>=(TimeDelta other) const;
 
     /**
      * Checks if 'this' is equal to 'other'.
@@ -75,7 +100,7 @@ public:
      *
      * @return 'true' if 'this' is equal to 'other', 'false' otherwise.
      */
-    bool operator==(TimeDelta other) const;
+    constexpr bool operator==(TimeDelta other) const;
 
     /**
      * Checks if 'this' is not equal to 'other'.
@@ -84,7 +109,7 @@ public:
      *
      * @return 'true' if 'this' is not equal to 'other', 'false' otherwise.
      */
-    bool operator!=(TimeDelta other) const;
+    constexpr bool operator!=(TimeDelta other) const;
 
     /**
      * Checks if 'this' is less than or equal to 'other'.
@@ -93,7 +118,7 @@ public:
      *
      * @return 'true' if 'this' is less than or equal to 'other', 'false' otherwise.
      */
-    bool operator<=(TimeDelta other) const;
+    constexpr bool operator<=(TimeDelta other) const;
 
     /**
      * Checks if 'this' is less than 'other'.
@@ -102,50 +127,124 @@ public:
      *
      * @return 'true' if 'this' is less than 'other', 'false' otherwise.
      */
-    bool operator<(TimeDelta other) const;
+    constexpr bool operator<(TimeDelta other) const;
 
     /**
      * Gets the total hours.
      *
      * @return total hours.
      */
-    int total_hours() const;
+    constexpr int total_hours() const;
 
     /**
      * Gets the total minutes.
      *
      * @return total minutes.
      */
-    int total_minutes() const override;
+    constexpr int total_minutes() const;
 
     /**
      * Gets the total seconds.
      *
      * @return total seconds.
      */
-    int total_seconds() const override;
+    constexpr int total_seconds() const;
 
     /**
      * Gets the total milliseconds.
      *
      * @return total milliseconds.
      */
-    int64_t total_milliseconds() const override;
+    constexpr int64_t total_milliseconds() const;
 
     /**
      * Gets the total microseconds.
      *
      * @return total microseconds.
      */
-    int64_t total_microseconds() const override;
+    constexpr int64_t total_microseconds() const;
 
     /**
      * Gets the total nanoseconds.
      *
      * @return total nanoseconds.
      */
-    int64_t total_nanoseconds() const override;
+    constexpr int64_t total_nanoseconds() const;
 };
 
+static_assert(sizeof(TimeDelta) == 24);
+static_assert(std::is_trivially_copyable_v<TimeDelta>);
+
+constexpr bool TimeDelta::operator>(TimeDelta other) const
+{
+    return days > other.days
+           || days == other.days && BasicTime::operator>(other);
+}
+
+constexpr bool TimeDelta::operator>=(TimeDelta other) const
+{
+    return days >= other.days
+           || days == other.days && BasicTime::operator>=(other);
+}
+
+constexpr bool TimeDelta::operator==(TimeDelta other) const
+{
+    return days == other.days && BasicTime::operator==(other);
+}
+
+constexpr bool TimeDelta::operator!=(TimeDelta other) const
+{
+    return days != other.days || BasicTime::operator!=(other);
+}
+
+constexpr bool TimeDelta::operator<=(TimeDelta other) const
+{
+    return days <= other.days
+           || days == other.days && BasicTime::operator<=(other);
+}
+
+constexpr bool TimeDelta::operator<(TimeDelta other) const
+{
+    return days < other.days
+           || days == other.days && BasicTime::operator<(other);
+}
+
+constexpr int TimeDelta::total_hours() const
+{
+    return hour + days * HOURS_PER_DAY;
+}
+
+constexpr int TimeDelta::total_minutes() const
+{
+    return BasicTime::total_minutes() + days * HOURS_PER_DAY * MINUTES_PER_HOUR;
+}
+
+constexpr int TimeDelta::total_seconds() const
+{
+    return BasicTime::total_seconds() + days * HOURS_PER_DAY * SECONDS_PER_HOUR;
+}
+
+constexpr int64_t TimeDelta::total_milliseconds() const
+{
+    return BasicTime::total_milliseconds() + days * HOURS_PER_DAY * MILLISECONDS_PER_HOUR;
+}
+
+constexpr int64_t TimeDelta::total_microseconds() const
+{
+    return BasicTime::total_microseconds() + days * HOURS_PER_DAY * MICROSECONDS_PER_HOUR;
+}
+
+constexpr int64_t TimeDelta::total_nanoseconds() const
+{
+    return BasicTime::total_nanoseconds() + days * HOURS_PER_DAY * NANOSECONDS_PER_HOUR;
+}
+
+constexpr TimeDelta& TimeDelta::abs()
+{
+    if (days < 0)
+        days = -days;
+    return *this;
+}
+
 
 #endif //DATETIME_TIMEDELTA_H
@@ -0,0 +1,332 @@
+#ifndef DATETIME_TIMER_WHEEL_H
+#define DATETIME_TIMER_WHEEL_H
+
+#include "datetime/timestamp/timestamp.h"
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+/**
+ * Schedules callbacks to run at 'Datetime' deadlines, in O(1) per timer.
+ *
+ * Deadlines are rounded up to ticks of a fixed resolution and kept in a hierarchy of wheels of
+ * 256 slots each. The first wheel has one slot per tick, and each wheel after it has slots 256
+ * times as wide as the one before. A timer goes into the wheel its deadline first differs from
+ * the current tick in, so scheduling and cancelling are a list insert and remove. Once the
+ * current tick reaches the start of a slot in a higher wheel, that slot's timers move down into
+ * the lower wheels. Each timer moves at most once per wheel, and empty slots are skipped with a
+ * bitmap search, so advancing over idle time is cheap.
+ *
+ * The wheel never reads the time itself. It is advanced by 'advance' with a time the caller
+ * supplies, or by 'poll' with the time from the clock it was created with.
+ *
+ * A 'TimerWheel' is not thread safe.
+ *
+ * @code
+ * TimerWheel wheel = TimerWheel(Milliseconds(1), [] { return Datetime::now(); });
+ * TimerWheel::TimerId id = wheel.schedule(TimeDelta(0, 0, 0, 5), [] { expire_order(); });
+ * ...
+ * wheel.cancel(id);
+ * ...
+ * wheel.poll();
+ * @endcode
+ */
+class TimerWheel
+{
+public:
+    /**
+     * Function run when a timer expires.
+     */
+    using Callback = std::function<void()>;
+
+    /**
+     * Function that gets the current time.
+     */
+    using Clock = std::function<Datetime()>;
+
+    /**
+     * Identifies a scheduled timer so it can be cancelled.
+     */
+    using TimerId = uint64_t;
+
+    /**
+     * 'TimerId' that never identifies a timer.
+     */
+    static constexpr TimerId INVALID_TIMER = 0;
+
+    /**
+     * Creates an empty 'TimerWheel' whose ticks are 'resolution' long, starting at the current
+     * time of 'clock'.
+     *
+     * @param resolution length of one tick. Timers fire up to one tick after their deadline.
+     * @param clock gets the current time for 'poll'.
+     *
+     * @throws std::invalid_argument if 'resolution' is not positive.
+     */
+    TimerWheel(Milliseconds resolution, Clock clock);
+
+    /**
+     * Creates an empty 'TimerWheel' whose ticks are 'resolution' long, starting at the current
+     * time of 'clock'.
+     *
+     * @param resolution length of one tick. Timers fire up to one tick after their deadline.
+     * @param clock gets the current time for 'poll'.
+     *
+     * @throws std::invalid_argument if 'resolution' is not positive.
+     */
+    TimerWheel(Microseconds resolution, Clock clock);
+
+    /**
+     * Schedules 'callback' to run at 'deadline'.
+     *
+     * A 'deadline' that has already passed runs on the next 'advance' or 'poll'.
+     *
+     * @param deadline time to run 'callback' at. Its 'timezone' is accounted for.
+     * @param callback function to run.
+     *
+     * @return id of the scheduled timer.
+     */
+    TimerId schedule(const Datetime& deadline, Callback callback);
+
+    /**
+     * Schedules 'callback' to run 'delay' after the time the wheel was last advanced to.
+     *
+     * @param delay time from now to run 'callback' at.
+     * @param callback function to run.
+     *
+     * @return id of the scheduled timer.
+     */
+    TimerId schedule(const TimeDelta& delay, Callback callback);
+
+    /**
+     * Cancels the timer identified by 'id', so its callback never runs.
+     *
+     * @param id id of the timer to cancel.
+     *
+     * @return 'true' if the timer was cancelled, 'false' if it already ran or was cancelled.
+     */
+    bool cancel(TimerId id);
+
+    /**
+     * Runs the callbacks of all timers whose deadlines are at or before 'now', in deadline order
+     * to the resolution of a tick.
+     *
+     * Callbacks may schedule and cancel timers. Timers they schedule for a deadline that has
+     * already passed run on the next call. If a callback throws, the exception propagates and
+     * the remaining expired timers run on the next call.
+     *
+     * @param now current time. Ignored if it is before the time the wheel was last advanced to.
+     *
+     * @return the number of callbacks run.
+     */
+    size_t advance(const Datetime& now);
+
+    /**
+     * Calls 'advance' with the current time of the wheel's clock.
+     *
+     * @return the number of callbacks run.
+     */
+    size_t poll();
+
+    /**
+     * Gets the number of timers that are scheduled and have not run or been cancelled.
+     *
+     * @return number of pending timers.
+     */
+    size_t size() const;
+
+    /**
+     * Checks if no timers are pending.
+     *
+     * @return 'true' if 'size()' is 0, 'false' otherwise.
+     */
+    bool empty() const;
+
+private:
+    /**
+     * Bits of the tick each wheel is indexed by.
+     */
+    static constexpr int BITS_PER_LEVEL = 8;
+
+    /**
+     * Slots in each wheel.
+     */
+    static constexpr uint32_t SLOTS_PER_LEVEL = 1 << BITS_PER_LEVEL;
+
+    /**
+     * Number of wheels, enough to cover every 64 bit tick.
+     */
+    static constexpr int LEVELS = 64 / BITS_PER_LEVEL;
+
+    /**
+     * List of timers that are due and will run on the next 'advance'.
+     */
+    static constexpr uint32_t DUE_LIST = LEVELS * SLOTS_PER_LEVEL;
+
+    /**
+     * List of timers that are running in the current 'advance'.
+     */
+    static constexpr uint32_t FIRING_LIST = DUE_LIST + 1;
+
+    /**
+     * Marks the end of a list, and timers that are in no list.
+     */
+    static constexpr uint32_t NONE = UINT32_MAX;
+
+    /**
+     * Scheduled timer, linked into the list of the slot it is in.
+     */
+    struct Timer
+    {
+        /**
+         * Tick the timer is due on.
+         */
+        uint64_t tick = 0;
+
+        /**
+         * Function to run when the timer expires.
+         */
+        Callback callback;
+
+        /**
+         * Index of the previous timer in the list, or 'NONE'.
+         */
+        uint32_t prev = NONE;
+
+        /**
+         * Index of the next timer in the list, or of the next free timer if this one is free.
+         */
+        uint32_t next = NONE;
+
+        /**
+         * List the timer is in, or 'NONE' if it is free.
+         */
+        uint32_t list = NONE;
+
+        /**
+         * Incremented each time the timer is freed, so old 'TimerIds' for it no longer match.
+         */
+        uint32_t generation = 1;
+    };
+
+    /**
+     * First and last timer of a list.
+     */
+    struct List
+    {
+        uint32_t first = NONE;
+        uint32_t last = NONE;
+    };
+
+    /**
+     * Creates an empty 'TimerWheel' whose ticks are 'resolution_nanoseconds' long.
+     */
+    TimerWheel(int64_t resolution_nanoseconds, Clock clock);
+
+    /**
+     * Schedules 'callback' to run at 'deadline_nanoseconds'.
+     *
+     * @param deadline_nanoseconds deadline in nanoseconds since the unix epoch.
+     * @param callback function to run.
+     *
+     * @return id of the scheduled timer.
+     */
+    TimerId schedule_at(int64_t deadline_nanoseconds, Callback callback);
+
+    /**
+     * Puts the timer at 'index' into the list for its tick: the due list if the tick has
+     * passed, otherwise the slot of the wheel its tick first differs from the current tick in.
+     *
+     * @param index index of the timer in 'timers'.
+     */
+    void insert(uint32_t index);
+
+    /**
+     * Appends the timer at 'index' to 'list'.
+     */
+    void link(uint32_t index, uint32_t list);
+
+    /**
+     * Removes the timer at 'index' from its list.
+     */
+    void unlink(uint32_t index);
+
+    /**
+     * Moves all of the timers in 'from' to the end of 'to'.
+     */
+    void splice(uint32_t from, uint32_t to);
+
+    /**
+     * Moves the timers in 'slot' of 'level' into the wheels below it.
+     */
+    void cascade(int level, uint32_t slot);
+
+    /**
+     * Frees the timer at 'index', which must not be in a list, so it can be reused.
+     *
+     * @param index index of the timer in 'timers'.
+     */
+    void release(uint32_t index);
+
+    /**
+     * Runs and frees every timer in the firing list.
+     *
+     * @return the number of callbacks run.
+     */
+    size_t fire();
+
+    /**
+     * Gets the next tick after the current one that timers move or expire on.
+     *
+     * @return the next tick anything happens on, or 'UINT64_MAX' if no timers are in the wheels.
+     */
+    uint64_t next_event() const;
+
+    /**
+     * Length of a tick in nanoseconds.
+     */
+    int64_t resolution_nanoseconds;
+
+    /**
+     * Gets the current time for 'poll'.
+     */
+    Clock clock;
+
+    /**
+     * Time the wheel was last advanced to, in nanoseconds since the unix epoch.
+     */
+    int64_t current_nanoseconds;
+
+    /**
+     * Tick the wheel was last advanced to.
+     */
+    uint64_t current_tick;
+
+    /**
+     * Storage of all timers, free or not. 'TimerIds' index into it.
+     */
+    std::vector<Timer> timers;
+
+    /**
+     * First free timer in 'timers', or 'NONE'.
+     */
+    uint32_t free_timers = NONE;
+
+    /**
+     * Number of pending timers.
+     */
+    size_t pending = 0;
+
+    /**
+     * Lists of each slot of each wheel, then the due and firing lists.
+     */
+    std::array<List, FIRING_LIST + 1> lists;
+
+    /**
+     * One bit per slot of each wheel, set if the slot's list is not empty.
+     */
+    std::array<std::array<uint64_t, SLOTS_PER_LEVEL / 64>, LEVELS> occupied{};
+};
+
+#endif //DATETIME_TIMER_WHEEL_H
@@ -0,0 +1,271 @@
+#ifndef DATETIME_DATETIME_ARRAY_H
+#define DATETIME_DATETIME_ARRAY_H
+
+#include "datetime/timestamp/timestamp.h"
+#include <cstdint>
+#include <span>
+#include <vector>
+
+/**
+ * Column of datetimes stored as nanoseconds since the unix epoch, one after another, sharing a
+ * 'Timezone'.
+ *
+ * Each element takes 8 bytes, half of a 'Datetime', and operations on the whole column run over
+ * plain 'int64_t's, which the compiler vectorizes. Operations it does not vectorize, such as
+ * 'floor' and 'day_of_week', have AVX2 kernels that are used when the CPU supports them.
+ *
+ * The elements are stored in UTC. 'timezone' is only used by the operations that depend on local
+ * time, and by conversions to 'Datetime'.
+ *
+ * @code
+ * DatetimeArray ticks = DatetimeArray(datetimes, TZ::EST);
+ * ticks += TimeDelta(0, 0, 0, 0, 0, 250);
+ * ticks.floor(TimeComponent::MINUTE);
+ * std::vector<uint8_t> in_session = ticks.between(open, close);
+ * @endcode
+ */
+class DatetimeArray
+{
+public:
+    /**
+     * Creates an empty 'DatetimeArray'.
+     *
+     * @param timezone 'Timezone' of the 'DatetimeArray'. (default Time::get_default_timezone())
+     */
+    explicit DatetimeArray(Timezone timezone = Time::get_default_timezone()) :
+        timezone(timezone) {}
+
+    /**
+     * Creates a 'DatetimeArray' of nanoseconds since the unix epoch.
+     *
+     * @param epoch_nanoseconds nanoseconds since the unix epoch in UTC of each element.
+     * @param timezone 'Timezone' of the 'DatetimeArray'. (default Time::get_default_timezone())
+     */
+    explicit DatetimeArray(std::vector<int64_t> epoch_nanoseconds,
+                           Timezone timezone = Time::get_default_timezone()) :
+        epoch_nanoseconds(std::move(epoch_nanoseconds)),
+        timezone(timezone) {}
+
+    /**
+     * Creates a 'DatetimeArray' at the same points in time as 'datetimes'.
+     *
+     * @param datetimes 'Datetimes' to store. Each one's 'timezone' is accounted for.
+     * @param timezone 'Timezone' of the 'DatetimeArray'. (default Time::get_default_timezone())
+     */
+    explicit DatetimeArray(std::span<const Datetime> datetimes,
+                           Timezone timezone = Time::get_default_timezone());
+
+    /**
+     * Converts each element to a 'Datetime' in 'timezone'.
+     *
+     * @return 'Datetimes' at the same points in time as the elements.
+     */
+    std::vector<Datetime> to_datetimes() const;
+
+    /**
+     * Gets the element at 'index' as a 'Datetime' in 'timezone'.
+     *
+     * @param index index of the element. Must be less than 'size()'.
+     *
+     * @return 'Datetime' at the same point in time as the element.
+     */
+    Datetime operator[](size_t index) const
+    {
+        return Timestamp(epoch_nanoseconds[index]).datetime(timezone);
+    }
+
+    /**
+     * Appends 'datetime' to the end.
+     *
+     * @param datetime 'Datetime' to append. Its 'timezone' is accounted for.
+     */
+    void push_back(const Datetime& datetime)
+    {
+        epoch_nanoseconds.push_back(Timestamp(datetime).epoch_nanoseconds);
+    }
+
+    /**
+     * Appends 'timestamp' to the end.
+     *
+     * @param timestamp 'Timestamp' to append.
+     */
+    void push_back(Timestamp timestamp)
+    {
+        epoch_nanoseconds.push_back(timestamp.epoch_nanoseconds);
+    }
+
+    /**
+     * Reserves space for 'capacity' elements.
+     *
+     * @param capacity number of elements to reserve space for.
+     */
+    void reserve(size_t capacity)
+    {
+        epoch_nanoseconds.reserve(capacity);
+    }
+
+    /**
+     * Gets the number of elements.
+     *
+     * @return the number of elements.
+     */
+    size_t size() const
+    {
+        return epoch_nanoseconds.size();
+    }
+
+    /**
+     * Checks if there are no elements.
+     *
+     * @return 'true' if there are no elements, 'false' otherwise.
+     */
+    bool empty() const
+    {
+        return epoch_nanoseconds.empty();
+    }
+
+    /**
+     * Gets the nanoseconds since the unix epoch in UTC of each element.
+     *
+     * @return the elements, one after another.
+     */
+    std::span<const int64_t> get_epoch_nanoseconds() const
+    {
+        return epoch_nanoseconds;
+    }
+
+    /**
+     * Gets the 'Timezone' of 'this'.
+     *
+     * @return 'Timezone' the elements are converted to and operated on in.
+     */
+    Timezone get_timezone() const
+    {
+        return timezone;
+    }
+
+    /**
+     * Shifts every element to 'new_timezone'.
+     *
+     * The elements stay at the same points in time, so this does not touch them.
+     *
+     * @param new_timezone 'Timezone' to shift to.
+     */
+    void set_timezone(Timezone new_timezone)
+    {
+        timezone = new_timezone;
+    }
+
+    /**
+     * Adds 'time_delta' to every element.
+     *
+     * @param time_delta the 'TimeDelta' to add.
+     *
+     * @return reference to this modified 'DatetimeArray'.
+     */
+    DatetimeArray& operator+=(const TimeDelta& time_delta);
+
+    /**
+     * Subtracts 'time_delta' from every element.
+     *
+     * @param time_delta the 'TimeDelta' to subtract.
+     *
+     * @return reference to this modified 'DatetimeArray'.
+     */
+    DatetimeArray& operator-=(const TimeDelta& time_delta);
+
+    /**
+     * Rounds down the components of every element in 'timezone', stopping at 'to'.
+     *
+     * @param to finish the rounding down of the components at this 'Component'.
+     *
+     * @return reference to this modified 'DatetimeArray'.
+     *
+     * @see Datetime::floor
+     */
+    DatetimeArray& floor(TimeComponent to);
+
+    /**
+     * Gets the day of the week of every element in 'timezone'.
+     *
+     * @return the 'Date::DayOfWeek' of each element.
+     */
+    std::vector<uint8_t> day_of_week() const;
+
+    /**
+     * Checks which elements are before 'datetime'.
+     *
+     * @param datetime 'Datetime' to compare to.
+     *
+     * @return 1 for each element before 'datetime', 0 for the others.
+     */
+    std::vector<uint8_t> less(const Datetime& datetime) const;
+
+    /**
+     * Checks which elements are before or at 'datetime'.
+     *
+     * @param datetime 'Datetime' to compare to.
+     *
+     * @return 1 for each element before or at 'datetime', 0 for the others.
+     */
+    std::vector<uint8_t> less_equal(const Datetime& datetime) const;
+
+    /**
+     * Checks which elements are after 'datetime'.
+     *
+     * @param datetime 'Datetime' to compare to.
+     *
+     * @return 1 for each element after 'datetime', 0 for the others.
+     */
+    std::vector<uint8_t> greater(const Datetime& datetime) const;
+
+    /**
+     * Checks which elements are after or at 'datetime'.
+     *
+     * @param datetime 'Datetime' to compare to.
+     *
+     * @return 1 for each element after or at 'datetime', 0 for the others.
+     */
+    std::vector<uint8_t> greater_equal(const Datetime& datetime) const;
+
+    /**
+     * Checks which elements are at 'datetime'.
+     *
+     * @param datetime 'Datetime' to compare to.
+     *
+     * @return 1 for each element at 'datetime', 0 for the others.
+     */
+    std::vector<uint8_t> equal(const Datetime& datetime) const;
+
+    /**
+     * Checks which elements are from 'begin' up to, but not including, 'end'.
+     *
+     * @param begin first 'Datetime' included.
+     * @param end first 'Datetime' after 'begin' not included.
+     *
+     * @return 1 for each element in the range, 0 for the others.
+     */
+    std::vector<uint8_t> between(const Datetime& begin, const Datetime& end) const;
+
+    /**
+     * Checks if 'this' and 'other' have the same elements and 'Timezone'.
+     *
+     * @param other 'DatetimeArray' to compare to.
+     *
+     * @return 'true' if 'this' is equal to 'other', 'false' otherwise.
+     */
+    bool operator==(const DatetimeArray& other) const = default;
+
+private:
+    /**
+     * Nanoseconds since the unix epoch in UTC of each element.
+     */
+    std::vector<int64_t> epoch_nanoseconds;
+
+    /**
+     * 'Timezone' the elements are converted to and operated on in.
+     */
+    Timezone timezone;
+};
+
+#endif //DATETIME_DATETIME_ARRAY_H
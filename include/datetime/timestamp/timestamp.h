@@ -0,0 +1,669 @@
+#ifndef DATETIME_TIMESTAMP_H
+#define DATETIME_TIMESTAMP_H
+
+#include <type_traits>
+#include "datetime/datetime/datetime.h"
+
+/**
+ * Compact point in time stored as nanoseconds since the unix epoch (1970-01-01 00:00 UTC).
+ *
+ * Unlike 'Datetime', a 'Timestamp' has no timezone; it is always UTC. It is meant for storing
+ * large amounts of points in time, where each one only needs to be converted to a 'Datetime'
+ * when displayed.
+ */
+class Timestamp
+{
+public:
+    /**
+     * Nanoseconds since the unix epoch in UTC.
+     */
+    int64_t epoch_nanoseconds = 0;
+
+    /**
+     * Creates a 'Timestamp' at the unix epoch.
+     */
+    Timestamp() = default;
+
+    /**
+     * Creates a 'Timestamp' from nanoseconds since the unix epoch.
+     *
+     * @param epoch_nanoseconds nanoseconds since the unix epoch in UTC.
+     */
+    explicit Timestamp(int64_t epoch_nanoseconds) :
+        epoch_nanoseconds(epoch_nanoseconds) {}
+
+    /**
+     * Creates a 'Timestamp' at the same point in time as 'datetime'.
+     *
+     * @param datetime 'Datetime' to convert. Its 'timezone' is accounted for.
+     */
+    explicit Timestamp(const Datetime& datetime);
+
+    /**
+     * Creates a 'Timestamp' at 'time' on 'date'.
+     *
+     * @param date 'Date' of the 'Timestamp'.
+     * @param time 'Time' of the 'Timestamp'. Its 'timezone' is accounted for.
+     */
+    Timestamp(const Date& date, const Time& time) :
+        Timestamp(Datetime(date, time)) {}
+
+    /**
+     * Creates a 'Timestamp' at the start of 'date'.
+     *
+     * @param date 'Date' of the 'Timestamp'.
+     * @param timezone 'Timezone' 'date' is in. (default Time::get_default_timezone())
+     */
+    explicit Timestamp(const Date& date, Timezone timezone = Time::get_default_timezone()) :
+        Timestamp(Datetime(date.year, date.month, date.day, 0, 0, 0, 0, 0, 0, timezone)) {}
+
+    /**
+     * Creates a 'Timestamp' that matches the current time.
+     *
+     * @return created 'Timestamp'.
+     */
+    static Timestamp now();
+
+    /**
+     * Converts 'this' to a 'Datetime'.
+     *
+     * @param timezone 'Timezone' of the resulting 'Datetime'. (default Time::get_default_timezone())
+     *
+     * @return 'Datetime' at the same point in time as 'this'.
+     */
+    Datetime datetime(Timezone timezone = Time::get_default_timezone()) const;
+
+    /**
+     * Gets the 'Date' of 'this'.
+     *
+     * @param timezone 'Timezone' to get the 'Date' in. (default Time::get_default_timezone())
+     *
+     * @return 'Date' of 'this' in 'timezone'.
+     */
+    Date date(Timezone timezone = Time::get_default_timezone()) const;
+
+    /**
+     * Gets the 'Time' of 'this'.
+     *
+     * @param timezone 'Timezone' to get the 'Time' in. (default Time::get_default_timezone())
+     *
+     * @return 'Time' of 'this' in 'timezone'.
+     */
+    Time time(Timezone timezone = Time::get_default_timezone()) const;
+
+    /**
+     * Adds 'days' to this 'Timestamp'.
+     *
+     * @param days number of days to add to this 'Timestamp'.
+     *
+     * @return reference to this modified 'Timestamp'.
+     */
+    Timestamp& operator+=(const Days& days)
+    {
+        epoch_nanoseconds += days.value * NANOSECONDS_PER_DAY;
+        return *this;
+    }
+
+    /**
+     * Subtracts 'days' from this 'Timestamp'.
+     *
+     * @param days number of days to subtract from this 'Timestamp'.
+     *
+     * @return reference to this modified 'Timestamp'.
+     */
+    Timestamp& operator-=(const Days& days)
+    {
+        epoch_nanoseconds -= days.value * NANOSECONDS_PER_DAY;
+        return *this;
+    }
+
+    /**
+     * Adds 'hours' to this 'Timestamp'.
+     *
+     * @param hours number of hours to add to this 'Timestamp'.
+     *
+     * @return reference to this modified 'Timestamp'.
+     */
+    Timestamp& operator+=(const Hours& hours)
+    {
+        epoch_nanoseconds += hours.value * NANOSECONDS_PER_HOUR;
+        return *this;
+    }
+
+    /**
+     * Subtracts 'hours' from this 'Timestamp'.
+     *
+     * @param hours number of hours to subtract from this 'Timestamp'.
+     *
+     * @return reference to this modified 'Timestamp'.
+     */
+    Timestamp& operator-=(const Hours& hours)
+    {
+        epoch_nanoseconds -= hours.value * NANOSECONDS_PER_HOUR;
+        return *this;
+    }
+
+    /**
+     * Adds 'minutes' to this 'Timestamp'.
+     *
+     * @param minutes number of minutes to add to this 'Timestamp'.
+     *
+     * @return reference to this modified 'Timestamp'.
+     */
+    Timestamp& operator+=(const Minutes& minutes)
+    {
+        epoch_nanoseconds += minutes.value * NANOSECONDS_PER_MINUTE;
+        return *this;
+    }
+
+    /**
+     * Subtracts 'minutes' from this 'Timestamp'.
+     *
+     * @param minutes number of minutes to subtract from this 'Timestamp'.
+     *
+     * @return reference to this modified 'Timestamp'.
+     */
+    Timestamp& operator-=(const Minutes& minutes)
+    {
+        epoch_nanoseconds -= minutes.value * NANOSECONDS_PER_MINUTE;
+        return *this;
+    }
+
+    /**
+     * Adds 'seconds' to this 'Timestamp'.
+     *
+     * @param seconds number of seconds to add to this 'Timestamp'.
+     *
+     * @return reference to this modified 'Timestamp'.
+     */
+    Timestamp& operator+=(const Seconds& seconds)
+    {
+        epoch_nanoseconds += seconds.value * NANOSECONDS_PER_SECOND;
+        return *this;
+    }
+
+    /**
+     * Subtracts 'seconds' from this 'Timestamp'.
+     *
+     * @param seconds number of seconds to subtract from this 'Timestamp'.
+     *
+     * @return reference to this modified 'Timestamp'.
+     */
+    Timestamp& operator-=(const Seconds& seconds)
+    {
+        epoch_nanoseconds -= seconds.value * NANOSECONDS_PER_SECOND;
+        return *this;
+    }
+
+    /**
+     * Adds 'milliseconds' to this 'Timestamp'.
+     *
+     * @param milliseconds number of milliseconds to add to this 'Timestamp'.
+     *
+     * @return reference to this modified 'Timestamp'.
+     */
+    Timestamp& operator+=(const Milliseconds& milliseconds)
+    {
+        epoch_nanoseconds += milliseconds.value * NANOSECONDS_PER_MILLISECOND;
+        return *this;
+    }
+
+    /**
+     * Subtracts 'milliseconds' from this 'Timestamp'.
+     *
+     * @param milliseconds number of milliseconds to subtract from this 'Timestamp'.
+     *
+     * @return reference to this modified 'Timestamp'.
+     */
+    Timestamp& operator-=(const Milliseconds& milliseconds)
+    {
+        epoch_nanoseconds -= milliseconds.value * NANOSECONDS_PER_MILLISECOND;
+        return *this;
+    }
+
+    /**
+     * Adds 'microseconds' to this 'Timestamp'.
+     *
+     * @param microseconds number of microseconds to add to this 'Timestamp'.
+     *
+     * @return reference to this modified 'Timestamp'.
+     */
+    Timestamp& operator+=(const Microseconds& microseconds)
+    {
+        epoch_nanoseconds += microseconds.value * NANOSECONDS_PER_MICROSECOND;
+        return *this;
+    }
+
+    /**
+     * Subtracts 'microseconds' from this 'Timestamp'.
+     *
+     * @param microseconds number of microseconds to subtract from this 'Timestamp'.
+     *
+     * @return reference to this modified 'Timestamp'.
+     */
+    Timestamp& operator-=(const Microseconds& microseconds)
+    {
+        epoch_nanoseconds -= microseconds.value * NANOSECONDS_PER_MICROSECOND;
+        return *this;
+    }
+
+    /**
+     * Adds 'nanoseconds' to this 'Timestamp'.
+     *
+     * @param nanoseconds number of nanoseconds to add to this 'Timestamp'.
+     *
+     * @return reference to this modified 'Timestamp'.
+     */
+    Timestamp& operator+=(const Nanoseconds& nanoseconds)
+    {
+        epoch_nanoseconds += nanoseconds.value;
+        return *this;
+    }
+
+    /**
+     * Subtracts 'nanoseconds' from this 'Timestamp'.
+     *
+     * @param nanoseconds number of nanoseconds to subtract from this 'Timestamp'.
+     *
+     * @return reference to this modified 'Timestamp'.
+     */
+    Timestamp& operator-=(const Nanoseconds& nanoseconds)
+    {
+        epoch_nanoseconds -= nanoseconds.value;
+        return *this;
+    }
+
+    /**
+     * Adds 'time_delta' to this 'Timestamp'.
+     *
+     * @param time_delta the 'TimeDelta' to add to this 'Timestamp'.
+     *
+     * @return reference to this modified 'Timestamp'.
+     */
+    Timestamp& operator+=(const TimeDelta& time_delta)
+    {
+        epoch_nanoseconds += time_delta.total_nanoseconds();
+        return *this;
+    }
+
+    /**
+     * Subtracts 'time_delta' from this 'Timestamp'.
+     *
+     * @param time_delta the 'TimeDelta' to subtract from this 'Timestamp'.
+     *
+     * @return reference to this modified 'Timestamp'.
+     */
+    Timestamp& operator-=(const TimeDelta& time_delta)
+    {
+        epoch_nanoseconds -= time_delta.total_nanoseconds();
+        return *this;
+    }
+
+    /**
+     * Adds 'days' to 'timestamp'.
+     *
+     * @param timestamp the base 'Timestamp' to add 'days' to.
+     * @param days the number of days to add.
+     *
+     * @return a new 'Timestamp' with 'days' added.
+     */
+    friend Timestamp operator+(Timestamp timestamp, const Days& days)
+    {
+        timestamp += days;
+        return timestamp;
+    }
+
+    /**
+     * Subtracts 'days' from 'timestamp'.
+     *
+     * @param timestamp the base 'Timestamp' to subtract 'days' from.
+     * @param days the number of days to subtract.
+     *
+     * @return a new 'Timestamp' with 'days' subtracted.
+     */
+    friend Timestamp operator-(Timestamp timestamp, const Days& days)
+    {
+        timestamp -= days;
+        return timestamp;
+    }
+
+    /**
+     * Adds 'hours' to 'timestamp'.
+     *
+     * @param timestamp the base 'Timestamp' to add 'hours' to.
+     * @param hours the number of hours to add.
+     *
+     * @return a new 'Timestamp' with 'hours' added.
+     */
+    friend Timestamp operator+(Timestamp timestamp, const Hours& hours)
+    {
+        timestamp += hours;
+        return timestamp;
+    }
+
+    /**
+     * Subtracts 'hours' from 'timestamp'.
+     *
+     * @param timestamp the base 'Timestamp' to subtract 'hours' from.
+     * @param hours the number of hours to subtract.
+     *
+     * @return a new 'Timestamp' with 'hours' subtracted.
+     */
+    friend Timestamp operator-(Timestamp timestamp, const Hours& hours)
+    {
+        timestamp -= hours;
+        return timestamp;
+    }
+
+    /**
+     * Adds 'minutes' to 'timestamp'.
+     *
+     * @param timestamp the base 'Timestamp' to add 'minutes' to.
+     * @param minutes the number of minutes to add.
+     *
+     * @return a new 'Timestamp' with 'minutes' added.
+     */
+    friend Timestamp operator+(Timestamp timestamp, const Minutes& minutes)
+    {
+        timestamp += minutes;
+        return timestamp;
+    }
+
+    /**
+     * Subtracts 'minutes' from 'timestamp'.
+     *
+     * @param timestamp the base 'Timestamp' to subtract 'minutes' from.
+     * @param minutes the number of minutes to subtract.
+     *
+     * @return a new 'Timestamp' with 'minutes' subtracted.
+     */
+    friend Timestamp operator-(Timestamp timestamp, const Minutes& minutes)
+    {
+        timestamp -= minutes;
+        return timestamp;
+    }
+
+    /**
+     * Adds 'seconds' to 'timestamp'.
+     *
+     * @param timestamp the base 'Timestamp' to add 'seconds' to.
+     * @param seconds the number of seconds to add.
+     *
+     * @return a new 'Timestamp' with 'seconds' added.
+     */
+    friend Timestamp operator+(Timestamp timestamp, const Seconds& seconds)
+    {
+        timestamp += seconds;
+        return timestamp;
+    }
+
+    /**
+     * Subtracts 'seconds' from 'timestamp'.
+     *
+     * @param timestamp the base 'Timestamp' to subtract 'seconds' from.
+     * @param seconds the number of seconds to subtract.
+     *
+     * @return a new 'Timestamp' with 'seconds' subtracted.
+     */
+    friend Timestamp operator-(Timestamp timestamp, const Seconds& seconds)
+    {
+        timestamp -= seconds;
+        return timestamp;
+    }
+
+    /**
+     * Adds 'milliseconds' to 'timestamp'.
+     *
+     * @param timestamp the base 'Timestamp' to add 'milliseconds' to.
+     * @param milliseconds the number of milliseconds to add.
+     *
+     * @return a new 'Timestamp' with 'milliseconds' added.
+     */
+    friend Timestamp operator+(Timestamp timestamp, const Milliseconds& milliseconds)
+    {
+        timestamp += milliseconds;
+        return timestamp;
+    }
+
+    /**
+     * Subtracts 'milliseconds' from 'timestamp'.
+     *
+     * @param timestamp the base 'Timestamp' to subtract 'milliseconds' from.
+     * @param milliseconds the number of milliseconds to subtract.
+     *
+     * @return a new 'Timestamp' with 'milliseconds' subtracted.
+     */
+    friend Timestamp operator-(Timestamp timestamp, const Milliseconds& milliseconds)
+    {
+        timestamp -= milliseconds;
+        return timestamp;
+    }
+
+    /**
+     * Adds 'microseconds' to 'timestamp'.
+     *
+     * @param timestamp the base 'Timestamp' to add 'microseconds' to.
+     * @param microseconds the number of microseconds to add.
+     *
+     * @return a new 'Timestamp' with 'microseconds' added.
+     */
+    friend Timestamp operator+(Timestamp timestamp, const Microseconds& microseconds)
+    {
+        timestamp += microseconds;
+        return timestamp;
+    }
+
+    /**
+     * Subtracts 'microseconds' from 'timestamp'.
+     *
+     * @param timestamp the base 'Timestamp' to subtract 'microseconds' from.
+     * @param microseconds the number of microseconds to subtract.
+     *
+     * @return a new 'Timestamp' with 'microseconds' subtracted.
+     */
+    friend Timestamp operator-(Timestamp timestamp, const Microseconds& microseconds)
+    {
+        timestamp -= microseconds;
+        return timestamp;
+    }
+
+    /**
+     * Adds 'nanoseconds' to 'timestamp'.
+     *
+     * @param timestamp the base 'Timestamp' to add 'nanoseconds' to.
+     * @param nanoseconds the number of nanoseconds to add.
+     *
+     * @return a new 'Timestamp' with 'nanoseconds' added.
+     */
+    friend Timestamp operator+(Timestamp timestamp, const Nanoseconds& nanoseconds)
+    {
+        timestamp += nanoseconds;
+        return timestamp;
+    }
+
+    /**
+     * Subtracts 'nanoseconds' from 'timestamp'.
+     *
+     * @param timestamp the base 'Timestamp' to subtract 'nanoseconds' from.
+     * @param nanoseconds the number of nanoseconds to subtract.
+     *
+     * @return a new 'Timestamp' with 'nanoseconds' subtracted.
+     */
+    friend Timestamp operator-(Timestamp timestamp, const Nanoseconds& nanoseconds)
+    {
+        timestamp -= nanoseconds;
+        return timestamp;
+    }
+
+    /**
+     * Adds 'time_delta' to 'timestamp'.
+     *
+     * @param timestamp the base 'Timestamp' to add 'time_delta' to.
+     * @param time_delta the 'TimeDelta' to add.
+     *
+     * @return a new 'Timestamp' with 'time_delta' added.
+     */
+    friend Timestamp operator+(Timestamp timestamp, const TimeDelta& time_delta)
+    {
+        timestamp += time_delta;
+        return timestamp;
+    }
+
+    /**
+     * Subtracts 'time_delta' from 'timestamp'.
+     *
+     * @param timestamp the base 'Timestamp' to subtract 'time_delta' from.
+     * @param time_delta the 'TimeDelta' to subtract.
+     *
+     * @return a new 'Timestamp' with 'time_delta' subtracted.
+     */
+    friend Timestamp operator-(Timestamp timestamp, const TimeDelta& time_delta)
+    {
+        timestamp -= time_delta;
+        return timestamp;
+    }
+
+    /**
+     * Subtracts 'other' from 'timestamp'.
+     *
+     * @param timestamp 'Timestamp' 'other' is subtracting from.
+     * @param other 'Timestamp' to subtract from 'timestamp'.
+     *
+     * @return 'TimeDelta' of 'other' subtracted from 'timestamp'.
+     */
+    friend TimeDelta operator-(Timestamp timestamp, Timestamp other);
+
+    /**
+     * Checks if 'this' is greater than 'other'.
+     *
+     * @param other 'Timestamp' to compare to.
+     *
+     * @return 'true' if 'this' is greater than 'other', 'false' otherwise.
+     */
+    bool operator>(Timestamp other) const
+    {
+        return epoch_nanoseconds > other.epoch_nanoseconds;
+    }
+
+    /**
+     * Checks if 'this' is greater than or equal to 'other'.
+     *
+     * @param other 'Timestamp' to compare to.
+     *
+     * @return 'true' if 'this' is greater than or equal to 'other', 'false' otherwise.
+     */
+    bool operator>=(Timestamp other) const
+    {
+        return epoch_nanoseconds >= other.epoch_nanoseconds;
+    }
+
+    /**
+     * Checks if 'this' is less than 'other'.
+     *
+     * @param other 'Timestamp' to compare to.
+     *
+     * @return 'true' if 'this' is less than 'other', 'false' otherwise.
+     */
+    bool operator<(Timestamp other) const
+    {
+        return epoch_nanoseconds < other.epoch_nanoseconds;
+    }
+
+    /**
+     * Checks if 'this' is less than or equal to 'other'.
+     *
+     * @param other 'Timestamp' to compare to.
+     *
+     * @return 'true' if 'this' is less than or equal to 'other', 'false' otherwise.
+     */
+    bool operator<=(Timestamp other) const
+    {
+        return epoch_nanoseconds <= other.epoch_nanoseconds;
+    }
+
+    /**
+     * Checks if 'this' is equal to 'other'.
+     *
+     * @param other 'Timestamp' to compare to.
+     *
+     * @return 'true' if 'this' is equal to 'other', 'false' otherwise.
+     */
+    bool operator==(Timestamp other) const
+    {
+        return epoch_nanoseconds == other.epoch_nanoseconds;
+    }
+
+    /**
+     * Checks if 'this' is not equal to 'other'.
+     *
+     * @param other 'Timestamp' to compare to.
+     *
+     * @return 'true' if 'this' is not equal to 'other', 'false' otherwise.
+     */
+    bool operator!=(Timestamp other) const
+    {
+        return epoch_nanoseconds != other.epoch_nanoseconds;
+    }
+
+    /**
+     * Outputs 'timestamp' into 'os' as a UTC 'Datetime'.
+     *
+     * @param os 'std::ostream' to insert 'timestamp' into.
+     * @param timestamp 'Timestamp' to insert into 'os'.
+     *
+     * @return reference to 'os' after inserting 'timestamp' into 'os'.
+     */
+    friend std::ostream& operator<<(std::ostream& os, const Timestamp& timestamp);
+
+    /**
+     * Nanoseconds in a microsecond.
+     */
+    static constexpr int64_t NANOSECONDS_PER_MICROSECOND = 1'000;
+
+    /**
+     * Nanoseconds in a millisecond.
+     */
+    static constexpr int64_t NANOSECONDS_PER_MILLISECOND = NANOSECONDS_PER_MICROSECOND * 1'000;
+
+    /**
+     * Nanoseconds in a second.
+     */
+    static constexpr int64_t NANOSECONDS_PER_SECOND = NANOSECONDS_PER_MILLISECOND * 1'000;
+
+    /**
+     * Nanoseconds in a minute.
+     */
+    static constexpr int64_t NANOSECONDS_PER_MINUTE = NANOSECONDS_PER_SECOND * 60;
+
+    /**
+     * Nanoseconds in a hour.
+     */
+    static constexpr int64_t NANOSECONDS_PER_HOUR = NANOSECONDS_PER_MINUTE * 60;
+
+    /**
+     * Nanoseconds in a day.
+     */
+    static constexpr int64_t NANOSECONDS_PER_DAY = NANOSECONDS_PER_HOUR * 24;
+};
+
+static_assert(sizeof(Timestamp) == sizeof(int64_t));
+static_assert(std::is_trivially_copyable_v<Timestamp>);
+
+inline size_t hash_value(const Timestamp& timestamp)
+{
+    return static_cast<size_t>(timestamp.epoch_nanoseconds);
+}
+
+namespace std
+{
+template<>
+struct hash<Timestamp>
+{
+    size_t operator()(const Timestamp& timestamp) const
+    {
+        return hash_value(timestamp);
+    }
+};
+}
+
+#endif //DATETIME_TIMESTAMP_H
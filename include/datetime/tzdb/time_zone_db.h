@@ -0,0 +1,125 @@
+#ifndef DATETIME_TIME_ZONE_DB_H
+#define DATETIME_TIME_ZONE_DB_H
+
+#include "datetime/tzdb/zone_info.h"
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+/**
+ * IANA time zone database read from a directory of TZif files, such as the system's
+ * '/usr/share/zoneinfo' or a copy bundled with an application.
+ *
+ * Zones are loaded the first time they are asked for, by memory mapping their file, and kept
+ * until the database is destroyed. Loading is thread safe, and the loaded 'ZoneInfos' are
+ * immutable, so they can be used from any thread.
+ *
+ * @code
+ * TimeZoneDB& db = TimeZoneDB::system();
+ *
+ * // 2023-03-12 01:30 in New York, in London
+ * Datetime london = db.convert(Datetime(2023, 3, 12, 1, 30, 0, 0, 0, 0, TZ::EST),
+ *                              "Europe/London");
+ *
+ * // 2023-11-05 01:30 wall clock time in New York, in Chicago
+ * Datetime chicago = db.convert_local(Datetime(2023, 11, 5, 1, 30),
+ *                                     "America/New_York", "America/Chicago");
+ * @endcode
+ */
+class TimeZoneDB
+{
+public:
+    /**
+     * Creates a database that reads zones from 'directory'.
+     *
+     * @param directory directory holding TZif files, named by zone, such as
+     * "<directory>/America/New_York".
+     */
+    explicit TimeZoneDB(std::string directory);
+
+    TimeZoneDB(const TimeZoneDB&) = delete;
+    TimeZoneDB& operator=(const TimeZoneDB&) = delete;
+
+    /**
+     * Gets the database of the system's zoneinfo directory: '$TZDIR' if it is set, otherwise
+     * '/usr/share/zoneinfo'.
+     *
+     * @return the system database.
+     */
+    static TimeZoneDB& system();
+
+    /**
+     * Gets the directory zones are read from.
+     *
+     * @return the directory the database was created with.
+     */
+    const std::string& get_directory() const;
+
+    /**
+     * Gets the zone named 'name', loading it if it has not been already.
+     *
+     * @param name name of the zone, such as "America/New_York".
+     *
+     * @return the zone, which lives as long as the database.
+     *
+     * @throws std::invalid_argument if there is no zone named 'name'.
+     * @throws std::runtime_error if the zone's file is not a valid TZif file.
+     */
+    const ZoneInfo& get(std::string_view name);
+
+    /**
+     * Converts 'instant' to the local time of the zone named 'to_zone'.
+     *
+     * @param instant instant to convert. Its 'timezone' is accounted for.
+     * @param to_zone name of the zone to convert to.
+     *
+     * @return the same instant, with the 'Timezone' in effect in 'to_zone' at that instant.
+     *
+     * @throws std::invalid_argument if there is no zone named 'to_zone', or its offset is not a
+     * whole number of minutes.
+     */
+    Datetime convert(const Datetime& instant, std::string_view to_zone);
+
+    /**
+     * Converts the local time 'local' of the zone named 'from_zone' to the local time of the zone
+     * named 'to_zone'.
+     *
+     * @param local local time in 'from_zone'. Its 'timezone' is ignored.
+     * @param from_zone name of the zone of 'local'.
+     * @param to_zone name of the zone to convert to.
+     *
+     * @return the same instant, with the 'Timezone' in effect in 'to_zone' at that instant.
+     *
+     * @throws std::invalid_argument if either zone does not exist, or an offset is not a whole
+     * number of minutes.
+     *
+     * @see ZoneInfo::from_local
+     */
+    Datetime convert_local(const Datetime& local, std::string_view from_zone,
+                           std::string_view to_zone);
+
+private:
+    /**
+     * Reads and parses the zone named 'name'.
+     */
+    std::unique_ptr<ZoneInfo> load(std::string_view name) const;
+
+    /**
+     * Directory zones are read from.
+     */
+    std::string directory;
+
+    /**
+     * Guards 'zones'.
+     */
+    std::mutex mutex;
+
+    /**
+     * Zones loaded so far, by name.
+     */
+    std::map<std::string, std::unique_ptr<ZoneInfo>, std::less<>> zones;
+};
+
+#endif //DATETIME_TIME_ZONE_DB_H
@@ -0,0 +1,189 @@
+#ifndef DATETIME_ZONE_CONVERTER_H
+#define DATETIME_ZONE_CONVERTER_H
+
+#include "datetime/timestamp/timestamp.h"
+#include "datetime/tzdb/zone_info.h"
+#include <cstdint>
+#include <span>
+
+/**
+ * Converts local times of one zone to local times of another, remembering the interval each
+ * zone's offset last held over.
+ *
+ * Local times are 'Timestamps' of the wall clock time, as if it were UTC. Each conversion goes
+ * from the local time in 'from' to UTC and from UTC to the local time in 'to'. A time inside
+ * both remembered intervals converts with a compare and an add for each zone. Only a time
+ * outside one of them looks the zone's rules up, and then remembers the interval it is in.
+ * Sorted or clustered times, such as a column of a time series, almost always hit.
+ *
+ * A 'ZoneConverter' is not thread safe. Use one per thread.
+ *
+ * @code
+ * TimeZoneDB& db = TimeZoneDB::system();
+ * ZoneConverter converter = ZoneConverter(db.get("America/New_York"), db.get("Europe/London"));
+ * converter.convert(new_york_times, london_times);
+ * double hit_rate = converter.get_stats().hit_rate();
+ * @endcode
+ */
+class ZoneConverter
+{
+public:
+    /**
+     * Counts of conversions that used the remembered intervals, and that did not.
+     */
+    struct Stats
+    {
+        /**
+         * Conversions of times inside both remembered intervals.
+         */
+        uint64_t hits = 0;
+
+        /**
+         * Conversions that looked up the rules of either zone.
+         */
+        uint64_t misses = 0;
+
+        /**
+         * Gets the fraction of conversions that were hits.
+         *
+         * @return 'hits' divided by all conversions, or 0 if there were none.
+         */
+        double hit_rate() const
+        {
+            uint64_t total = hits + misses;
+            return total == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(total);
+        }
+    };
+
+    /**
+     * Creates a 'ZoneConverter' from local times of 'from' to local times of 'to'.
+     *
+     * @param from zone of the times to convert. Must outlive the 'ZoneConverter'.
+     * @param to zone to convert the times to. Must outlive the 'ZoneConverter'.
+     */
+    ZoneConverter(const ZoneInfo& from, const ZoneInfo& to);
+
+    /**
+     * Creates a 'ZoneConverter' from local times of 'from' to local times of 'to', each of which
+     * has a fixed offset.
+     *
+     * @param from 'Timezone' of the times to convert.
+     * @param to 'Timezone' to convert the times to.
+     */
+    ZoneConverter(Timezone from, Timezone to);
+
+    /**
+     * Converts the local time 'local' of 'from' to the local time of 'to'.
+     *
+     * @param local local time in 'from'.
+     *
+     * @return the local time in 'to' at the same instant.
+     *
+     * @see ZoneInfo::local_to_utc for local times that happen never or twice.
+     */
+    Timestamp convert(Timestamp local);
+
+    /**
+     * Converts each local time of 'from' in 'local' to the local time of 'to', into 'out'.
+     *
+     * @param local local times in 'from'.
+     * @param out set to the local times in 'to'. May be 'local' itself.
+     *
+     * @throws std::invalid_argument if 'out' and 'local' are not the same size.
+     */
+    void convert(std::span<const Timestamp> local, std::span<Timestamp> out);
+
+    /**
+     * Converts each local time of 'from' in 'local' to the local time of 'to', into 'out'.
+     *
+     * @param local local times in 'from'.
+     * @param from 'Timezone' of 'local'.
+     * @param to 'Timezone' to convert to.
+     * @param out set to the local times in 'to'. May be 'local' itself.
+     *
+     * @return the counts of hits and misses of the conversion.
+     *
+     * @throws std::invalid_argument if 'out' and 'local' are not the same size.
+     */
+    static Stats convert(std::span<const Timestamp> local, Timezone from, Timezone to,
+                         std::span<Timestamp> out);
+
+    /**
+     * Gets the counts of hits and misses since creation or the last 'reset_stats'.
+     *
+     * @return the counts of hits and misses.
+     */
+    const Stats& get_stats() const;
+
+    /**
+     * Sets the counts of hits and misses back to 0.
+     */
+    void reset_stats();
+
+private:
+    /**
+     * Remembered interval of one zone, in nanoseconds, over which its offset does not change.
+     */
+    struct Cache
+    {
+        /**
+         * First nanosecond of the interval.
+         */
+        int64_t begin = 0;
+
+        /**
+         * Length of the interval in nanoseconds. 0 until a zone's interval is looked up.
+         */
+        uint64_t length = 0;
+
+        /**
+         * Nanoseconds to add to convert a time inside the interval.
+         */
+        int64_t add = 0;
+
+        /**
+         * Checks if 'nanoseconds' is inside the interval.
+         */
+        bool contains(int64_t nanoseconds) const
+        {
+            return static_cast<uint64_t>(nanoseconds) - static_cast<uint64_t>(begin) < length;
+        }
+    };
+
+    /**
+     * Converts 'local' from 'from' to UTC, looking its interval up.
+     */
+    int64_t miss_from(int64_t local);
+
+    /**
+     * Converts 'utc' to local time in 'to', looking its interval up.
+     */
+    int64_t miss_to(int64_t utc);
+
+    /**
+     * Zone of the times to convert, or 'nullptr' for a fixed offset.
+     */
+    const ZoneInfo* from = nullptr;
+
+    /**
+     * Zone to convert to, or 'nullptr' for a fixed offset.
+     */
+    const ZoneInfo* to = nullptr;
+
+    /**
+     * Interval of local times of 'from' last converted, adding its offset to get UTC.
+     */
+    Cache from_cache;
+
+    /**
+     * Interval of UTC times last converted to 'to', adding its offset to get local time.
+     */
+    Cache to_cache;
+
+    /**
+     * Counts of hits and misses.
+     */
+    Stats stats;
+};
+
+#endif //DATETIME_ZONE_CONVERTER_H
@@ -0,0 +1,293 @@
+#ifndef DATETIME_ZONE_INFO_H
+#define DATETIME_ZONE_INFO_H
+
+#include "datetime/datetime/datetime.h"
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * Rules of one IANA time zone, such as "America/New_York": every change of its UTC offset,
+ * including daylight saving time, parsed from a TZif file.
+ *
+ * Transitions past the end of the file's table are generated from the POSIX TZ rule in its
+ * footer, up to the end of 2100, so every instant the library can represent is covered by the
+ * table.
+ *
+ * Looking up the offset at an instant takes constant time however long the zone's history is.
+ * The instants from 1970 on are split into buckets of 2^24 seconds, about 194 days, each
+ * holding the index of the first transition after its start. A lookup goes to its bucket and
+ * steps over the few transitions left before the instant.
+ *
+ * @code
+ * const ZoneInfo& new_york = TimeZoneDB::system().get("America/New_York");
+ * Datetime local = new_york.to_local(Datetime(2023, 7, 1, 12, 0, 0, 0, 0, 0, TZ::UTC));
+ * // local is 2023-07-01 08:00 with TZ::EDT
+ * @endcode
+ */
+class ZoneInfo
+{
+public:
+    /**
+     * UTC offset in effect at an instant.
+     */
+    struct Offset
+    {
+        /**
+         * The difference in seconds between UTC and the local time. Positive west of UTC, like
+         * 'Timezone::utc_offset_minutes'.
+         */
+        int32_t utc_offset_seconds;
+
+        /**
+         * Whether daylight saving time is in effect.
+         */
+        bool is_dst;
+
+        /**
+         * Abbreviation of the local time, such as "EDT". Refers into the 'ZoneInfo' it came from.
+         */
+        std::string_view abbreviation;
+
+        /**
+         * Gets the 'Timezone' with this offset.
+         *
+         * @return 'Timezone' whose 'utc_offset_minutes' is 'utc_offset_seconds' in minutes.
+         *
+         * @throws std::invalid_argument if 'utc_offset_seconds' is not a whole number of minutes,
+         * as in some zones' local mean time before 1900.
+         */
+        Timezone get_timezone() const;
+    };
+
+    /**
+     * Span of time over which a zone's UTC offset does not change.
+     */
+    struct Interval
+    {
+        /**
+         * First second of the interval, or 'INT64_MIN' if it has no start.
+         */
+        int64_t begin;
+
+        /**
+         * Second after the last of the interval, or 'INT64_MAX' if it has no end.
+         */
+        int64_t end;
+
+        /**
+         * The difference in seconds between UTC and the local time over the interval. Positive
+         * west of UTC, like 'Timezone::utc_offset_minutes'.
+         */
+        int32_t utc_offset_seconds;
+    };
+
+    /**
+     * Parses the contents of a TZif file, as described in RFC 8536.
+     *
+     * Reads the 64 bit data of version 2 and later files, and the 32 bit data of version 1
+     * files. Leap second records are ignored.
+     *
+     * @param name name of the zone, such as "America/New_York".
+     * @param data contents of the TZif file.
+     *
+     * @return the parsed 'ZoneInfo'.
+     *
+     * @throws std::runtime_error if 'data' is not a valid TZif file.
+     */
+    static ZoneInfo from_tzif(std::string name, std::string_view data);
+
+    /**
+     * Gets the name of the zone.
+     *
+     * @return name the zone was created with.
+     */
+    const std::string& get_name() const;
+
+    /**
+     * Gets the UTC offset in effect at an instant.
+     *
+     * @param utc_seconds seconds since the unix epoch in UTC.
+     *
+     * @return the offset in effect at 'utc_seconds'.
+     */
+    Offset offset_at(int64_t utc_seconds) const;
+
+    /**
+     * Gets the UTC offset in effect at 'instant'.
+     *
+     * @param instant instant to get the offset at. Its 'timezone' is accounted for.
+     *
+     * @return the offset in effect at 'instant'.
+     */
+    Offset offset_at(const Datetime& instant) const;
+
+    /**
+     * Gets the span of UTC time around an instant over which the offset stays the same.
+     *
+     * @param utc_seconds seconds since the unix epoch in UTC.
+     *
+     * @return the interval containing 'utc_seconds', in seconds since the unix epoch in UTC.
+     */
+    Interval interval_at(int64_t utc_seconds) const;
+
+    /**
+     * Gets the span of local time around a local time over which every local time happens
+     * exactly once, with the same offset.
+     *
+     * @param local_seconds local time in this zone, in seconds since the unix epoch.
+     *
+     * @return the interval containing 'local_seconds', in local seconds since the unix epoch.
+     * Empty, with the offset 'local_to_utc' uses, if 'local_seconds' happens never or twice.
+     */
+    Interval local_interval_at(int64_t local_seconds) const;
+
+    /**
+     * Converts a local time in this zone to UTC.
+     *
+     * A local time that happens twice, when the clocks go back, is taken as the first of the
+     * two. A local time that never happens, when the clocks go forward, is taken with the offset
+     * from before the change, so it lands after the change by the length of the gap.
+     *
+     * @param local_seconds local time in this zone, in seconds since the unix epoch.
+     *
+     * @return seconds since the unix epoch in UTC.
+     */
+    int64_t local_to_utc(int64_t local_seconds) const;
+
+    /**
+     * Converts 'instant' to the local time of this zone.
+     *
+     * @param instant instant to convert. Its 'timezone' is accounted for.
+     *
+     * @return the same instant, with the 'Timezone' in effect in this zone at that instant.
+     *
+     * @throws std::invalid_argument if the zone's offset is not a whole number of minutes.
+     */
+    Datetime to_local(const Datetime& instant) const;
+
+    /**
+     * Interprets the components of 'local' as a local time of this zone.
+     *
+     * @param local local time. Its 'timezone' is ignored.
+     *
+     * @return 'local', with the 'Timezone' in effect in this zone at that time. Changed as
+     * described in 'local_to_utc' if 'local' happens never or twice.
+     *
+     * @throws std::invalid_argument if the zone's offset is not a whole number of minutes.
+     */
+    Datetime from_local(const Datetime& local) const;
+
+private:
+    /**
+     * One local time type of the zone.
+     */
+    struct Type
+    {
+        /**
+         * The difference in seconds between UTC and the local time, positive west of UTC.
+         */
+        int32_t utc_offset_seconds;
+
+        /**
+         * Whether daylight saving time is in effect.
+         */
+        bool is_dst;
+
+        /**
+         * Index of the abbreviation in 'abbreviations'.
+         */
+        uint8_t abbreviation;
+    };
+
+    /**
+     * Bits of the seconds since the unix epoch below a bucket's index.
+     */
+    static constexpr int BUCKET_SHIFT = 24;
+
+    /**
+     * Number of buckets, enough to cover every unsigned 32 bit second.
+     */
+    static constexpr size_t BUCKETS = size_t(1) << (32 - BUCKET_SHIFT);
+
+    /**
+     * Last instant transitions are generated up to: the end of 2100.
+     */
+    static constexpr int64_t LAST_SECOND = 4'133'980'799;
+
+    /**
+     * Creates an empty 'ZoneInfo' named 'name'.
+     */
+    explicit ZoneInfo(std::string name);
+
+    /**
+     * Gets the number of transitions at or before 'utc_seconds'.
+     */
+    size_t transition_index(int64_t utc_seconds) const;
+
+    /**
+     * Gets the index of the type in effect at 'utc_seconds'.
+     */
+    uint8_t type_at(int64_t utc_seconds) const;
+
+    /**
+     * Gets the offset in seconds in effect after 'transition' transitions.
+     */
+    int32_t offset_after(size_t transition) const;
+
+    /**
+     * Gets the index of the type with the given values, adding it if there is none.
+     */
+    uint8_t find_or_add_type(int32_t utc_offset_seconds, bool is_dst,
+                             std::string_view abbreviation);
+
+    /**
+     * Generates transitions from the POSIX TZ rule 'rule', up to 'LAST_SECOND'.
+     *
+     * @throws std::runtime_error if 'rule' is not a valid POSIX TZ rule.
+     */
+    void extend(std::string_view rule);
+
+    /**
+     * Fills 'buckets' from 'transitions'.
+     */
+    void index();
+
+    /**
+     * Makes the 'Offset' of the type at 'type'.
+     */
+    Offset make_offset(uint8_t type) const;
+
+    /**
+     * Name of the zone.
+     */
+    std::string name;
+
+    /**
+     * Instants the offset changes at, in ascending seconds since the unix epoch in UTC.
+     */
+    std::vector<int64_t> transitions;
+
+    /**
+     * Index in 'types' of the type in effect from each transition on.
+     */
+    std::vector<uint8_t> transition_types;
+
+    /**
+     * Local time types. The first is in effect before the first transition.
+     */
+    std::vector<Type> types;
+
+    /**
+     * Abbreviations of the types, each ended by a null character.
+     */
+    std::string abbreviations;
+
+    /**
+     * For each bucket, the number of transitions at or before its first second.
+     */
+    std::vector<uint32_t> buckets;
+};
+
+#endif //DATETIME_ZONE_INFO_H
@@ -0,0 +1,23 @@
+#ifndef DATETIME_UNCHECKED_H
+#define DATETIME_UNCHECKED_H
+
+/**
+ * Tag selecting the constructors that skip validation.
+ *
+ * Only pass it with values that are already known to be valid, such as ones read back from
+ * another 'Date', 'Time' or 'Datetime'.
+ *
+ * @example
+ * Datetime datetime = Datetime(UNCHECKED, 2000, 1, 2, 3, 4, 5, 6, 7, 8, TZ::UTC);
+ */
+struct Unchecked
+{
+    explicit Unchecked() = default;
+};
+
+/**
+ * Instance of 'Unchecked' to pass to the constructors that skip validation.
+ */
+inline constexpr Unchecked UNCHECKED = Unchecked();
+
+#endif //DATETIME_UNCHECKED_H
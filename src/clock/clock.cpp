@@ -0,0 +1,135 @@
+#include "datetime/clock/clock.h"
+
+#if defined(__x86_64__)
+#include <cpuid.h>
+#include <x86intrin.h>
+#endif
+
+namespace
+{
+/**
+ * Conversion from time stamp counter ticks to nanoseconds since the unix epoch.
+ */
+struct TscCalibration
+{
+    /**
+     * Whether the processor has an invariant TSC that can be read.
+     */
+    bool available = false;
+
+    /**
+     * Counter value at 'nanoseconds'.
+     */
+    uint64_t ticks = 0;
+
+    /**
+     * Nanoseconds since the unix epoch at 'ticks'.
+     */
+    int64_t nanoseconds = 0;
+
+    /**
+     * Nanoseconds per tick, in fixed point with 'SHIFT' fractional bits.
+     */
+    uint64_t multiplier = 0;
+
+    /**
+     * Fractional bits of 'multiplier'.
+     */
+    static constexpr int SHIFT = 32;
+};
+
+#if defined(__x86_64__)
+/**
+ * Reads the counter and the system clock at as close to the same moment as possible.
+ *
+ * The counter is read on both sides of the system clock and averaged, so the pair is off by at
+ * most half the time the system clock took to read.
+ *
+ * @param ticks set to the counter value.
+ * @param nanoseconds set to the system clock's time.
+ */
+void sample(uint64_t& ticks, int64_t& nanoseconds)
+{
+    uint64_t before = __rdtsc();
+    nanoseconds = Clock::system();
+    uint64_t after = __rdtsc();
+    ticks = before + (after - before) / 2;
+}
+#endif
+
+/**
+ * Measures the rate of the time stamp counter against the system clock.
+ *
+ * @return the calibration, with 'available' false if the processor has no invariant TSC.
+ */
+TscCalibration calibrate()
+{
+    TscCalibration calibration;
+#if defined(__x86_64__)
+    // An invariant TSC ticks at a constant rate in every power state, which is required to use
+    // it as a clock. Reported in bit 8 of EDX of CPUID leaf 0x80000007.
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) || !(edx & (1 << 8)))
+        return calibration;
+
+    uint64_t start_ticks, end_ticks;
+    int64_t start_nanoseconds, end_nanoseconds;
+    sample(start_ticks, start_nanoseconds);
+    do
+        sample(end_ticks, end_nanoseconds);
+    while (end_nanoseconds - start_nanoseconds < 20'000'000);
+
+    if (end_ticks <= start_ticks)
+        return calibration;
+
+    calibration.available = true;
+    calibration.ticks = end_ticks;
+    calibration.nanoseconds = end_nanoseconds;
+    calibration.multiplier = static_cast<uint64_t>(
+        (static_cast<unsigned __int128>(end_nanoseconds - start_nanoseconds)
+         << TscCalibration::SHIFT) / (end_ticks - start_ticks));
+#endif
+    return calibration;
+}
+
+/**
+ * Gets the calibration, measuring it on the first call.
+ *
+ * @return the calibration of the time stamp counter.
+ */
+const TscCalibration& calibration()
+{
+    static const TscCalibration calibration = calibrate();
+    return calibration;
+}
+}
+
+void Clock::set_source(Source new_source)
+{
+    if (new_source == &Clock::tsc)
+        calibration();
+
+    source.store(new_source, std::memory_order_relaxed);
+}
+
+int64_t Clock::tsc()
+{
+#if defined(__x86_64__)
+    const TscCalibration& tsc = calibration();
+    if (tsc.available)
+    {
+        // Signed, so reads on a core whose counter is slightly behind the calibrating one's
+        // still work.
+        int64_t ticks = static_cast<int64_t>(__rdtsc() - tsc.ticks);
+        return tsc.nanoseconds
+               + static_cast<int64_t>((static_cast<__int128>(ticks) * tsc.multiplier)
+                                      >> TscCalibration::SHIFT);
+    }
+#endif
+    return system();
+}
+
+bool Clock::tsc_available()
+{
+    return calibration().available;
+}
@@ -0,0 +1,119 @@
+#include "datetime/clock/coarse_clock.h"
+#include "datetime/timestamp/timestamp.h"
+#include "../util/macros.h"
+#include <bit>
+#include <chrono>
+#include <cstring>
+#include <fmt/format.h>
+#include <stdexcept>
+
+CoarseClock::CoarseClock(Milliseconds interval, Timezone timezone) :
+    CoarseClock(interval.value * Timestamp::NANOSECONDS_PER_MILLISECOND, timezone) {}
+
+CoarseClock::CoarseClock(Microseconds interval, Timezone timezone) :
+    CoarseClock(interval.value * Timestamp::NANOSECONDS_PER_MICROSECOND, timezone) {}
+
+CoarseClock::CoarseClock(int64_t interval_nanoseconds, Timezone timezone) :
+    interval_nanoseconds(interval_nanoseconds),
+    timezone(timezone)
+{
+    ASSERT(interval_nanoseconds > 0,
+           std::invalid_argument(fmt::format("Interval must be positive, got {}ns",
+                                             interval_nanoseconds)));
+
+    refresh();
+    thread = std::thread(&CoarseClock::run, this);
+}
+
+CoarseClock::~CoarseClock()
+{
+    {
+        std::lock_guard lock = std::lock_guard(mutex);
+        stop = true;
+    }
+    stopped.notify_one();
+    thread.join();
+}
+
+Datetime CoarseClock::now() const
+{
+    return load().datetime;
+}
+
+std::string CoarseClock::to_string() const
+{
+    Snapshot snapshot = load();
+    return std::string(snapshot.string.data(), snapshot.length);
+}
+
+std::to_chars_result CoarseClock::to_chars(char* first, char* last) const
+{
+    Snapshot snapshot = load();
+    if (last - first < snapshot.length)
+        return {last, std::errc::value_too_large};
+
+    // A copy of constant length compiles to a few vector moves, which is much faster than one of
+    // variable length. The bytes after the string are left unspecified, as 'std::to_chars' does.
+    if (last - first >= static_cast<ptrdiff_t>(snapshot.string.size()))
+        std::memcpy(first, snapshot.string.data(), snapshot.string.size());
+    else
+        std::memcpy(first, snapshot.string.data(), snapshot.length);
+    return {first + snapshot.length, std::errc()};
+}
+
+Timezone CoarseClock::get_timezone() const
+{
+    return timezone;
+}
+
+void CoarseClock::refresh()
+{
+    int64_t now = Clock::now();
+
+    Snapshot snapshot = {Timestamp(now).datetime(timezone), {}, 0};
+    char* end = snapshot.datetime.to_chars(snapshot.string.data(),
+                                           snapshot.string.data() + snapshot.string.size()).ptr;
+    snapshot.length = static_cast<uint8_t>(end - snapshot.string.data());
+
+    std::array<uint64_t, SNAPSHOT_WORDS> buffer{};
+    std::memcpy(buffer.data(), &snapshot, sizeof(Snapshot));
+
+    // Only this thread writes, so the sequence can be bumped with plain stores. The fence keeps
+    // the words from being written before readers can see the sequence is odd.
+    uint64_t start = sequence.load(std::memory_order_relaxed);
+    sequence.store(start + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    for (size_t i = 0; i < SNAPSHOT_WORDS; i++)
+        words[i].store(buffer[i], std::memory_order_relaxed);
+    sequence.store(start + 2, std::memory_order_release);
+
+    nanoseconds.store(now, std::memory_order_release);
+}
+
+CoarseClock::Snapshot CoarseClock::load() const
+{
+    std::array<uint64_t, SNAPSHOT_WORDS> buffer;
+    uint64_t before, after;
+    do
+    {
+        before = sequence.load(std::memory_order_acquire);
+        for (size_t i = 0; i < SNAPSHOT_WORDS; i++)
+            buffer[i] = words[i].load(std::memory_order_relaxed);
+        // Keeps the words from being read after the sequence is checked again.
+        std::atomic_thread_fence(std::memory_order_acquire);
+        after = sequence.load(std::memory_order_relaxed);
+    }
+    while (before != after || before % 2 != 0);
+
+    std::array<char, sizeof(Snapshot)> bytes;
+    std::memcpy(bytes.data(), buffer.data(), sizeof(Snapshot));
+    return std::bit_cast<Snapshot>(bytes);
+}
+
+void CoarseClock::run()
+{
+    std::unique_lock lock = std::unique_lock(mutex);
+    while (!stopped.wait_for(lock, std::chrono::nanoseconds(interval_nanoseconds),
+                             [this] { return stop; }))
+        refresh();
+}
@@ -18,7 +18,7 @@ struct Component
      *
      * @param value value to have the newly created 'Component' set to.
      */
-    explicit Component(int64_t value) :
+    explicit constexpr Component(int64_t value) :
         value(value) {}
 };
 
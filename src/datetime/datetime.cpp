@@ -2,557 +2,277 @@
 
 #include "datetime/datetime/datetime.h"
 #include "datetime/timedelta/timedelta.h"
+#include "../util/parse.h"
+#include <array>
 
-Datetime Datetime::now(uint8_t  day_offset, uint8_t hour_offset, uint8_t minute_offset,
-                       uint8_t second_offset, uint16_t millisecond_offset,
-                       uint16_t microsecond_offset, uint16_t nanosecond_offset, Timezone timezone)
-{
-    return Datetime(Date::today(day_offset, timezone),
-                    Time::now(hour_offset, minute_offset, second_offset, millisecond_offset,
-                              microsecond_offset, nanosecond_offset, timezone));
-}
-
-int64_t Datetime::add_hours(int64_t hours_to_add)
-{
-    int64_t day_change = Time::add_hours(hours_to_add);
-
-    if (day_change > 0)
-        add_days(day_change);
-    if (day_change < 0)
-        subtract_days(-day_change);
-
-    return day_change;
-}
-
-Date Datetime::date() const
-{
-    return Date(year, month, day);
-}
-
-Time Datetime::time() const
-{
-    return Time(hour, minute, second, millisecond, microsecond, nanosecond, timezone);
-}
-
-
-bool Datetime::operator>(Datetime other) const
-{
-    other.set_timezone(timezone);
-
-    return Date::operator>(other.date())
-        || Date::operator==(other.date()) && Time::operator>(other.time());
-}
-
-bool Datetime::operator>=(Datetime other) const
-{
-    other.set_timezone(timezone);
-
-    return Date::operator>(other.date())
-        || Date::operator==(other.date()) && Time::operator>=(other.time());
-}
-
-bool Datetime::operator<(Datetime other) const
-{
-    other.set_timezone(timezone);
-
-    return Date::operator<(other.date())
-        || Date::operator==(other.date()) && Time::operator<(other.time());
-}
-
-bool Datetime::operator<=(Datetime other) const
-{
-    other.set_timezone(timezone);
-
-    return Date::operator<(other.date())
-        || Date::operator==(other.date()) && Time::operator<=(other.time());
-}
-
-bool Datetime::operator==(Datetime other) const
-{
-    other.set_timezone(timezone);
-
-    return Date::operator==(other.date()) && Time::operator==(other.time());
-}
-
-bool Datetime::operator!=(Datetime other) const
-{
-    other.set_timezone(timezone);
-
-    return Date::operator!=(other.date()) || Time::operator!=(other.time());
-}
-
-Datetime &Datetime::operator+=(const Days& days)
-{
-    Date::operator+=(days);
-    return *this;
-}
-
-Datetime &Datetime::operator-=(const Days& days)
-{
-    Date::operator-=(days);
-    return *this;
-}
-
-Datetime &Datetime::operator+=(const Hours& hours)
-{
-    Time::operator+=(hours);
-    return *this;
-}
-
-Datetime &Datetime::operator-=(const Hours& hours)
-{
-    Time::operator-=(hours);
-    return *this;
-}
-
-Datetime &Datetime::operator+=(const Minutes& minutes)
-{
-    Time::operator+=(minutes);
-    return *this;
-}
-
-Datetime &Datetime::operator-=(const Minutes& minutes)
-{
-    Time::operator-=(minutes);
-    return *this;
-}
-
-Datetime &Datetime::operator+=(const Seconds& seconds)
-{
-    Time::operator+=(seconds);
-    return *this;
-}
-
-Datetime &Datetime::operator-=(const Seconds& seconds)
-{
-    Time::operator-=(seconds);
-    return *this;
-}
-
-Datetime &Datetime::operator+=(const Milliseconds& milliseconds)
-{
-    Time::operator+=(milliseconds);
-    return *this;
-}
-
-Datetime &Datetime::operator-=(const Milliseconds& milliseconds)
-{
-    Time::operator-=(milliseconds);
-    return *this;
-}
-
-Datetime &Datetime::operator+=(const Microseconds& microseconds)
-{
-    Time::operator+=(microseconds);
-    return *this;
-}
-
-Datetime &Datetime::operator-=(const Microseconds& microseconds)
-{
-    Time::operator-=(microseconds);
-    return *this;
-}
-
-Datetime &Datetime::operator+=(const Nanoseconds& nanoseconds)
-{
-    Time::operator+=(nanoseconds);
-    return *this;
-}
-
-Datetime &Datetime::operator-=(const Nanoseconds& nanoseconds)
-{
-    Time::operator-=(nanoseconds);
-    return *this;
-}
-
-Datetime &Datetime::operator++()
+namespace
 {
-    Date::operator++();
-    return *this;
-}
-
-Datetime &Datetime::operator--()
+/**
+ * Calendar day a thread last read the time in, for one timezone.
+ */
+struct CachedDay
 {
-    Date::operator--();
-    return *this;
-}
+    /**
+     * Local nanoseconds since the unix epoch at the start of the day.
+     */
+    int64_t start = INT64_MIN;
 
-std::string Datetime::to_string(TimeComponent include_to,
-                                char delim_date,
-                                char delim_date_and_time,
-                                char delim_h_m_s,
-                                char delim_ms_us_ns,
-                                char delim_tz) const
-{
-    return
-      Date::to_string(delim_date)
-    + delim_date_and_time
-    + Time::to_string(include_to, delim_h_m_s, delim_ms_us_ns, delim_tz);
-}
+    /**
+     * Date of the day.
+     */
+    Date date;
+};
 
-std::ostream& operator<<(std::ostream& os, const Datetime& datetime)
-{
-    return os << datetime.to_string();
+/**
+ * Days cached by 'Datetime::now', one per UTC offset, so callers that read the time in a few
+ * timezones do not evict each other's day.
+ */
+thread_local std::array<CachedDay, 128> cached_days;
 }
 
-Datetime Datetime::from_ms(size_t timestamp, Timezone to_timezone, Timezone from_timezone)
+Datetime Datetime::now(uint8_t  day_offset, uint8_t hour_offset, uint8_t minute_offset,
+                       uint8_t second_offset, uint16_t millisecond_offset,
+                       uint16_t microsecond_offset, uint16_t nanosecond_offset, Timezone timezone)
 {
-    // Year.
-    uint16_t year = 1970;  // Unix epoch year.
-    while (timestamp >= MILLISECONDS_PER_NON_LEAP_YEAR)
+    // 'utc_offset_minutes' is the minutes behind UTC, so subtract it to get from UTC to
+    // 'timezone'.
+    int64_t nanoseconds = Clock::now()
+                          + day_offset * NANOSECONDS_PER_DAY
+                          - timezone.utc_offset_minutes
+                            * static_cast<int64_t>(NANOSECONDS_PER_MINUTE)
+                          + hour_offset * static_cast<int64_t>(NANOSECONDS_PER_HOUR)
+                          + minute_offset * static_cast<int64_t>(NANOSECONDS_PER_MINUTE)
+                          + second_offset * static_cast<int64_t>(NANOSECONDS_PER_SECOND)
+                          + millisecond_offset * static_cast<int64_t>(NANOSECONDS_PER_MILLISECOND)
+                          + microsecond_offset * static_cast<int64_t>(NANOSECONDS_PER_MICROSECOND)
+                          + nanosecond_offset;
+
+    // The date only changes at midnight, so it is worked out again only when the time leaves the
+    // day this thread last read it in. Compared unsigned so times before the day wrap past it.
+    // Real offsets are whole quarter hours, so each gets its own slot.
+    CachedDay& cached = cached_days[static_cast<uint32_t>(timezone.utc_offset_minutes / 15)
+                                    % cached_days.size()];
+    if (static_cast<uint64_t>(nanoseconds) - static_cast<uint64_t>(cached.start)
+        >= static_cast<uint64_t>(NANOSECONDS_PER_DAY))
     {
-        size_t ms_in_year = is_leap_year(year)
-            ? MILLISECONDS_PER_LEAP_YEAR
-            : MILLISECONDS_PER_NON_LEAP_YEAR;
-
-        if (timestamp < ms_in_year) break;  // Prevent overshooting the end of the year.
-
-        timestamp -= ms_in_year;
-        year++;
+        int64_t days = arithmetic::floor_div(nanoseconds, NANOSECONDS_PER_DAY);
+        cached.start = days * NANOSECONDS_PER_DAY;
+        cached.date = Date::from_day_number(days);
     }
 
-    // Month.
-    uint8_t month = 1;
-    while (timestamp >= max_days_in_month(month, year) * MILLISECONDS_PER_DAY)
+    // Both the date and the time of day come from the same read of the clock.
+    nanoseconds -= cached.start;
+    const Date& date = cached.date;
+    return Datetime(UNCHECKED, date.year, date.month, date.day,
+                    nanoseconds / NANOSECONDS_PER_HOUR,
+                    nanoseconds / NANOSECONDS_PER_MINUTE % MINUTES_PER_HOUR,
+                    nanoseconds / NANOSECONDS_PER_SECOND % SECONDS_PER_MINUTE,
+                    nanoseconds / NANOSECONDS_PER_MILLISECOND % MILLISECONDS_PER_SECOND,
+                    nanoseconds / NANOSECONDS_PER_MICROSECOND % MICROSECONDS_PER_MILLISECOND,
+                    nanoseconds % NANOSECONDS_PER_MICROSECOND,
+                    timezone);
+}
+
+Datetime::Datetime(std::string_view string) :
+    Datetime(parse::value_or_throw(try_parse(string), string)) {}
+
+std::expected<Datetime, ParseError> Datetime::try_parse(std::string_view string)
+{
+    // Lambda to create the error returned when parsing fails at 'pos'.
+    auto fail = [](ParseError::Code code, size_t pos) {
+        return std::unexpected(ParseError{code, static_cast<uint32_t>(pos)});
+    };
+
+    // Lambda to check that 'string' has the separator 'c' at 'pos'.
+    auto has_separator = [&](size_t pos, char c) {
+        return pos < string.size() && string[pos] == c;
+    };
+
+    int64_t year, month, day;
+    if (!parse::fixed_digits(string, 0, 4, year))
+        return fail(ParseError::Code::EXPECTED_DIGIT, 0);
+    if (!has_separator(4, '-'))
+        return fail(ParseError::Code::EXPECTED_SEPARATOR, 4);
+    if (!parse::fixed_digits(string, 5, 2, month))
+        return fail(ParseError::Code::EXPECTED_DIGIT, 5);
+    if (!has_separator(7, '-'))
+        return fail(ParseError::Code::EXPECTED_SEPARATOR, 7);
+    if (!parse::fixed_digits(string, 8, 2, day))
+        return fail(ParseError::Code::EXPECTED_DIGIT, 8);
+
+    Datetime datetime = Datetime(UNCHECKED, year, month, day, 0, 0, 0, 0, 0, 0,
+                                 get_default_timezone());
+
+    size_t pos = 10;
+    if (has_separator(pos, 'T') || has_separator(pos, ' '))
     {
-        timestamp -= max_days_in_month(month, year) * MILLISECONDS_PER_DAY;
-        month++;
+        int64_t hour, minute;
+        if (!parse::fixed_digits(string, pos + 1, 2, hour))
+            return fail(ParseError::Code::EXPECTED_DIGIT, pos + 1);
+        if (!has_separator(pos + 3, ':'))
+            return fail(ParseError::Code::EXPECTED_SEPARATOR, pos + 3);
+        if (!parse::fixed_digits(string, pos + 4, 2, minute))
+            return fail(ParseError::Code::EXPECTED_DIGIT, pos + 4);
+
+        datetime.hour = hour;
+        datetime.minute = minute;
+        pos += 6;
+
+        if (has_separator(pos, ':'))
+        {
+            int64_t second;
+            if (!parse::fixed_digits(string, pos + 1, 2, second))
+                return fail(ParseError::Code::EXPECTED_DIGIT, pos + 1);
+
+            datetime.second = second;
+            pos += 3;
+
+            if (has_separator(pos, '.'))
+            {
+                int64_t fraction = 0;
+                size_t digits = 0;
+                size_t fraction_start = ++pos;
+
+                // Fast path for all 9 fractional digits, which is what 'to_string' writes.
+                if (parse::eight_digits(string, pos, fraction) && pos + 8 < string.size()
+                    && parse::is_digit(string[pos + 8]))
+                {
+                    fraction = fraction * 10 + (string[pos + 8] - '0');
+                    digits = 9;
+                    pos += 9;
+                }
+                else
+                {
+                    fraction = 0;
+                    for (; pos < string.size() && parse::is_digit(string[pos]); pos++, digits++)
+                        fraction = fraction * 10 + (string[pos] - '0');
+                }
+
+                if (digits == 0)
+                    return fail(ParseError::Code::EXPECTED_DIGIT, fraction_start);
+                // Nanoseconds are the smallest unit kept, so more digits can not be stored.
+                if (digits > 9 || (pos < string.size() && parse::is_digit(string[pos])))
+                    return fail(ParseError::Code::TRAILING_CHARACTERS, fraction_start + 9);
+
+                // Scale the 1 to 9 fractional digits up to nanoseconds.
+                for (; digits < 9; digits++)
+                    fraction *= 10;
+
+                datetime.millisecond = fraction / 1'000'000;
+                datetime.microsecond = fraction / 1'000 % 1'000;
+                datetime.nanosecond = fraction % 1'000;
+            }
+        }
+
+        if (!datetime.is_valid_time())
+            return fail(ParseError::Code::INVALID_TIME, 11);
     }
 
-    // Days.
-    // We'll later add 1 to 'day' because we cannot have day = 0. Minimum day is 1.
-    uint8_t day = timestamp / MILLISECONDS_PER_DAY;
-    timestamp %= MILLISECONDS_PER_DAY;
-
-    // Hours.
-    uint8_t hour = timestamp / MILLISECONDS_PER_HOUR;
-    timestamp %= MILLISECONDS_PER_HOUR;
-
-    // Minutes.
-    uint8_t minute = timestamp / MILLISECONDS_PER_MINUTE;
-    timestamp %= MILLISECONDS_PER_MINUTE;
-
-    // Seconds.
-    uint8_t second = timestamp / MILLISECONDS_PER_SECOND;
-    timestamp %= MILLISECONDS_PER_SECOND;
-
-    // Milliseconds.
-    uint16_t millisecond = timestamp;
-
-
-    Datetime ret =
-        Datetime(year, month, day+1, hour, minute, second, millisecond, 0, 0, from_timezone);
-
-    ret.set_timezone(to_timezone);
-
-    return ret;
-}
-
-Datetime operator+(Datetime datetime, const Hours& hours)
-{
-    datetime += hours;
-    return datetime;
-}
-
-Datetime operator-(Datetime datetime, const Hours& hours)
-{
-    datetime -= hours;
-    return datetime;
-}
-
-Datetime operator+(Datetime datetime, const Minutes& minutes)
-{
-    datetime += minutes;
-    return datetime;
-}
-
-Datetime operator-(Datetime datetime, const Minutes& minutes)
-{
-    datetime -= minutes;
-    return datetime;
-}
-
-Datetime operator+(Datetime datetime, const Seconds& seconds)
-{
-    datetime += seconds;
-    return datetime;
-}
-
-Datetime operator-(Datetime datetime, const Seconds& seconds)
-{
-    datetime -= seconds;
-    return datetime;
-}
-
-Datetime operator+(Datetime datetime, const Milliseconds& milliseconds)
-{
-    datetime += milliseconds;
-    return datetime;
-}
-
-Datetime operator-(Datetime datetime, const Milliseconds& milliseconds)
-{
-    datetime -= milliseconds;
-    return datetime;
-}
-
-Datetime operator+(Datetime datetime, const Microseconds& microseconds)
-{
-    datetime += microseconds;
-    return datetime;
-}
-
-Datetime operator-(Datetime datetime, const Microseconds& microseconds)
-{
-    datetime -= microseconds;
-    return datetime;
-}
-
-Datetime operator+(Datetime datetime, const Nanoseconds& nanoseconds)
-{
-    datetime += nanoseconds;
-    return datetime;
-}
-
-Datetime operator-(Datetime datetime, const Nanoseconds& nanoseconds)
-{
-    datetime -= nanoseconds;
-    return datetime;
-}
-
-Datetime operator+(Datetime datetime, Time other)
-{
-    other.set_timezone(datetime.timezone);
-    datetime += other;
-    return datetime;
-}
-
-Datetime operator-(Datetime datetime, Time other)
-{
-    other.set_timezone(datetime.timezone);
-    datetime -= other;
-    return datetime;
-}
-
-Datetime& Datetime::operator+=(Time time)
-{
-    TimeDelta time_delta = this->time() + std::move(time);
-    nanosecond = time_delta.nanosecond;
-    microsecond = time_delta.microsecond;
-    millisecond = time_delta.millisecond;
-    second = time_delta.second;
-    minute = time_delta.minute;
-    hour = time_delta.hour;
-    (*this) += Days(time_delta.days);
-    return *this;
-}
-
-Datetime& Datetime::operator-=(Time time)
-{
-    TimeDelta time_delta = this->time() - std::move(time);
-    nanosecond = time_delta.nanosecond;
-    microsecond = time_delta.microsecond;
-    millisecond = time_delta.millisecond;
-    second = time_delta.second;
-    minute = time_delta.minute;
-    hour = time_delta.hour;
-    (*this) -= Days(-time_delta.days);
-    return *this;
-}
-
-size_t Datetime::to_ms(Timezone timezone) const
-{
-    // Create datetime copy to convert incase we need to change timezone.
-    Datetime datetime = Datetime(*this);
-    datetime.set_timezone(timezone);
-
-    size_t ret = 0;
-
-    // Years.
-    for (uint16_t y = 1970; y < datetime.year; ++y)
+    if (has_separator(pos, 'Z'))
     {
-        ret += (is_leap_year(y) ? MILLISECONDS_PER_LEAP_YEAR : MILLISECONDS_PER_NON_LEAP_YEAR);
+        datetime.timezone = TZ::UTC;
+        pos++;
     }
-
-    // Months.
-    for (uint8_t m = 1; m < datetime.month; ++m)
+    else if (has_separator(pos, '+') || has_separator(pos, '-'))
     {
-        ret += max_days_in_month(m, datetime.year) * MILLISECONDS_PER_DAY;
+        int64_t offset_hours, offset_minutes;
+        if (!parse::fixed_digits(string, pos + 1, 2, offset_hours))
+            return fail(ParseError::Code::EXPECTED_DIGIT, pos + 1);
+        if (!has_separator(pos + 3, ':'))
+            return fail(ParseError::Code::EXPECTED_SEPARATOR, pos + 3);
+        if (!parse::fixed_digits(string, pos + 4, 2, offset_minutes))
+            return fail(ParseError::Code::EXPECTED_DIGIT, pos + 4);
+        int64_t offset = offset_hours * static_cast<int64_t>(MINUTES_PER_HOUR) + offset_minutes;
+        if (offset_minutes >= static_cast<int64_t>(MINUTES_PER_HOUR)
+            || offset > Timezone::MAX_UTC_OFFSET_MINUTES)
+            return fail(ParseError::Code::UNSUPPORTED_OFFSET, pos);
+
+        // ISO 8601 offsets are ahead of UTC, 'utc_offset_minutes' is behind UTC.
+        datetime.timezone = Timezone(Minutes(string[pos] == '+' ? -offset : offset));
+        pos += 6;
     }
 
-    // Days.
-    ret += (datetime.day - 1) * MILLISECONDS_PER_DAY;
-
-    // Hours.
-    ret += datetime.hour * MILLISECONDS_PER_HOUR;
-
-    // Minutes.
-    ret += datetime.minute * MILLISECONDS_PER_MINUTE;
-
-    // Seconds.
-    ret += datetime.second * MILLISECONDS_PER_SECOND;
-
-    // Milliseconds.
-    ret += datetime.millisecond;
+    if (pos != string.size())
+        return fail(ParseError::Code::TRAILING_CHARACTERS, pos);
 
-    return ret;
-}
-
-const size_t Datetime::MILLISECONDS_PER_DAY = MILLISECONDS_PER_HOUR * 24;
-const size_t Datetime::MILLISECONDS_PER_NON_LEAP_YEAR = MILLISECONDS_PER_DAY * 365;
-const size_t Datetime::MILLISECONDS_PER_LEAP_YEAR = MILLISECONDS_PER_NON_LEAP_YEAR + MILLISECONDS_PER_DAY;
-
-Datetime& Datetime::operator+=(TimeDelta time_delta)
-{
-    (*this) += Days(time_delta.days);
-    (*this) += Time(time_delta, timezone);
-    return *this;
-}
-
-Datetime& Datetime::operator-=(TimeDelta time_delta)
-{
-    (*this) -= Days(time_delta.days);
-    (*this) -= Time(time_delta, timezone);
-    return *this;
-}
+    if (!datetime.is_valid_date())
+        return fail(ParseError::Code::INVALID_DATE, 0);
 
-Datetime operator+(Datetime datetime, TimeDelta time_delta)
-{
-    datetime += std::move(time_delta);
     return datetime;
 }
 
-Datetime operator-(Datetime datetime, TimeDelta time_delta)
-{
-    datetime -= std::move(time_delta);
-    return datetime;
-}
-
-TimeDelta operator-(Datetime datetime, Datetime other)
+std::string Datetime::to_string(TimeComponent include_to,
+                                char delim_date,
+                                char delim_date_and_time,
+                                char delim_h_m_s,
+                                char delim_ms_us_ns,
+                                char delim_tz) const
 {
-    TimeDelta date_delta = datetime.date() - other.date();
-    TimeDelta time_delta = datetime.time() - other.time();
-    return TimeDelta(date_delta.days, time_delta.hour, time_delta.minute, time_delta.second,
-                     time_delta.millisecond, time_delta.microsecond, time_delta.nanosecond);
+    char buffer[MAX_CHARS];
+    return std::string(buffer,
+                       to_chars(buffer, buffer + MAX_CHARS, include_to, delim_date,
+                                delim_date_and_time, delim_h_m_s, delim_ms_us_ns,
+                                delim_tz).ptr);
 }
 
-int Datetime::total_minutes() const
+std::to_chars_result Datetime::to_chars(char* first, char* last,
+                                        TimeComponent include_to,
+                                        char delim_date,
+                                        char delim_date_and_time,
+                                        char delim_h_m_s,
+                                        char delim_ms_us_ns,
+                                        char delim_tz) const
 {
-    return BasicTime::total_minutes();
-}
+    std::to_chars_result result = Date::to_chars(first, last, delim_date);
 
-int Datetime::total_seconds() const
-{
-    return BasicTime::total_seconds();
-}
+    if (result.ec != std::errc())
+        return result;
 
-int64_t Datetime::total_milliseconds() const
-{
-    return BasicTime::total_milliseconds();
-}
+    if (result.ptr == last)
+        return {last, std::errc::value_too_large};
 
-int64_t Datetime::total_microseconds() const
-{
-    return BasicTime::total_microseconds();
+    *result.ptr = delim_date_and_time;
+    return Time::to_chars(result.ptr + 1, last, include_to, delim_h_m_s, delim_ms_us_ns,
+                          delim_tz);
 }
 
-int64_t Datetime::total_nanoseconds() const
+std::ostream& operator<<(std::ostream& os, const Datetime& datetime)
 {
-    return BasicTime::total_nanoseconds();
+    char buffer[Datetime::MAX_CHARS];
+    return os.write(buffer, datetime.to_chars(buffer, buffer + Datetime::MAX_CHARS).ptr - buffer);
 }
 
 std::vector<Datetime> Datetime::range(Datetime start, Datetime end, Days increment)
 {
-    return range(start, end,
-                 [&increment](Datetime& datetime)
-                 {
-                     datetime += increment;
-                 });
+    return iota(start, end, increment).to_vector();
 }
 
 std::vector<Datetime> Datetime::range(Datetime start, Datetime end, Hours increment)
 {
-    return range(start, end,
-                 [&increment](Datetime& datetime)
-                 {
-                     datetime += increment;
-                 });
+    return iota(start, end, increment).to_vector();
 }
 
 std::vector<Datetime> Datetime::range(Datetime start, Datetime end, Minutes increment)
 {
-    return range(start, end,
-                 [&increment](Datetime& datetime)
-                 {
-                     datetime += increment;
-                 });
+    return iota(start, end, increment).to_vector();
 }
 
 std::vector<Datetime> Datetime::range(Datetime start, Datetime end, Seconds increment)
 {
-    return range(start, end,
-                 [&increment](Datetime& datetime)
-                 {
-                     datetime += increment;
-                 });
+    return iota(start, end, increment).to_vector();
 }
 
 std::vector<Datetime> Datetime::range(Datetime start, Datetime end, Milliseconds increment)
 {
-    return range(start, end,
-                 [&increment](Datetime& datetime)
-                 {
-                     datetime += increment;
-                 });
+    return iota(start, end, increment).to_vector();
 }
 
 std::vector<Datetime> Datetime::range(Datetime start, Datetime end, Microseconds increment)
 {
-    return range(start, end,
-                 [&increment](Datetime& datetime)
-                 {
-                     datetime += increment;
-                 });
+    return iota(start, end, increment).to_vector();
 }
 
 std::vector<Datetime> Datetime::range(Datetime start, Datetime end, Nanoseconds increment)
 {
-    return range(start, end,
-                 [&increment](Datetime& datetime)
-                 {
-                     datetime += increment;
-                 });
+    return iota(start, end, increment).to_vector();
 }
-
-Datetime& Datetime::round(TimeComponent to)
-{
-    Time::round(to);
-    return *this;
-}
-
-Datetime& Datetime::ceil(TimeComponent to)
-{
-    Time::ceil(to);
-    return *this;
-}
-
-Datetime& Datetime::floor(TimeComponent to)
-{
-    Time::floor(to);
-    return *this;
-}
-
-template<typename Func>
-requires std::is_invocable_v<Func, Datetime&>
-std::vector<Datetime> Datetime::range(Datetime& start, Datetime& end, Func increment)
-{
-    std::vector<Datetime> ret;
-    Datetime current_datetime = std::move(start);
-    while (current_datetime <= end)
-    {
-        ret.push_back(current_datetime);
-        increment(current_datetime);
-    }
-    return ret;
-}
-
@@ -0,0 +1,454 @@
+#include "datetime/parse/fixed_format.h"
+#include "../util/cpu.h"
+#include "../util/macros.h"
+#include "../util/parse.h"
+#include <fmt/format.h>
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#if DATETIME_HAS_X86_KERNELS
+#include <immintrin.h>
+#endif
+
+namespace
+{
+/**
+ * Indices of the pairs of digits of each field in 'FixedFormat::sources'.
+ */
+enum Pair
+{
+    YEAR_HIGH,
+    YEAR_LOW,
+    MONTH,
+    DAY,
+    HOUR,
+    MINUTE,
+    SECOND,
+    FRACTION = 8,
+    PAIRS = 16
+};
+
+/**
+ * Marks a byte of 'FixedFormat::sources' that has no digit. The kernels read it as a 0 past the
+ * characters of the string.
+ */
+constexpr uint8_t NO_SOURCE = FixedFormat::MAX_WIDTH;
+
+/**
+ * Digits the fraction of the second is read into, aligned to the right, so it is one number.
+ */
+constexpr int FRACTION_SLOTS = 10;
+
+/**
+ * Values of the 16 pairs of digits of a string, each from 0 to 99.
+ */
+using Pairs = std::array<uint16_t, PAIRS>;
+
+/**
+ * Powers of 10 that scale 'n' digits of a fraction of a second to nanoseconds.
+ */
+constexpr std::array<int64_t, 10> FRACTION_SCALES = {0, 100'000'000, 10'000'000, 1'000'000,
+                                                     100'000, 10'000, 1'000, 100, 10, 1};
+
+/**
+ * Converts the pairs of digits of a string to a 'Timestamp', checking the date and time are
+ * valid.
+ *
+ * Shared by every kernel, which only differ in how they check and read the digits.
+ *
+ * @return 'true' if the date and time are valid, 'false' otherwise.
+ */
+bool to_timestamp(const Pairs& pairs, int64_t fraction_scale, int64_t offset, Timestamp& out)
+{
+    if (pairs[HOUR] >= 24 || pairs[MINUTE] >= 60 || pairs[SECOND] >= 60)
+        return false;
+
+    // The same bounds 'Date' checks, through its public helpers.
+    uint16_t year = pairs[YEAR_HIGH] * 100 + pairs[YEAR_LOW];
+    if (year < Date::EPOCH.year || year > 2100 || pairs[MONTH] < 1 || pairs[MONTH] > 12
+        || pairs[DAY] < 1 || pairs[DAY] > Date::max_days_in_month(pairs[MONTH], year))
+        return false;
+
+    Date date = Date(UNCHECKED, year, pairs[MONTH], pairs[DAY]);
+
+    int64_t fraction = pairs[FRACTION] * 100'000'000ll + pairs[FRACTION + 1] * 1'000'000ll
+                       + pairs[FRACTION + 2] * 10'000ll + pairs[FRACTION + 3] * 100ll
+                       + pairs[FRACTION + 4];
+
+    int64_t seconds = ((date.to_day_number() * 24 + pairs[HOUR]) * 60 + pairs[MINUTE]) * 60
+                      + pairs[SECOND];
+    out.epoch_nanoseconds = seconds * Timestamp::NANOSECONDS_PER_SECOND
+                            + fraction * fraction_scale + offset;
+    return true;
+}
+
+/**
+ * Reads the pairs of digits of 'string' from the characters 'sources' points to, one at a time.
+ */
+void read_pairs(std::string_view string, const uint8_t* sources, Pairs& pairs)
+{
+    // Value of each character, then a 0 for the digits of the pairs without a source.
+    std::array<uint8_t, FixedFormat::MAX_WIDTH + 1> values{};
+    for (size_t pos = 0; pos < std::min(string.size(), FixedFormat::MAX_WIDTH); pos++)
+        values[pos] = string[pos] - '0';
+
+    for (size_t pair = 0; pair < PAIRS; pair++)
+        pairs[pair] = values[sources[2 * pair]] * 10 + values[sources[2 * pair + 1]];
+}
+
+/**
+ * Reads the pairs of digits of 'string' 8 characters at a time in 64 bit words, for CPUs
+ * without the instruction sets of the other kernels.
+ *
+ * @return 'true' if 'string' has the characters 'format' describes, 'false' otherwise.
+ */
+bool read_pairs_swar(std::string_view string, size_t width, const uint8_t* digit_mask,
+                     const uint8_t* literal_mask, const char* literals, const uint8_t* sources,
+                     Pairs& pairs)
+{
+    constexpr uint64_t BYTES = 0x0101010101010101;
+
+    if (string.size() != width)
+        return false;
+
+    // Characters, then the value of each, then a 0 for the digits of the pairs without a source.
+    uint8_t values[FixedFormat::MAX_WIDTH + 1] = {};
+    std::memcpy(values, string.data(), width);
+
+    uint64_t bad = 0;
+    for (size_t pos = 0; pos < FixedFormat::MAX_WIDTH; pos += 8)
+    {
+        uint64_t chars, digits, literal, literal_chars;
+        std::memcpy(&chars, values + pos, 8);
+        std::memcpy(&digits, digit_mask + pos, 8);
+        std::memcpy(&literal, literal_mask + pos, 8);
+        std::memcpy(&literal_chars, literals + pos, 8);
+
+        // Only digits become 0 to 9, the one range that adding 0x76 leaves below 0x80. The top
+        // bits are cleared first so no byte carries into the next.
+        uint64_t value = chars ^ '0' * BYTES;
+        uint64_t not_digit = (((value & 0x7F * BYTES) + 0x76 * BYTES) | value) & 0x80 * BYTES;
+        bad |= (not_digit & digits) | ((chars ^ literal_chars) & literal);
+        std::memcpy(values + pos, &value, 8);
+    }
+    if (bad != 0)
+        return false;
+
+    for (size_t pair = 0; pair < PAIRS; pair++)
+        pairs[pair] = values[sources[2 * pair]] * 10 + values[sources[2 * pair + 1]];
+    return true;
+}
+
+/**
+ * Works out why 'string' failed to parse, once one of the kernels found that it did.
+ */
+ParseError diagnose(std::string_view string, size_t width, const uint8_t* digits,
+                    const char* literals, const uint8_t* sources, size_t time_start)
+{
+    auto error = [](ParseError::Code code, size_t pos) {
+        return ParseError{code, static_cast<uint32_t>(pos)};
+    };
+
+    for (size_t pos = 0; pos < width; pos++)
+    {
+        if (pos == string.size())
+            return error(ParseError::Code::MISSING_COMPONENT, pos);
+        if (digits[pos] != 0 && !parse::is_digit(string[pos]))
+            return error(ParseError::Code::EXPECTED_DIGIT, pos);
+        if (digits[pos] == 0 && string[pos] != literals[pos])
+            return error(ParseError::Code::EXPECTED_SEPARATOR, pos);
+    }
+
+    Pairs pairs;
+    read_pairs(string, sources, pairs);
+    if (pairs[HOUR] >= 24 || pairs[MINUTE] >= 60 || pairs[SECOND] >= 60)
+        return error(ParseError::Code::INVALID_TIME, time_start);
+    if (string.size() != width)
+        return error(ParseError::Code::TRAILING_CHARACTERS, width);
+    return error(ParseError::Code::INVALID_DATE, 0);
+}
+
+#if DATETIME_HAS_X86_KERNELS
+/**
+ * Loads the characters of 'string' as two 16 byte halves, 0 past its end, without reading
+ * outside of it.
+ *
+ * Strings of 16 characters or more are loaded as their first and last 16 characters, and the
+ * last are moved down by 'tail_shuffle' to follow the first. Shorter strings are copied.
+ */
+DATETIME_TARGET_SSE41 void load_halves(std::string_view string, const uint8_t* tail_shuffle,
+                                       __m128i& low, __m128i& high)
+{
+    if (string.size() >= 16)
+    {
+        low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(string.data()));
+        high = _mm_shuffle_epi8(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(string.data() + string.size() - 16)),
+            _mm_load_si128(reinterpret_cast<const __m128i*>(tail_shuffle)));
+        return;
+    }
+
+    char buffer[16] = {};
+    std::memcpy(buffer, string.data(), string.size());
+    low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(buffer));
+    high = _mm_setzero_si128();
+}
+
+/**
+ * Reads the pairs of digits of 'string' with SSE4.1, 16 characters at a time.
+ *
+ * @return 'true' if 'string' has the characters 'format' describes, 'false' otherwise.
+ */
+DATETIME_TARGET_SSE41 bool read_pairs_sse41(std::string_view string, size_t width,
+                                            const uint8_t* digit_mask, const uint8_t* literal_mask,
+                                            const char* literals, const uint8_t* gathers,
+                                            const uint8_t* tail_shuffle, Pairs& pairs)
+{
+    if (string.size() != width)
+        return false;
+
+    __m128i halves[2];
+    load_halves(string, tail_shuffle, halves[0], halves[1]);
+
+    __m128i zero = _mm_set1_epi8('0');
+    __m128i nine = _mm_set1_epi8(9);
+    __m128i bad = _mm_setzero_si128();
+    for (int half = 0; half < 2; half++)
+    {
+        __m128i chars = halves[half];
+        __m128i digits = _mm_sub_epi8(chars, zero);
+
+        // A digit less '0' is at most 9, anything else wraps around past it.
+        __m128i is_digit = _mm_cmpeq_epi8(_mm_min_epu8(digits, nine), digits);
+        __m128i is_literal = _mm_cmpeq_epi8(
+            chars, _mm_load_si128(reinterpret_cast<const __m128i*>(literals + 16 * half)));
+        bad = _mm_or_si128(bad, _mm_andnot_si128(is_digit, _mm_load_si128(
+            reinterpret_cast<const __m128i*>(digit_mask + 16 * half))));
+        bad = _mm_or_si128(bad, _mm_andnot_si128(is_literal, _mm_load_si128(
+            reinterpret_cast<const __m128i*>(literal_mask + 16 * half))));
+        halves[half] = digits;
+    }
+    if (!_mm_testz_si128(bad, bad))
+        return false;
+
+    // Each 8 of the 16 pairs of digits are gathered from both halves, then each pair becomes
+    // tens * 10 plus ones.
+    __m128i weights = _mm_set1_epi16(0x010A);
+    for (int out = 0; out < 2; out++)
+    {
+        __m128i gathered = _mm_setzero_si128();
+        for (int half = 0; half < 2; half++)
+        {
+            const uint8_t* gather = gathers + FixedFormat::MAX_WIDTH * half + 16 * out;
+            gathered = _mm_or_si128(gathered, _mm_shuffle_epi8(halves[half], _mm_load_si128(
+                reinterpret_cast<const __m128i*>(gather))));
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(pairs.data() + 8 * out),
+                         _mm_maddubs_epi16(gathered, weights));
+    }
+    return true;
+}
+
+/**
+ * Reads the pairs of digits of 'string' with AVX2, all 32 characters at once.
+ *
+ * @return 'true' if 'string' has the characters 'format' describes, 'false' otherwise.
+ */
+DATETIME_TARGET_AVX2 bool read_pairs_avx2(std::string_view string, size_t width,
+                                          const uint8_t* digit_mask, const uint8_t* literal_mask,
+                                          const char* literals, const uint8_t* gathers,
+                                          const uint8_t* tail_shuffle, Pairs& pairs)
+{
+    if (string.size() != width)
+        return false;
+
+    __m128i halves[2];
+    load_halves(string, tail_shuffle, halves[0], halves[1]);
+
+    __m256i chars = _mm256_set_m128i(halves[1], halves[0]);
+    __m256i digits = _mm256_sub_epi8(chars, _mm256_set1_epi8('0'));
+
+    // A digit less '0' is at most 9, anything else wraps around past it.
+    __m256i is_digit = _mm256_cmpeq_epi8(_mm256_min_epu8(digits, _mm256_set1_epi8(9)), digits);
+    __m256i is_literal = _mm256_cmpeq_epi8(
+        chars, _mm256_load_si256(reinterpret_cast<const __m256i*>(literals)));
+    __m256i bad = _mm256_or_si256(
+        _mm256_andnot_si256(is_digit,
+                            _mm256_load_si256(reinterpret_cast<const __m256i*>(digit_mask))),
+        _mm256_andnot_si256(is_literal,
+                            _mm256_load_si256(reinterpret_cast<const __m256i*>(literal_mask))));
+    if (!_mm256_testz_si256(bad, bad))
+        return false;
+
+    // Shuffles only move bytes within each 16 byte lane, so each half of the characters is
+    // copied to both lanes and shuffled on its own.
+    __m256i low = _mm256_permute2x128_si256(digits, digits, 0x00);
+    __m256i high = _mm256_permute2x128_si256(digits, digits, 0x11);
+    __m256i gathered = _mm256_or_si256(
+        _mm256_shuffle_epi8(low, _mm256_load_si256(reinterpret_cast<const __m256i*>(gathers))),
+        _mm256_shuffle_epi8(high, _mm256_load_si256(
+            reinterpret_cast<const __m256i*>(gathers + FixedFormat::MAX_WIDTH))));
+
+    // Each pair becomes tens * 10 plus ones.
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(pairs.data()),
+                        _mm256_maddubs_epi16(gathered, _mm256_set1_epi16(0x010A)));
+    return true;
+}
+#endif
+}
+
+FixedFormat::FixedFormat(std::string_view format, Timezone timezone) :
+    timezone(timezone)
+{
+    sources.fill(NO_SOURCE);
+    bool has_time = false;
+
+    // Lambda to claim the next 'count' characters as the digits starting at byte 'first' of
+    // 'sources'.
+    auto add_digits = [&](char directive, size_t first, size_t count) {
+        ASSERT(sources[first + count - 1] == NO_SOURCE,
+               std::invalid_argument(fmt::format("'%{}' is repeated in '{}'", directive, format)));
+        ASSERT(width + count <= MAX_WIDTH,
+               std::invalid_argument(fmt::format("'{}' is wider than {} characters", format,
+                                                 MAX_WIDTH)));
+
+        for (size_t i = 0; i < count; i++)
+        {
+            digits[width] = 0xFF;
+            sources[first + i] = width++;
+        }
+    };
+
+    for (size_t i = 0; i < format.size(); i++)
+    {
+        if (format[i] != '%' || (i + 1 < format.size() && format[i + 1] == '%'))
+        {
+            ASSERT(width < MAX_WIDTH,
+                   std::invalid_argument(fmt::format("'{}' is wider than {} characters", format,
+                                                     MAX_WIDTH)));
+            literal_mask[width] = 0xFF;
+            literals[width++] = format[i];
+            i += format[i] == '%';
+            continue;
+        }
+
+        ASSERT(++i < format.size(),
+               std::invalid_argument(fmt::format("'{}' ends with '%'", format)));
+
+        size_t start = width;
+        bool is_time = format[i] != 'Y' && format[i] != 'm' && format[i] != 'd';
+        switch (format[i])
+        {
+        case 'Y':
+            add_digits('Y', 2 * YEAR_HIGH, 4);
+            break;
+        case 'm':
+            add_digits('m', 2 * MONTH, 2);
+            break;
+        case 'd':
+            add_digits('d', 2 * DAY, 2);
+            break;
+        case 'H':
+            add_digits('H', 2 * HOUR, 2);
+            break;
+        case 'M':
+            add_digits('M', 2 * MINUTE, 2);
+            break;
+        case 'S':
+            add_digits('S', 2 * SECOND, 2);
+            break;
+        default:
+        {
+            fraction_digits = 9;
+            if (format[i] >= '1' && format[i] <= '9' && i + 1 < format.size())
+                fraction_digits = format[i++] - '0';
+
+            ASSERT(format[i] == 'f',
+                   std::invalid_argument(fmt::format("'{}' has an unsupported directive at {}",
+                                                     format, i)));
+            add_digits('f', 2 * FRACTION + FRACTION_SLOTS - fraction_digits, fraction_digits);
+            break;
+        }
+        }
+
+        if (is_time && !has_time)
+            time_start = start;
+        has_time |= is_time;
+    }
+
+    ASSERT(sources[2 * YEAR_HIGH] != NO_SOURCE && sources[2 * MONTH] != NO_SOURCE
+           && sources[2 * DAY] != NO_SOURCE,
+           std::invalid_argument(fmt::format("'{}' is missing '%Y', '%m', or '%d'", format)));
+
+    for (size_t byte = 0; byte < MAX_WIDTH; byte++)
+    {
+        uint8_t source = sources[byte];
+        gathers[0][byte] = source < 16 ? source : 0x80;
+        gathers[1][byte] = source >= 16 && source != NO_SOURCE ? source - 16 : 0x80;
+    }
+
+    // Index in the last 16 characters of each character after the first 16.
+    for (size_t byte = 0; byte < 16; byte++)
+        tail_shuffle[byte] = byte + 16 < width ? byte + 32 - width : 0x80;
+}
+
+std::expected<void, FixedFormat::Error> parse_fixed(std::span<const std::string_view> strings,
+                                                    const FixedFormat& format,
+                                                    std::span<Timestamp> out)
+{
+    ASSERT(strings.size() == out.size(),
+           std::invalid_argument(fmt::format("Output has {} elements, but the input has {}",
+                                             out.size(), strings.size())));
+
+    int64_t fraction_scale = FRACTION_SCALES[format.fraction_digits];
+    int64_t offset = format.timezone.utc_offset_minutes * Timestamp::NANOSECONDS_PER_MINUTE;
+
+    // Lambda to report the 'Error' of 'strings[index]'.
+    auto fail = [&](size_t index) {
+        return std::unexpected(FixedFormat::Error{
+            index, diagnose(strings[index], format.width, format.digits.data(),
+                            format.literals.data(), format.sources.data(), format.time_start)});
+    };
+
+    Pairs pairs{};
+
+#if DATETIME_HAS_X86_KERNELS
+    if (cpu::has_avx2())
+    {
+        for (size_t i = 0; i < strings.size(); i++)
+        {
+            if (!read_pairs_avx2(strings[i], format.width, format.digits.data(),
+                                 format.literal_mask.data(), format.literals.data(),
+                                 format.gathers[0].data(), format.tail_shuffle.data(), pairs)
+                || !to_timestamp(pairs, fraction_scale, offset, out[i]))
+                return fail(i);
+        }
+        return {};
+    }
+
+    if (cpu::has_sse41())
+    {
+        for (size_t i = 0; i < strings.size(); i++)
+        {
+            if (!read_pairs_sse41(strings[i], format.width, format.digits.data(),
+                                  format.literal_mask.data(), format.literals.data(),
+                                  format.gathers[0].data(), format.tail_shuffle.data(),
+                                  pairs)
+                || !to_timestamp(pairs, fraction_scale, offset, out[i]))
+                return fail(i);
+        }
+        return {};
+    }
+#endif
+
+    for (size_t i = 0; i < strings.size(); i++)
+    {
+        if (!read_pairs_swar(strings[i], format.width, format.digits.data(),
+                             format.literal_mask.data(), format.literals.data(),
+                             format.sources.data(), pairs)
+            || !to_timestamp(pairs, fraction_scale, offset, out[i]))
+            return fail(i);
+    }
+    return {};
+}
@@ -0,0 +1,42 @@
+#include "datetime/parse/parse_error.h"
+#include <fmt/format.h>
+
+namespace
+{
+/**
+ * Gets a description of 'code'.
+ *
+ * @param code 'ParseError::Code' to describe.
+ *
+ * @return description of 'code'.
+ */
+std::string_view describe(ParseError::Code code)
+{
+    switch (code)
+    {
+    case ParseError::Code::EXPECTED_DIGIT:
+        return "expected a digit";
+    case ParseError::Code::EXPECTED_SEPARATOR:
+        return "expected a separator";
+    case ParseError::Code::MISSING_COMPONENT:
+        return "fewer numbers than components";
+    case ParseError::Code::NUMBER_TOO_LONG:
+        return "number has too many digits";
+    case ParseError::Code::UNSUPPORTED_OFFSET:
+        return "UTC offset out of range";
+    case ParseError::Code::TRAILING_CHARACTERS:
+        return "unexpected characters";
+    case ParseError::Code::INVALID_DATE:
+        return "invalid date";
+    case ParseError::Code::INVALID_TIME:
+        return "invalid time";
+    }
+    return "unknown error";
+}
+}
+
+std::string ParseError::message(std::string_view string) const
+{
+    return fmt::format("'{}' could not be parsed: {} at offset {}", string, describe(code),
+                       offset);
+}
@@ -5,6 +5,8 @@
 #include <string>
 #include <datetime/time/time_component.h>
 #include <cstdint>
+#include <charconv>
+#include <type_traits>
 
 /**
  * Basic time representation.
@@ -56,10 +58,11 @@ public:
     * @param millisecond millisecond the 'Time' will be set to. (default 0)
     * @param microsecond microsecond the 'Time' will be set to. (default 0)
     * @param nanosecond nanosecond the 'Time' will be set to. (default 0)
-    * @param timezone timezone the 'Time' will be set to. (default default_timezone)
+    * @param timezone timezone the 'Time' will be set to. (default get_default_timezone())
     */
-    BasicTime(uint8_t hour = 0, uint8_t minute = 0, uint8_t second = 0, uint16_t millisecond = 0,
-        uint16_t microsecond = 0, uint16_t nanosecond = 0) :
+    constexpr BasicTime(uint8_t hour = 0, uint8_t minute = 0, uint8_t second = 0,
+                        uint16_t millisecond = 0, uint16_t microsecond = 0,
+                        uint16_t nanosecond = 0) :
         hour(hour), minute(minute), second(second), millisecond(millisecond), microsecond
         (microsecond), nanosecond(nanosecond) {}
 
@@ -70,7 +73,7 @@ public:
     *
     * @return 'true' if 'this' is greater than 'other', 'false' otherwise.
     */
-    bool operator>(BasicTime other) const;
+    constexpr bool operator>(BasicTime other) const;
 
     /**
      * Checks if 'this' is greater than or equal to 'other'.
@@ -79,7 +82,7 @@ public:
      *
      * @return 'true' if 'this' is greater than or equal to 'other', 'false' otherwise.
      */
-    bool operator>=(BasicTime other) const;
+    constexpr bool operator>=(BasicTime other) const;
 
     /**
      * Checks if 'this' is less than 'other'.
@@ -88,7 +91,7 @@ public:
      *
      * @return 'true' if 'this' is less than 'other', 'false' otherwise.
      */
-    bool operator<(BasicTime other) const;
+    constexpr bool operator<(BasicTime other) const;
 
     /**
      * Checks if 'this' is less than or equal to 'other'.
@@ -97,7 +100,7 @@ public:
      *
      * @return 'true' if 'this' is less than or equal to 'other', 'false' otherwise.
      */
-    bool operator<=(BasicTime other) const;
+    constexpr bool operator<=(BasicTime other) const;
 
     /**
      * Checks if 'this' is equal to 'other'.
@@ -106,7 +109,7 @@ public:
      *
      * @return 'true' if 'this' is equal to 'other', 'false' otherwise.
      */
-    bool operator==(BasicTime other) const;
+    constexpr bool operator==(BasicTime other) const;
 
     /**
      * Checks if 'this' is not equal to 'other'.
@@ -115,47 +118,47 @@ public:
      *
      * @return 'true' if 'this' is not equal to 'other', 'false' otherwise.
      */
-    bool operator!=(BasicTime other) const;
+    constexpr bool operator!=(BasicTime other) const;
 
     /**
      * Gets the total minutes of the day.
      *
      * @return total minutes of the day.
      */
-    virtual int total_minutes() const;
+    constexpr int total_minutes() const;
 
     /**
      * Gets the total seconds of the day.
      *
      * @return total seconds of the day.
      */
-    virtual int total_seconds() const;
+    constexpr int total_seconds() const;
 
     /**
      * Gets the total milliseconds of the day.
      *
      * @return total milliseconds of the day.
      */
-    virtual int64_t total_milliseconds() const;
+    constexpr int64_t total_milliseconds() const;
 
     /**
      * Gets the total microseconds of the day.
      *
      * @return total microseconds of the day.
      */
-    virtual int64_t total_microseconds() const;
+    constexpr int64_t total_microseconds() const;
 
     /**
      * Gets the total nanoseconds of the day.
      *
      * @return total nanoseconds of the day.
      */
-    virtual int64_t total_nanoseconds() const;
+    constexpr int64_t total_nanoseconds() const;
 
     /**
      * Hours in a day.
      */
-    static const int HOURS_PER_DAY;
+    static constexpr int HOURS_PER_DAY = 24;
 
 protected:
 
@@ -178,85 +181,250 @@ protected:
      *
      * @return resulting std::string.
      */
-    virtual std::string to_string(TimeComponent include_to = TimeComponent::NANOSECOND,
+    std::string to_string(TimeComponent include_to = TimeComponent::NANOSECOND,
+                          char delim_h_m_s = ':',
+                          char delim_ms_us_ns = '.') const;
+
+    /**
+     * Writes the 'to_string' representation of this 'Time' into '[first, last)', without
+     * allocating.
+     *
+     * @param first start of the buffer to write into.
+     * @param last one past the end of the buffer to write into.
+     * @param include_to Include the time components up until 'include_to' in the resulting
+     * string (inclusive).
+     * @param delim_h_m_s 'char' separating hours, minutes, and seconds.
+     * @param delim_ms_us_ns 'char' separating milliseconds, microseconds, and nanoseconds.
+     *
+     * @return one past the last character written, or 'last' with
+     * 'std::errc::value_too_large' if the buffer is too small.
+     */
+    std::to_chars_result to_chars(char* first, char* last,
+                                  TimeComponent include_to = TimeComponent::NANOSECOND,
                                   char delim_h_m_s = ':',
                                   char delim_ms_us_ns = '.') const;
 
+    /**
+     * Most characters 'to_chars' can write.
+     */
+    static constexpr size_t MAX_CHARS = 29;
+
     /**
      * Minutes in a hour.
      */
-    static const size_t MINUTES_PER_HOUR;
+    static constexpr size_t MINUTES_PER_HOUR = 60;
 
     /**
      * Seconds in a minute.
      */
-    static const size_t SECONDS_PER_MINUTE;
+    static constexpr size_t SECONDS_PER_MINUTE = 60;
 
     /**
      * Seconds in a hour.
      */
-    static const size_t SECONDS_PER_HOUR;
+    static constexpr size_t SECONDS_PER_HOUR = MINUTES_PER_HOUR * SECONDS_PER_MINUTE;
 
     /**
      * Milliseconds in a second.
      */
-    static const size_t MILLISECONDS_PER_SECOND;
+    static constexpr size_t MILLISECONDS_PER_SECOND = 1'000;
 
     /**
      * Milliseconds in a minute.
      */
-    static const size_t MILLISECONDS_PER_MINUTE;
+    static constexpr size_t MILLISECONDS_PER_MINUTE = SECONDS_PER_MINUTE * MILLISECONDS_PER_SECOND;
 
     /**
      * Milliseconds in a minute.
      */
-    static const size_t MILLISECONDS_PER_HOUR;
+    static constexpr size_t MILLISECONDS_PER_HOUR = SECONDS_PER_HOUR * MILLISECONDS_PER_SECOND;
 
     /**
      * Microseconds in a millisecond.
      */
-    static const size_t MICROSECONDS_PER_MILLISECOND;
+    static constexpr size_t MICROSECONDS_PER_MILLISECOND = 1'000;
 
     /**
      * Microseconds in a hour.
      */
-    static const size_t MICROSECONDS_PER_HOUR;
+    static constexpr size_t MICROSECONDS_PER_HOUR = MILLISECONDS_PER_HOUR
+                                                  * MICROSECONDS_PER_MILLISECOND;
 
     /**
      * Microseconds in a minute.
      */
-    static const size_t MICROSECONDS_PER_MINUTE;
+    static constexpr size_t MICROSECONDS_PER_MINUTE = MILLISECONDS_PER_MINUTE
+                                                    * MICROSECONDS_PER_MILLISECOND;
 
     /**
      * Microseconds in a second.
      */
-    static const size_t MICROSECONDS_PER_SECOND;
+    static constexpr size_t MICROSECONDS_PER_SECOND = MILLISECONDS_PER_SECOND
+                                                    * MICROSECONDS_PER_MILLISECOND;
 
     /**
      * Nanoseconds in a microsecond.
      */
-    static const size_t NANOSECONDS_PER_MICROSECOND;
+    static constexpr size_t NANOSECONDS_PER_MICROSECOND = 1'000;
 
     /**
      * Nanoseconds in a hour.
      */
-    static const size_t NANOSECONDS_PER_HOUR;
+    static constexpr size_t NANOSECONDS_PER_HOUR = MICROSECONDS_PER_HOUR
+                                                 * NANOSECONDS_PER_MICROSECOND;
 
     /**
      * Nanoseconds in a minute.
      */
-    static const size_t NANOSECONDS_PER_MINUTE;
+    static constexpr size_t NANOSECONDS_PER_MINUTE = MICROSECONDS_PER_MINUTE
+                                                   * NANOSECONDS_PER_MICROSECOND;
 
     /**
      * Nanoseconds in a second.
      */
-    static const size_t NANOSECONDS_PER_SECOND;
+    static constexpr size_t NANOSECONDS_PER_SECOND = MICROSECONDS_PER_SECOND
+                                                   * NANOSECONDS_PER_MICROSECOND;
 
     /**
      * Nanoseconds in a millisecond.
      */
-    static const size_t NANOSECONDS_PER_MILLISECOND;
+    static constexpr size_t NANOSECONDS_PER_MILLISECOND = MICROSECONDS_PER_MILLISECOND
+                                                        * NANOSECONDS_PER_MICROSECOND;
+
+    /**
+     * Nanoseconds in a day.
+     */
+    static constexpr int64_t NANOSECONDS_PER_DAY = NANOSECONDS_PER_HOUR * HOURS_PER_DAY;
 };
 
+static_assert(sizeof(BasicTime) == 10);
+static_assert(std::is_trivially_copyable_v<BasicTime>);
+
+constexpr bool BasicTime::operator>(BasicTime other) const
+{
+    return    hour > other.hour
+              || hour == other.hour && minute > other.minute
+              || hour == other.hour && minute == other.minute && second > other.second
+              || hour == other.hour && minute == other.minute && second == other.second
+                 && millisecond > other.millisecond
+              || hour == other.hour && minute == other.minute && second == other.second
+                 && millisecond == other.millisecond && microsecond > other.microsecond
+              || hour == other.hour && minute == other.minute && second == other.second
+                 && millisecond == other.millisecond && microsecond == other.microsecond
+                 && nanosecond > other.nanosecond;
+}
+
+constexpr bool BasicTime::operator>=(BasicTime other) const
+{
+    return    hour > other.hour
+              || hour == other.hour && minute > other.minute
+              || hour == other.hour && minute == other.minute && second > other.second
+              || hour == other.hour && minute == other.minute && second == other.second
+                 && millisecond > other.millisecond
+              || hour == other.hour && minute == other.minute && second == other.second
+                 && millisecond == other.millisecond && microsecond > other.microsecond
+              || hour == other.hour && minute == other.minute && second == other.second
+                 && millisecond == other.millisecond && microsecond == other.microsecond
+                 && nanosecond >= other.nanosecond;
+}
+
+constexpr bool BasicTime::operator<(BasicTime other) const
+{
+    return    hour < other.hour
+              || hour == other.hour && minute < other.minute
+              || hour == other.hour && minute == other.minute && second < other.second
+              || hour == other.hour && minute == other.minute && second == other.second
+                 && millisecond < other.millisecond
+              || hour == other.hour && minute == other.minute && second == other.second
+                 && millisecond == other.millisecond && microsecond < other.microsecond
+              || hour == other.hour && minute == other.minute && second == other.second
+                 && millisecond == other.millisecond && microsecond == other.microsecond
+                 && nanosecond < other.nanosecond;
+}
+
+constexpr bool BasicTime::operator<=(BasicTime other) const
+{
+    return    hour < other.hour
+              || hour == other.hour && minute < other.minute
+              || hour == other.hour && minute == other.minute && second < other.second
+              || hour == other.hour && minute == other.minute && second == other.second
+                 && millisecond < other.millisecond
+              || hour == other.hour && minute == other.minute && second == other.second
+                 && millisecond == other.millisecond && microsecond < other.microsecond
+              || hour == other.hour && minute == other.minute && second == other.second
+                 && millisecond == other.millisecond && microsecond == other.microsecond
+                 && nanosecond <= other.nanosecond;
+}
+
+constexpr bool BasicTime::operator==(BasicTime other) const
+{
+    return    hour == other.hour
+              && minute == other.minute
+              && second == other.second
+              && millisecond == other.millisecond
+              && microsecond == other.microsecond
+              && nanosecond == other.nanosecond;
+}
+
+constexpr bool BasicTime::operator!=(BasicTime other) const
+{
+    return    hour != other.hour
+              || minute != other.minute
+              || second != other.second
+              || millisecond != other.millisecond
+              || microsecond != other.microsecond
+              || nanosecond != other.nanosecond;
+}
+
+constexpr int BasicTime::total_minutes() const
+{
+    return static_cast<int>(
+        hour * MINUTES_PER_HOUR
+        + minute
+    );
+}
+
+constexpr int BasicTime::total_seconds() const
+{
+    return static_cast<int>(
+        hour * SECONDS_PER_HOUR
+        + minute * SECONDS_PER_MINUTE
+        + second
+    );
+}
+
+constexpr int64_t BasicTime::total_milliseconds() const
+{
+    return static_cast<int64_t>(
+        hour * MILLISECONDS_PER_HOUR
+        + minute * MILLISECONDS_PER_MINUTE
+        + second * MILLISECONDS_PER_SECOND
+        + millisecond
+    );
+}
+
+constexpr int64_t BasicTime::total_microseconds() const
+{
+    return static_cast<int64_t>(
+        hour * MICROSECONDS_PER_HOUR
+        + minute * MICROSECONDS_PER_MINUTE
+        + second * MICROSECONDS_PER_SECOND
+        + millisecond * MICROSECONDS_PER_MILLISECOND
+        + microsecond
+    );
+}
+
+constexpr int64_t BasicTime::total_nanoseconds() const
+{
+    return static_cast<int64_t>(
+        hour * NANOSECONDS_PER_HOUR
+        + minute * NANOSECONDS_PER_MINUTE
+        + second * NANOSECONDS_PER_SECOND
+        + millisecond * NANOSECONDS_PER_MILLISECOND
+        + microsecond * NANOSECONDS_PER_MICROSECOND
+        + nanosecond
+    );
+}
+
 
 #endif //DATETIME_BASICTIME_H
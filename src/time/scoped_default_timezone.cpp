@@ -0,0 +1,12 @@
+#include "datetime/time/scoped_default_timezone.h"
+
+ScopedDefaultTimezone::ScopedDefaultTimezone(Timezone timezone) :
+    previous(Time::get_thread_default_timezone())
+{
+    Time::set_thread_default_timezone(timezone);
+}
+
+ScopedDefaultTimezone::~ScopedDefaultTimezone()
+{
+    Time::set_thread_default_timezone(previous);
+}
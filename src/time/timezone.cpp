@@ -0,0 +1,59 @@
+#include "datetime/time/timezone.h"
+#include <ctime>
+
+Timezone TZ::helpers::get_local_tz()
+{
+    std::time_t now = std::time(nullptr);
+    std::tm local_tm{};
+
+#if defined(_WIN32)
+    if (localtime_s(&local_tm, &now) != 0)
+        return TZ::UTC;
+
+    long seconds_west = 0;
+    _get_timezone(&seconds_west);
+    if (local_tm.tm_isdst > 0)
+    {
+        long dst_seconds = 0;
+        _get_dstbias(&dst_seconds);
+        seconds_west += dst_seconds;
+    }
+    return Timezone(Minutes(seconds_west / 60));
+#else
+    // 'localtime_r' need not read 'TZ' itself, unlike 'localtime'.
+    tzset();
+    if (localtime_r(&now, &local_tm) == nullptr)
+        return TZ::UTC;
+
+    // 'tm_gmtoff' is the seconds ahead of UTC, 'utc_offset_minutes' is behind UTC.
+    return Timezone(Minutes(-local_tm.tm_gmtoff / 60));
+#endif
+}
+
+TZ::helpers::LocalTimezone::operator Timezone() const
+{
+    return TZ::local();
+}
+
+std::string TZ::helpers::LocalTimezone::to_string() const
+{
+    return TZ::local().to_string();
+}
+
+std::to_chars_result TZ::helpers::LocalTimezone::to_chars(char* first, char* last) const
+{
+    return TZ::local().to_chars(first, last);
+}
+
+Minutes TZ::helpers::LocalTimezone::get_utc_offset_diff(Timezone other) const
+{
+    return TZ::local().get_utc_offset_diff(other);
+}
+
+Timezone TZ::local()
+{
+    // A function local static is initialized on first use, and only once if several threads
+    // get here at the same time.
+    static const Timezone local_timezone = helpers::get_local_tz();
+    return local_timezone;
+}
@@ -0,0 +1,288 @@
+#include "datetime/timer/timer_wheel.h"
+#include "../util/arithmetic.h"
+#include "../util/macros.h"
+#include <bit>
+#include <fmt/format.h>
+#include <stdexcept>
+#include <utility>
+
+namespace
+{
+/**
+ * Finds the first set bit after 'after' in a bitmap of 'Words' words.
+ *
+ * @param bits bitmap to search.
+ * @param after index of the bit to start searching after.
+ *
+ * @return index of the first set bit after 'after', or -1 if there is none.
+ */
+template<size_t Words>
+int next_set_bit(const std::array<uint64_t, Words>& bits, uint32_t after)
+{
+    uint32_t start = after + 1;
+    if (start >= Words * 64)
+        return -1;
+
+    size_t word = start / 64;
+    uint64_t remaining = bits[word] & (~uint64_t(0) << (start % 64));
+    while (remaining == 0)
+    {
+        if (++word == Words)
+            return -1;
+        remaining = bits[word];
+    }
+    return static_cast<int>(word * 64 + std::countr_zero(remaining));
+}
+}
+
+TimerWheel::TimerWheel(Milliseconds resolution, Clock clock) :
+    TimerWheel(resolution.value * Timestamp::NANOSECONDS_PER_MILLISECOND, std::move(clock)) {}
+
+TimerWheel::TimerWheel(Microseconds resolution, Clock clock) :
+    TimerWheel(resolution.value * Timestamp::NANOSECONDS_PER_MICROSECOND, std::move(clock)) {}
+
+TimerWheel::TimerWheel(int64_t resolution_nanoseconds, Clock clock) :
+    resolution_nanoseconds(resolution_nanoseconds),
+    clock(std::move(clock))
+{
+    ASSERT(resolution_nanoseconds > 0,
+           std::invalid_argument(fmt::format("Resolution must be positive, got {}ns",
+                                             resolution_nanoseconds)));
+
+    current_nanoseconds = Timestamp(this->clock()).epoch_nanoseconds;
+    current_tick = static_cast<uint64_t>(arithmetic::floor_div(current_nanoseconds,
+                                                               resolution_nanoseconds));
+}
+
+TimerWheel::TimerId TimerWheel::schedule(const Datetime& deadline, Callback callback)
+{
+    return schedule_at(Timestamp(deadline).epoch_nanoseconds, std::move(callback));
+}
+
+TimerWheel::TimerId TimerWheel::schedule(const TimeDelta& delay, Callback callback)
+{
+    return schedule_at(current_nanoseconds + delay.total_nanoseconds(), std::move(callback));
+}
+
+bool TimerWheel::cancel(TimerId id)
+{
+    uint32_t index = static_cast<uint32_t>(id);
+    if (index >= timers.size()
+        || timers[index].list == NONE
+        || timers[index].generation != static_cast<uint32_t>(id >> 32))
+        return false;
+
+    unlink(index);
+    release(index);
+    return true;
+}
+
+size_t TimerWheel::advance(const Datetime& now)
+{
+    int64_t now_nanoseconds = Timestamp(now).epoch_nanoseconds;
+    if (now_nanoseconds > current_nanoseconds)
+        current_nanoseconds = now_nanoseconds;
+    uint64_t target_tick = static_cast<uint64_t>(arithmetic::floor_div(current_nanoseconds,
+                                                                       resolution_nanoseconds));
+
+    // Timers left over from a callback that threw go first, then the ones that were already
+    // due when they were scheduled.
+    splice(DUE_LIST, FIRING_LIST);
+    size_t fired = fire();
+
+    for (uint64_t tick = next_event(); tick <= target_tick; tick = next_event())
+    {
+        current_tick = tick;
+
+        // Higher wheels first, so their timers can land in the lower slots moved after them.
+        for (int level = LEVELS - 1; level > 0; level--)
+        {
+            uint64_t below = (uint64_t(1) << (level * BITS_PER_LEVEL)) - 1;
+            if ((tick & below) == 0)
+                cascade(level, (tick >> (level * BITS_PER_LEVEL)) & (SLOTS_PER_LEVEL - 1));
+        }
+
+        splice(tick & (SLOTS_PER_LEVEL - 1), FIRING_LIST);
+        fired += fire();
+    }
+
+    if (target_tick > current_tick)
+        current_tick = target_tick;
+
+    return fired;
+}
+
+size_t TimerWheel::poll()
+{
+    return advance(clock());
+}
+
+size_t TimerWheel::size() const
+{
+    return pending;
+}
+
+bool TimerWheel::empty() const
+{
+    return pending == 0;
+}
+
+TimerWheel::TimerId TimerWheel::schedule_at(int64_t deadline_nanoseconds, Callback callback)
+{
+    uint32_t index;
+    if (free_timers != NONE)
+    {
+        index = free_timers;
+        free_timers = timers[index].next;
+    }
+    else
+    {
+        index = static_cast<uint32_t>(timers.size());
+        timers.emplace_back();
+    }
+
+    // Rounded up, so a timer never fires before its deadline.
+    Timer& timer = timers[index];
+    timer.tick = deadline_nanoseconds <= 0
+                 ? 0
+                 : static_cast<uint64_t>(-arithmetic::floor_div(-deadline_nanoseconds,
+                                                                resolution_nanoseconds));
+    timer.callback = std::move(callback);
+    pending++;
+
+    insert(index);
+    return static_cast<TimerId>(timer.generation) << 32 | index;
+}
+
+void TimerWheel::insert(uint32_t index)
+{
+    uint64_t tick = timers[index].tick;
+    if (tick <= current_tick)
+    {
+        link(index, DUE_LIST);
+        return;
+    }
+
+    // The wheel is the group of bits the deadline first differs from the current tick in.
+    // Every tick between them shares the higher groups, so the timer stays put until the
+    // current tick reaches its slot.
+    int level = (std::bit_width(tick ^ current_tick) - 1) / BITS_PER_LEVEL;
+    uint32_t slot = (tick >> (level * BITS_PER_LEVEL)) & (SLOTS_PER_LEVEL - 1);
+    link(index, level * SLOTS_PER_LEVEL + slot);
+}
+
+void TimerWheel::link(uint32_t index, uint32_t list)
+{
+    Timer& timer = timers[index];
+    List& to = lists[list];
+
+    timer.list = list;
+    timer.prev = to.last;
+    timer.next = NONE;
+    if (to.last == NONE)
+        to.first = index;
+    else
+        timers[to.last].next = index;
+    to.last = index;
+
+    if (list < DUE_LIST)
+        occupied[list / SLOTS_PER_LEVEL][list % SLOTS_PER_LEVEL / 64] |= uint64_t(1) << list % 64;
+}
+
+void TimerWheel::unlink(uint32_t index)
+{
+    Timer& timer = timers[index];
+    List& from = lists[timer.list];
+
+    if (timer.prev == NONE)
+        from.first = timer.next;
+    else
+        timers[timer.prev].next = timer.next;
+    if (timer.next == NONE)
+        from.last = timer.prev;
+    else
+        timers[timer.next].prev = timer.prev;
+
+    if (from.first == NONE && timer.list < DUE_LIST)
+        occupied[timer.list / SLOTS_PER_LEVEL][timer.list % SLOTS_PER_LEVEL / 64]
+            &= ~(uint64_t(1) << timer.list % 64);
+
+    timer.list = NONE;
+}
+
+void TimerWheel::splice(uint32_t from, uint32_t to)
+{
+    while (lists[from].first != NONE)
+    {
+        uint32_t index = lists[from].first;
+        unlink(index);
+        link(index, to);
+    }
+}
+
+void TimerWheel::cascade(int level, uint32_t slot)
+{
+    uint32_t list = level * SLOTS_PER_LEVEL + slot;
+    while (lists[list].first != NONE)
+    {
+        uint32_t index = lists[list].first;
+        unlink(index);
+
+        // Due on this very tick, whose slot is about to be fired.
+        if (timers[index].tick == current_tick)
+            link(index, FIRING_LIST);
+        else
+            insert(index);
+    }
+}
+
+void TimerWheel::release(uint32_t index)
+{
+    Timer& timer = timers[index];
+    timer.callback = nullptr;
+    // Skips 0, so no 'TimerId' is ever 'INVALID_TIMER'.
+    if (++timer.generation == 0)
+        timer.generation = 1;
+    timer.next = free_timers;
+    free_timers = index;
+    pending--;
+}
+
+size_t TimerWheel::fire()
+{
+    size_t fired = 0;
+    while (lists[FIRING_LIST].first != NONE)
+    {
+        uint32_t index = lists[FIRING_LIST].first;
+        unlink(index);
+
+        // Freed before running, so the callback can reuse the timer and 'timers' can grow.
+        Callback callback = std::move(timers[index].callback);
+        release(index);
+
+        fired++;
+        callback();
+    }
+    return fired;
+}
+
+uint64_t TimerWheel::next_event() const
+{
+    // Every timer in a wheel is in a slot after the current tick's slot of that wheel, and all
+    // of a lower wheel's slots come before the next slot of a higher one, so the first wheel
+    // with a timer has the next event.
+    for (int level = 0; level < LEVELS; level++)
+    {
+        int shift = level * BITS_PER_LEVEL;
+        uint32_t current_slot = (current_tick >> shift) & (SLOTS_PER_LEVEL - 1);
+        int slot = next_set_bit(occupied[level], current_slot);
+        if (slot < 0)
+            continue;
+
+        uint64_t above = shift + BITS_PER_LEVEL < 64
+                         ? current_tick >> (shift + BITS_PER_LEVEL) << (shift + BITS_PER_LEVEL)
+                         : 0;
+        return above | static_cast<uint64_t>(slot) << shift;
+    }
+    return UINT64_MAX;
+}
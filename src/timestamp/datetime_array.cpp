@@ -0,0 +1,333 @@
+#include "datetime/timestamp/datetime_array.h"
+#include "../util/arithmetic.h"
+#include "../util/cpu.h"
+#include <cstring>
+
+#if DATETIME_HAS_X86_KERNELS
+#include <immintrin.h>
+#endif
+
+namespace
+{
+/**
+ * Gets the nanoseconds to subtract from UTC to get the local time in 'timezone'.
+ */
+int64_t offset_nanoseconds(Timezone timezone)
+{
+    return timezone.utc_offset_minutes * Timestamp::NANOSECONDS_PER_MINUTE;
+}
+
+/**
+ * Gets the nanoseconds in one 'component', or in an hour for 'TimeComponent::TIMEZONE', like
+ * 'Time::floor'.
+ */
+int64_t nanoseconds_per(TimeComponent component)
+{
+    switch (component)
+    {
+    case TimeComponent::MINUTE:
+        return Timestamp::NANOSECONDS_PER_MINUTE;
+    case TimeComponent::SECOND:
+        return Timestamp::NANOSECONDS_PER_SECOND;
+    case TimeComponent::MILLISECOND:
+        return Timestamp::NANOSECONDS_PER_MILLISECOND;
+    case TimeComponent::MICROSECOND:
+        return Timestamp::NANOSECONDS_PER_MICROSECOND;
+    case TimeComponent::NANOSECOND:
+        return 1;
+    default:
+        return Timestamp::NANOSECONDS_PER_HOUR;
+    }
+}
+
+/**
+ * Gets the nanoseconds 'local' is past the start of its 'unit', rounding towards negative
+ * infinity, so it is never negative.
+ */
+int64_t floor_mod(int64_t local, int64_t unit)
+{
+    return local - arithmetic::floor_div(local, unit) * unit;
+}
+
+/**
+ * Sets each of 'out' to 'compare' of the matching element of 'values'.
+ *
+ * Kept to a loop of compares and stores, which the compiler vectorizes.
+ */
+template<typename Compare>
+void compare_each(std::span<const int64_t> values, uint8_t* out, Compare compare)
+{
+    for (size_t i = 0; i < values.size(); i++)
+        out[i] = compare(values[i]);
+}
+
+#if DATETIME_HAS_X86_KERNELS
+/**
+ * 'compare_each' compiled for AVX2, whose 64 bit compares let the compiler vectorize it.
+ */
+template<typename Compare>
+DATETIME_TARGET_AVX2 void compare_each_avx2(std::span<const int64_t> values, uint8_t* out,
+                                            Compare compare)
+{
+    compare_each(values, out, compare);
+}
+#endif
+
+/**
+ * Gets 'compare' of each element of 'values'.
+ */
+template<typename Compare>
+std::vector<uint8_t> mask(std::span<const int64_t> values, Compare compare)
+{
+    std::vector<uint8_t> out(values.size());
+
+#if DATETIME_HAS_X86_KERNELS
+    if (cpu::has_avx2())
+    {
+        compare_each_avx2(values, out.data(), compare);
+        return out;
+    }
+#endif
+    compare_each(values, out.data(), compare);
+    return out;
+}
+
+void floor_scalar(std::span<int64_t> values, int64_t offset, int64_t unit)
+{
+    for (int64_t& value : values)
+        value -= floor_mod(value - offset, unit);
+}
+
+void day_of_week_scalar(std::span<const int64_t> values, int64_t offset, uint8_t* out)
+{
+    for (size_t i = 0; i < values.size(); i++)
+    {
+        int64_t days = arithmetic::floor_div(values[i] - offset, Timestamp::NANOSECONDS_PER_DAY);
+        out[i] = static_cast<uint8_t>(floor_mod(days + Date::THURSDAY, 7));
+    }
+}
+
+#if DATETIME_HAS_X86_KERNELS
+/*
+ * AVX2 has no 64 bit division, multiplication, or conversion to and from double, which is why the
+ * compiler leaves 'floor_scalar' and 'day_of_week_scalar' alone. The kernels divide in doubles,
+ * which is off by at most one for quotients below 2^51, and correct the remainder in integers.
+ */
+
+/**
+ * Converts each 'int64_t' of 'values' to the nearest double.
+ */
+DATETIME_TARGET_AVX2 __m256d to_double(__m256i values)
+{
+    // Puts the high and low 32 bits into the mantissas of 2^84 + 2^63 and 2^52, so subtracting
+    // the constants and adding the halves gives the value, rounded once.
+    const __m256i high_magic = _mm256_set1_epi64x(0x4530000080000000);
+    const __m256d all_magic = _mm256_castsi256_pd(_mm256_set1_epi64x(0x4530000080100000));
+    const __m256i low_magic = _mm256_set1_epi64x(0x4330000000000000);
+
+    __m256i low = _mm256_blend_epi32(low_magic, values, 0b01010101);
+    __m256i high = _mm256_xor_si256(_mm256_srli_epi64(values, 32), high_magic);
+    return _mm256_add_pd(_mm256_sub_pd(_mm256_castsi256_pd(high), all_magic),
+                         _mm256_castsi256_pd(low));
+}
+
+/**
+ * Converts each double of 'values', a whole number below 2^51 in magnitude, to an 'int64_t'.
+ */
+DATETIME_TARGET_AVX2 __m256i to_int64(__m256d values)
+{
+    // Adding 2^52 + 2^51 lines the whole number up with the bottom of the mantissa.
+    const __m256d magic = _mm256_set1_pd(6755399441055744.0);
+    return _mm256_sub_epi64(_mm256_castpd_si256(_mm256_add_pd(values, magic)),
+                            _mm256_castpd_si256(magic));
+}
+
+/**
+ * Multiplies each 'int64_t' of 'a' by the matching one of 'b', keeping the low 64 bits.
+ */
+DATETIME_TARGET_AVX2 __m256i multiply(__m256i a, __m256i b)
+{
+    __m256i low = _mm256_mul_epu32(a, b);
+    __m256i cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(a, 32), b),
+                                     _mm256_mul_epu32(a, _mm256_srli_epi64(b, 32)));
+    return _mm256_add_epi64(low, _mm256_slli_epi64(cross, 32));
+}
+
+/**
+ * Divides each 'int64_t' of 'values' by 'unit', rounding towards negative infinity.
+ *
+ * @param values numbers to divide, each below 2^51 times 'unit' in magnitude.
+ * @param unit number to divide by, positive.
+ * @param quotient set to the quotients.
+ *
+ * @return the remainders, from 0 up to, but not including, 'unit'.
+ */
+DATETIME_TARGET_AVX2 __m256i floor_div_mod(__m256i values, int64_t unit, __m256i& quotient)
+{
+    __m256i units = _mm256_set1_epi64x(unit);
+    __m256d reciprocal = _mm256_set1_pd(1.0 / static_cast<double>(unit));
+    __m256d estimate = _mm256_floor_pd(_mm256_mul_pd(to_double(values), reciprocal));
+    quotient = to_int64(estimate);
+    __m256i remainder = _mm256_sub_epi64(values, multiply(quotient, units));
+
+    // All ones where the estimate was one too high or one too low.
+    __m256i under = _mm256_cmpgt_epi64(_mm256_setzero_si256(), remainder);
+    __m256i over = _mm256_cmpgt_epi64(remainder, _mm256_sub_epi64(units, _mm256_set1_epi64x(1)));
+    quotient = _mm256_add_epi64(_mm256_sub_epi64(quotient, over), under);
+    remainder = _mm256_add_epi64(remainder, _mm256_and_si256(under, units));
+    return _mm256_sub_epi64(remainder, _mm256_and_si256(over, units));
+}
+
+DATETIME_TARGET_AVX2 void floor_avx2(std::span<int64_t> values, int64_t offset, int64_t unit)
+{
+    // A microsecond is too small to divide the whole range in doubles, so the remainder of a
+    // millisecond is divided instead, which has the same remainder of a microsecond.
+    bool two_steps = unit < Timestamp::NANOSECONDS_PER_MILLISECOND;
+    int64_t first_unit = two_steps ? Timestamp::NANOSECONDS_PER_MILLISECOND : unit;
+
+    __m256i offsets = _mm256_set1_epi64x(offset);
+    __m256i quotient;
+    size_t i = 0;
+    for (; i + 4 <= values.size(); i += 4)
+    {
+        auto* pointer = reinterpret_cast<__m256i*>(values.data() + i);
+        __m256i value = _mm256_loadu_si256(pointer);
+        __m256i remainder = floor_div_mod(_mm256_sub_epi64(value, offsets), first_unit, quotient);
+        if (two_steps)
+            remainder = floor_div_mod(remainder, unit, quotient);
+        _mm256_storeu_si256(pointer, _mm256_sub_epi64(value, remainder));
+    }
+    floor_scalar(values.subspan(i), offset, unit);
+}
+
+DATETIME_TARGET_AVX2 void day_of_week_avx2(std::span<const int64_t> values, int64_t offset,
+                                           uint8_t* out)
+{
+    __m256i offsets = _mm256_set1_epi64x(offset);
+    __m256i thursdays = _mm256_set1_epi64x(Date::THURSDAY);
+    __m256i low_halves = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+    __m256i days;
+    __m256i weeks;
+    size_t i = 0;
+    for (; i + 4 <= values.size(); i += 4)
+    {
+        __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values.data() + i));
+        floor_div_mod(_mm256_sub_epi64(value, offsets), Timestamp::NANOSECONDS_PER_DAY, days);
+        __m256i day_of_week = floor_div_mod(_mm256_add_epi64(days, thursdays), 7, weeks);
+
+        // Each day of the week is in the low byte of its 64 bits; packs the four into 4 bytes.
+        __m128i packed = _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(day_of_week,
+                                                                             low_halves));
+        packed = _mm_packus_epi16(_mm_packus_epi32(packed, packed), packed);
+        int32_t bytes = _mm_cvtsi128_si32(packed);
+        std::memcpy(out + i, &bytes, sizeof(bytes));
+    }
+    day_of_week_scalar(values.subspan(i), offset, out + i);
+}
+#endif
+}
+
+DatetimeArray::DatetimeArray(std::span<const Datetime> datetimes, Timezone timezone) :
+    timezone(timezone)
+{
+    epoch_nanoseconds.reserve(datetimes.size());
+    for (const Datetime& datetime : datetimes)
+        epoch_nanoseconds.push_back(Timestamp(datetime).epoch_nanoseconds);
+}
+
+std::vector<Datetime> DatetimeArray::to_datetimes() const
+{
+    std::vector<Datetime> datetimes;
+    datetimes.reserve(epoch_nanoseconds.size());
+    for (int64_t nanoseconds : epoch_nanoseconds)
+        datetimes.push_back(Timestamp(nanoseconds).datetime(timezone));
+    return datetimes;
+}
+
+DatetimeArray& DatetimeArray::operator+=(const TimeDelta& time_delta)
+{
+    int64_t nanoseconds = time_delta.total_nanoseconds();
+    for (int64_t& value : epoch_nanoseconds)
+        value += nanoseconds;
+    return *this;
+}
+
+DatetimeArray& DatetimeArray::operator-=(const TimeDelta& time_delta)
+{
+    int64_t nanoseconds = time_delta.total_nanoseconds();
+    for (int64_t& value : epoch_nanoseconds)
+        value -= nanoseconds;
+    return *this;
+}
+
+DatetimeArray& DatetimeArray::floor(TimeComponent to)
+{
+    int64_t unit = nanoseconds_per(to);
+    if (unit == 1)
+        return *this;
+
+#if DATETIME_HAS_X86_KERNELS
+    if (cpu::has_avx2())
+    {
+        floor_avx2(epoch_nanoseconds, offset_nanoseconds(timezone), unit);
+        return *this;
+    }
+#endif
+    floor_scalar(epoch_nanoseconds, offset_nanoseconds(timezone), unit);
+    return *this;
+}
+
+std::vector<uint8_t> DatetimeArray::day_of_week() const
+{
+    std::vector<uint8_t> out(epoch_nanoseconds.size());
+
+#if DATETIME_HAS_X86_KERNELS
+    if (cpu::has_avx2())
+    {
+        day_of_week_avx2(epoch_nanoseconds, offset_nanoseconds(timezone), out.data());
+        return out;
+    }
+#endif
+    day_of_week_scalar(epoch_nanoseconds, offset_nanoseconds(timezone), out.data());
+    return out;
+}
+
+std::vector<uint8_t> DatetimeArray::less(const Datetime& datetime) const
+{
+    int64_t bound = Timestamp(datetime).epoch_nanoseconds;
+    return mask(epoch_nanoseconds, [bound](int64_t value) { return value < bound; });
+}
+
+std::vector<uint8_t> DatetimeArray::less_equal(const Datetime& datetime) const
+{
+    int64_t bound = Timestamp(datetime).epoch_nanoseconds;
+    return mask(epoch_nanoseconds, [bound](int64_t value) { return value <= bound; });
+}
+
+std::vector<uint8_t> DatetimeArray::greater(const Datetime& datetime) const
+{
+    int64_t bound = Timestamp(datetime).epoch_nanoseconds;
+    return mask(epoch_nanoseconds, [bound](int64_t value) { return value > bound; });
+}
+
+std::vector<uint8_t> DatetimeArray::greater_equal(const Datetime& datetime) const
+{
+    int64_t bound = Timestamp(datetime).epoch_nanoseconds;
+    return mask(epoch_nanoseconds, [bound](int64_t value) { return value >= bound; });
+}
+
+std::vector<uint8_t> DatetimeArray::equal(const Datetime& datetime) const
+{
+    int64_t bound = Timestamp(datetime).epoch_nanoseconds;
+    return mask(epoch_nanoseconds, [bound](int64_t value) { return value == bound; });
+}
+
+std::vector<uint8_t> DatetimeArray::between(const Datetime& begin, const Datetime& end) const
+{
+    int64_t first = Timestamp(begin).epoch_nanoseconds;
+    int64_t last = Timestamp(end).epoch_nanoseconds;
+    return mask(epoch_nanoseconds, [first, last](int64_t value)
+    {
+        return (value >= first) & (value < last);
+    });
+}
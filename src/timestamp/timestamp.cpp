@@ -0,0 +1,80 @@
+#include "datetime/timestamp/timestamp.h"
+
+namespace
+{
+/**
+ * Splits 'nanoseconds' into whole days and the nanoseconds remaining in the last day.
+ *
+ * Rounds towards negative infinity, so the remaining nanoseconds are never negative.
+ *
+ * @param nanoseconds nanoseconds to split.
+ *
+ * @return the whole days and the remaining nanoseconds.
+ */
+std::pair<int64_t, int64_t> split_days(int64_t nanoseconds)
+{
+    int64_t days = nanoseconds / Timestamp::NANOSECONDS_PER_DAY;
+    int64_t remainder = nanoseconds % Timestamp::NANOSECONDS_PER_DAY;
+    if (remainder < 0)
+    {
+        remainder += Timestamp::NANOSECONDS_PER_DAY;
+        days--;
+    }
+    return {days, remainder};
+}
+}
+
+Timestamp::Timestamp(const Datetime& datetime) :
+    epoch_nanoseconds(static_cast<int64_t>(datetime.to_ns(TZ::UTC))) {}
+
+Timestamp Timestamp::now()
+{
+    return Timestamp(Clock::now());
+}
+
+Datetime Timestamp::datetime(Timezone timezone) const
+{
+    auto [days, nanoseconds] = split_days(epoch_nanoseconds);
+
+    Datetime ret = Datetime(Date::from_day_number(days),
+                            Time(UNCHECKED,
+                                 nanoseconds / NANOSECONDS_PER_HOUR,
+                                 nanoseconds / NANOSECONDS_PER_MINUTE % 60,
+                                 nanoseconds / NANOSECONDS_PER_SECOND % 60,
+                                 nanoseconds / NANOSECONDS_PER_MILLISECOND % 1'000,
+                                 nanoseconds / NANOSECONDS_PER_MICROSECOND % 1'000,
+                                 nanoseconds % 1'000,
+                                 TZ::UTC));
+
+    ret.set_timezone(timezone);
+
+    return ret;
+}
+
+Date Timestamp::date(Timezone timezone) const
+{
+    return datetime(timezone).date();
+}
+
+Time Timestamp::time(Timezone timezone) const
+{
+    return datetime(timezone).time();
+}
+
+TimeDelta operator-(Timestamp timestamp, Timestamp other)
+{
+    auto [days, nanoseconds] = split_days(timestamp.epoch_nanoseconds - other.epoch_nanoseconds);
+
+    return TimeDelta(days,
+                     nanoseconds / Timestamp::NANOSECONDS_PER_HOUR,
+                     nanoseconds / Timestamp::NANOSECONDS_PER_MINUTE % 60,
+                     nanoseconds / Timestamp::NANOSECONDS_PER_SECOND % 60,
+                     nanoseconds / Timestamp::NANOSECONDS_PER_MILLISECOND % 1'000,
+                     nanoseconds / Timestamp::NANOSECONDS_PER_MICROSECOND % 1'000,
+                     nanoseconds % 1'000);
+}
+
+std::ostream& operator<<(std::ostream& os, const Timestamp& timestamp)
+{
+    return os << timestamp.datetime(TZ::UTC);
+}
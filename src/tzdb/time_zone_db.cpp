@@ -0,0 +1,140 @@
+#include "datetime/tzdb/time_zone_db.h"
+#include <cstdlib>
+#include <fmt/format.h>
+#include <stdexcept>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <fstream>
+#include <sstream>
+#endif
+
+namespace
+{
+#if defined(__unix__) || defined(__APPLE__)
+/**
+ * Read only memory mapping of a whole file, unmapped when destroyed.
+ */
+class MappedFile
+{
+public:
+    /**
+     * Maps the file at 'path'.
+     *
+     * @return 'false' if the file could not be opened or mapped.
+     */
+    bool open(const std::string& path)
+    {
+        int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0)
+            return false;
+
+        struct stat status;
+        if (fstat(fd, &status) == 0 && S_ISREG(status.st_mode) && status.st_size > 0)
+        {
+            size = static_cast<size_t>(status.st_size);
+            address = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (address == MAP_FAILED)
+                address = nullptr;
+        }
+        close(fd);
+        return address != nullptr;
+    }
+
+    std::string_view data() const
+    {
+        return std::string_view(static_cast<const char*>(address), size);
+    }
+
+    ~MappedFile()
+    {
+        if (address != nullptr)
+            munmap(address, size);
+    }
+
+private:
+    void* address = nullptr;
+    size_t size = 0;
+};
+#else
+/**
+ * Whole file read into memory, on systems without 'mmap'.
+ */
+class MappedFile
+{
+public:
+    bool open(const std::string& path)
+    {
+        std::ifstream file = std::ifstream(path, std::ios::binary);
+        if (!file)
+            return false;
+        std::ostringstream stream;
+        stream << file.rdbuf();
+        contents = std::move(stream).str();
+        return !contents.empty();
+    }
+
+    std::string_view data() const
+    {
+        return contents;
+    }
+
+private:
+    std::string contents;
+};
+#endif
+}
+
+TimeZoneDB::TimeZoneDB(std::string directory) :
+    directory(std::move(directory)) {}
+
+TimeZoneDB& TimeZoneDB::system()
+{
+    static TimeZoneDB db = TimeZoneDB([] {
+        const char* tzdir = std::getenv("TZDIR");
+        return std::string(tzdir != nullptr && *tzdir != '\0' ? tzdir : "/usr/share/zoneinfo");
+    }());
+    return db;
+}
+
+const std::string& TimeZoneDB::get_directory() const
+{
+    return directory;
+}
+
+const ZoneInfo& TimeZoneDB::get(std::string_view name)
+{
+    std::lock_guard lock = std::lock_guard(mutex);
+    auto it = zones.find(name);
+    if (it == zones.end())
+        it = zones.emplace(std::string(name), load(name)).first;
+    return *it->second;
+}
+
+Datetime TimeZoneDB::convert(const Datetime& instant, std::string_view to_zone)
+{
+    return get(to_zone).to_local(instant);
+}
+
+Datetime TimeZoneDB::convert_local(const Datetime& local, std::string_view from_zone,
+                                   std::string_view to_zone)
+{
+    return get(to_zone).to_local(get(from_zone).from_local(local));
+}
+
+std::unique_ptr<ZoneInfo> TimeZoneDB::load(std::string_view name) const
+{
+    // Names are paths below the directory, and must stay below it.
+    if (name.empty() || name.front() == '/' || name.find("..") != std::string_view::npos)
+        throw std::invalid_argument(fmt::format("'{}' is not a valid time zone name", name));
+
+    MappedFile file;
+    if (!file.open(fmt::format("{}/{}", directory, name)))
+        throw std::invalid_argument(fmt::format("Unknown time zone '{}'", name));
+
+    return std::make_unique<ZoneInfo>(ZoneInfo::from_tzif(std::string(name), file.data()));
+}
@@ -0,0 +1,115 @@
+#include "datetime/tzdb/zone_converter.h"
+#include "../util/arithmetic.h"
+#include "../util/macros.h"
+#include <fmt/format.h>
+#include <stdexcept>
+
+namespace
+{
+/**
+ * Converts seconds to nanoseconds, keeping the open ends of intervals open.
+ */
+int64_t to_nanoseconds(int64_t seconds)
+{
+    if (seconds <= INT64_MIN / Timestamp::NANOSECONDS_PER_SECOND)
+        return INT64_MIN;
+    if (seconds >= INT64_MAX / Timestamp::NANOSECONDS_PER_SECOND)
+        return INT64_MAX;
+    return seconds * Timestamp::NANOSECONDS_PER_SECOND;
+}
+}
+
+ZoneConverter::ZoneConverter(const ZoneInfo& from, const ZoneInfo& to) :
+    from(&from),
+    to(&to) {}
+
+ZoneConverter::ZoneConverter(Timezone from, Timezone to)
+{
+    // A fixed offset holds forever, so its interval is every time there is.
+    from_cache = {INT64_MIN, UINT64_MAX,
+                  from.utc_offset_minutes * Timestamp::NANOSECONDS_PER_MINUTE};
+    to_cache = {INT64_MIN, UINT64_MAX, -to.utc_offset_minutes * Timestamp::NANOSECONDS_PER_MINUTE};
+}
+
+Timestamp ZoneConverter::convert(Timestamp local)
+{
+    Timestamp out;
+    convert(std::span<const Timestamp>(&local, 1), std::span<Timestamp>(&out, 1));
+    return out;
+}
+
+void ZoneConverter::convert(std::span<const Timestamp> local, std::span<Timestamp> out)
+{
+    ASSERT(local.size() == out.size(),
+           std::invalid_argument(fmt::format("Output has {} elements, but the input has {}",
+                                             out.size(), local.size())));
+
+    uint64_t misses = 0;
+    for (size_t i = 0; i < local.size(); i++)
+    {
+        int64_t nanoseconds = local[i].epoch_nanoseconds;
+        if (from_cache.contains(nanoseconds) && to_cache.contains(nanoseconds + from_cache.add))
+        {
+            out[i].epoch_nanoseconds = nanoseconds + from_cache.add + to_cache.add;
+            continue;
+        }
+
+        misses++;
+        int64_t utc = from_cache.contains(nanoseconds) ? nanoseconds + from_cache.add
+                                                       : miss_from(nanoseconds);
+        out[i].epoch_nanoseconds = to_cache.contains(utc) ? utc + to_cache.add : miss_to(utc);
+    }
+
+    stats.hits += local.size() - misses;
+    stats.misses += misses;
+}
+
+ZoneConverter::Stats ZoneConverter::convert(std::span<const Timestamp> local, Timezone from,
+                                            Timezone to, std::span<Timestamp> out)
+{
+    ZoneConverter converter = ZoneConverter(from, to);
+    converter.convert(local, out);
+    return converter.stats;
+}
+
+const ZoneConverter::Stats& ZoneConverter::get_stats() const
+{
+    return stats;
+}
+
+void ZoneConverter::reset_stats()
+{
+    stats = Stats();
+}
+
+int64_t ZoneConverter::miss_from(int64_t local)
+{
+    if (from == nullptr)
+        return local + from_cache.add;
+
+    ZoneInfo::Interval interval = from->local_interval_at(
+        arithmetic::floor_div(local, Timestamp::NANOSECONDS_PER_SECOND));
+
+    int64_t begin = to_nanoseconds(interval.begin);
+    from_cache.begin = begin;
+    from_cache.length = static_cast<uint64_t>(to_nanoseconds(interval.end))
+                        - static_cast<uint64_t>(begin);
+    from_cache.add = interval.utc_offset_seconds * Timestamp::NANOSECONDS_PER_SECOND;
+    return local + from_cache.add;
+}
+
+int64_t ZoneConverter::miss_to(int64_t utc)
+{
+    if (to == nullptr)
+        return utc + to_cache.add;
+
+    ZoneInfo::Interval interval = to->interval_at(
+        arithmetic::floor_div(utc, Timestamp::NANOSECONDS_PER_SECOND));
+
+    int64_t begin = to_nanoseconds(interval.begin);
+    to_cache.begin = begin;
+    to_cache.length = static_cast<uint64_t>(to_nanoseconds(interval.end))
+                      - static_cast<uint64_t>(begin);
+    to_cache.add = -interval.utc_offset_seconds * Timestamp::NANOSECONDS_PER_SECOND;
+    return utc + to_cache.add;
+}
@@ -0,0 +1,561 @@
+#include "datetime/tzdb/zone_info.h"
+#include "datetime/timestamp/timestamp.h"
+#include "../util/arithmetic.h"
+#include "../util/macros.h"
+#include <algorithm>
+#include <fmt/format.h>
+#include <optional>
+#include <stdexcept>
+
+namespace
+{
+constexpr int64_t SECONDS_PER_DAY = 86'400;
+
+/**
+ * Reads big-endian TZif data, checking every read against the end of the data.
+ */
+struct Reader
+{
+    std::string_view data;
+    size_t pos = 0;
+
+    /**
+     * Gets the next 'size' bytes and moves past them.
+     *
+     * @throws std::runtime_error if there are fewer than 'size' bytes left.
+     */
+    std::string_view take(size_t size)
+    {
+        if (data.size() - pos < size)
+            throw std::runtime_error("TZif data ends early");
+        std::string_view bytes = data.substr(pos, size);
+        pos += size;
+        return bytes;
+    }
+
+    /**
+     * Reads a big-endian signed integer of 'size' bytes.
+     */
+    int64_t integer(size_t size)
+    {
+        std::string_view bytes = take(size);
+        uint64_t value = 0;
+        for (char byte : bytes)
+            value = value << 8 | static_cast<uint8_t>(byte);
+
+        // Sign extends from the top bit of the last byte read.
+        int unused = 64 - static_cast<int>(size) * 8;
+        return static_cast<int64_t>(value << unused) >> unused;
+    }
+};
+
+/**
+ * Counts from the header of a TZif data block.
+ */
+struct Header
+{
+    char version;
+    int64_t isutcnt, isstdcnt, leapcnt, timecnt, typecnt, charcnt;
+
+    /**
+     * Size of the data block that follows the header.
+     */
+    int64_t block_size(int time_size) const
+    {
+        return timecnt * time_size + timecnt + typecnt * 6 + charcnt + leapcnt * (time_size + 4)
+               + isstdcnt + isutcnt;
+    }
+};
+
+Header read_header(Reader& reader)
+{
+    if (reader.take(4) != "TZif")
+        throw std::runtime_error("Not TZif data");
+
+    Header header;
+    header.version = reader.take(1)[0];
+    reader.take(15);
+    header.isutcnt = reader.integer(4);
+    header.isstdcnt = reader.integer(4);
+    header.leapcnt = reader.integer(4);
+    header.timecnt = reader.integer(4);
+    header.typecnt = reader.integer(4);
+    header.charcnt = reader.integer(4);
+
+    // RFC 8536 requires at least one local time type and one character of abbreviations.
+    if (header.isutcnt < 0 || header.isstdcnt < 0 || header.leapcnt < 0 || header.timecnt < 0
+        || header.typecnt <= 0 || header.typecnt > 256 || header.charcnt <= 0)
+        throw std::runtime_error("Invalid TZif header");
+    return header;
+}
+
+/**
+ * Date of a POSIX TZ rule, in one of its three forms.
+ */
+struct RuleDate
+{
+    enum Kind
+    {
+        /**
+         * 'Jn': day 'day' from 1 to 365, never counting February 29.
+         */
+        JULIAN_NO_LEAP,
+
+        /**
+         * 'n': day 'day' from 0 to 365, counting February 29.
+         */
+        JULIAN,
+
+        /**
+         * 'Mm.w.d': weekday 'day' of week 'week' of 'month', week 5 being the last.
+         */
+        MONTH_WEEK_DAY
+    };
+
+    Kind kind;
+    int month = 0;
+    int week = 0;
+    int day = 0;
+
+    /**
+     * Local time of day the change happens at, in seconds. May be negative or past a day.
+     */
+    int64_t time = 2 * 3'600;
+
+    /**
+     * Gets the day number of this date in 'year'.
+     */
+    int64_t day_number(int year) const
+    {
+        int64_t first_of_year = Date(UNCHECKED, year, 1, 1).to_day_number();
+        bool leap = year % 4 == 0 && (year % 100 != 0 || year % 400 == 0);
+        switch (kind)
+        {
+            case JULIAN_NO_LEAP:
+                return first_of_year + day - 1 + (leap && day >= 60);
+            case JULIAN:
+                return first_of_year + day;
+            case MONTH_WEEK_DAY:
+                break;
+        }
+
+        int64_t first = Date(UNCHECKED, year, month, 1).to_day_number();
+        int64_t next_first = month == 12 ? Date(UNCHECKED, year + 1, 1, 1).to_day_number()
+                                         : Date(UNCHECKED, year, month + 1, 1).to_day_number();
+        // Day 0 was a Thursday.
+        int64_t first_weekday = (first + 4) % 7;
+        int64_t result = first + (day - first_weekday + 7) % 7 + (week - 1) * 7;
+        while (result >= next_first)
+            result -= 7;
+        return result;
+    }
+};
+
+/**
+ * POSIX TZ rule, as in a TZif footer, such as "EST5EDT,M3.2.0,M11.1.0".
+ */
+struct Rule
+{
+    std::string_view std_abbreviation;
+    int32_t std_offset = 0;
+    bool has_dst = false;
+    std::string_view dst_abbreviation;
+    int32_t dst_offset = 0;
+    RuleDate start;
+    RuleDate end;
+};
+
+/**
+ * Parses a POSIX TZ rule. Offsets are positive west of UTC, as in the rule itself.
+ */
+class RuleParser
+{
+public:
+    explicit RuleParser(std::string_view text) : text(text) {}
+
+    std::optional<Rule> parse()
+    {
+        Rule rule;
+        if (!abbreviation(rule.std_abbreviation) || !offset(rule.std_offset))
+            return std::nullopt;
+        if (done())
+            return rule;
+
+        rule.has_dst = true;
+        if (!abbreviation(rule.dst_abbreviation))
+            return std::nullopt;
+        rule.dst_offset = rule.std_offset - 3'600;
+        if (!done() && peek() != ',' && !offset(rule.dst_offset))
+            return std::nullopt;
+
+        if (!consume(',') || !date(rule.start) || !consume(',') || !date(rule.end) || !done())
+            return std::nullopt;
+        return rule;
+    }
+
+private:
+    bool done() const
+    {
+        return pos == text.size();
+    }
+
+    char peek() const
+    {
+        return done() ? '\0' : text[pos];
+    }
+
+    bool consume(char c)
+    {
+        if (peek() != c)
+            return false;
+        pos++;
+        return true;
+    }
+
+    bool number(int& value)
+    {
+        size_t start = pos;
+        value = 0;
+        while (peek() >= '0' && peek() <= '9' && pos - start < 3)
+            value = value * 10 + (text[pos++] - '0');
+        return pos > start;
+    }
+
+    bool abbreviation(std::string_view& value)
+    {
+        size_t start = pos;
+        if (consume('<'))
+        {
+            while (!done() && peek() != '>')
+                pos++;
+            value = text.substr(start + 1, pos - start - 1);
+            return consume('>') && value.size() >= 3;
+        }
+        while ((peek() >= 'A' && peek() <= 'Z') || (peek() >= 'a' && peek() <= 'z'))
+            pos++;
+        value = text.substr(start, pos - start);
+        return value.size() >= 3;
+    }
+
+    /**
+     * Parses '[+|-]hh[:mm[:ss]]' into seconds.
+     */
+    bool offset(int32_t& value)
+    {
+        int sign = 1;
+        if (consume('-'))
+            sign = -1;
+        else
+            consume('+');
+        int hours, minutes = 0, seconds = 0;
+        if (!number(hours))
+            return false;
+        if (consume(':') && (!number(minutes) || (consume(':') && !number(seconds))))
+            return false;
+        value = sign * (hours * 3'600 + minutes * 60 + seconds);
+        return true;
+    }
+
+    bool date(RuleDate& value)
+    {
+        if (consume('M'))
+        {
+            value.kind = RuleDate::MONTH_WEEK_DAY;
+            if (!number(value.month) || !consume('.') || !number(value.week) || !consume('.')
+                || !number(value.day) || value.month < 1 || value.month > 12 || value.week < 1
+                || value.week > 5 || value.day > 6)
+                return false;
+        }
+        else
+        {
+            value.kind = consume('J') ? RuleDate::JULIAN_NO_LEAP : RuleDate::JULIAN;
+            if (!number(value.day))
+                return false;
+        }
+
+        if (consume('/'))
+        {
+            int32_t time;
+            if (!offset(time))
+                return false;
+            value.time = time;
+        }
+        return true;
+    }
+
+    std::string_view text;
+    size_t pos = 0;
+};
+}
+
+Timezone ZoneInfo::Offset::get_timezone() const
+{
+    ASSERT(utc_offset_seconds % 60 == 0,
+           std::invalid_argument(fmt::format("UTC offset {} ({}s) is not a whole number of minutes",
+                                             abbreviation, -utc_offset_seconds)));
+    return Timezone(Minutes(utc_offset_seconds / 60));
+}
+
+ZoneInfo::ZoneInfo(std::string name) :
+    name(std::move(name)) {}
+
+ZoneInfo ZoneInfo::from_tzif(std::string name, std::string_view data)
+{
+    ZoneInfo zone = ZoneInfo(std::move(name));
+    Reader reader = {data};
+
+    // Version 1 data comes first in every file. Later versions follow it with the same data in
+    // 64 bit, then a footer.
+    Header header = read_header(reader);
+    int time_size = 4;
+    if (header.version >= '2')
+    {
+        reader.take(header.block_size(4));
+        header = read_header(reader);
+        time_size = 8;
+    }
+
+    zone.transitions.reserve(header.timecnt);
+    for (int64_t i = 0; i < header.timecnt; i++)
+    {
+        zone.transitions.push_back(reader.integer(time_size));
+        if (i > 0 && zone.transitions[i] <= zone.transitions[i - 1])
+            throw std::runtime_error("TZif transitions are not in ascending order");
+    }
+
+    std::string_view transition_types = reader.take(header.timecnt);
+    for (char type : transition_types)
+    {
+        if (static_cast<uint8_t>(type) >= header.typecnt)
+            throw std::runtime_error("TZif transition type out of range");
+        zone.transition_types.push_back(static_cast<uint8_t>(type));
+    }
+
+    for (int64_t i = 0; i < header.typecnt; i++)
+    {
+        // Offsets in TZif data are positive east of UTC.
+        int32_t utc_offset = static_cast<int32_t>(reader.integer(4));
+        bool is_dst = reader.integer(1) != 0;
+        int64_t abbreviation = reader.integer(1) & 0xFF;
+        if (abbreviation >= header.charcnt)
+            throw std::runtime_error("TZif abbreviation index out of range");
+        zone.types.push_back({-utc_offset, is_dst, static_cast<uint8_t>(abbreviation)});
+    }
+
+    zone.abbreviations = std::string(reader.take(header.charcnt));
+    if (zone.abbreviations.back() != '\0')
+        throw std::runtime_error("TZif abbreviations are not null terminated");
+
+    reader.take(header.leapcnt * (time_size + 4) + header.isstdcnt + header.isutcnt);
+
+    if (header.version >= '2')
+    {
+        if (reader.take(1) != "\n")
+            throw std::runtime_error("TZif footer is missing");
+        std::string_view rest = data.substr(reader.pos);
+        size_t end = rest.find('\n');
+        if (end == std::string_view::npos)
+            throw std::runtime_error("TZif footer is not terminated");
+        if (end > 0)
+            zone.extend(rest.substr(0, end));
+    }
+
+    zone.index();
+    return zone;
+}
+
+const std::string& ZoneInfo::get_name() const
+{
+    return name;
+}
+
+ZoneInfo::Offset ZoneInfo::offset_at(int64_t utc_seconds) const
+{
+    return make_offset(type_at(utc_seconds));
+}
+
+ZoneInfo::Offset ZoneInfo::offset_at(const Datetime& instant) const
+{
+    int64_t nanoseconds = Timestamp(instant).epoch_nanoseconds;
+    return offset_at(arithmetic::floor_div(nanoseconds, Timestamp::NANOSECONDS_PER_SECOND));
+}
+
+ZoneInfo::Interval ZoneInfo::interval_at(int64_t utc_seconds) const
+{
+    size_t index = transition_index(utc_seconds);
+    return {index == 0 ? INT64_MIN : transitions[index - 1],
+            index == transitions.size() ? INT64_MAX : transitions[index],
+            offset_after(index)};
+}
+
+ZoneInfo::Interval ZoneInfo::local_interval_at(int64_t local_seconds) const
+{
+    int64_t utc_seconds = local_to_utc(local_seconds);
+    size_t index = transition_index(utc_seconds);
+    int32_t offset = offset_after(index);
+
+    // Local times near a change are shared with, or skipped between, the neighbouring interval,
+    // so the interval is trimmed to the local times only it has.
+    int64_t begin = INT64_MIN;
+    if (index > 0)
+        begin = transitions[index - 1] - std::min(offset, offset_after(index - 1));
+    int64_t end = INT64_MAX;
+    if (index < transitions.size())
+        end = transitions[index] - std::max(offset, offset_after(index + 1));
+
+    if (local_seconds < begin || local_seconds >= end)
+        return {local_seconds, local_seconds, static_cast<int32_t>(utc_seconds - local_seconds)};
+    return {begin, end, offset};
+}
+
+int64_t ZoneInfo::local_to_utc(int64_t local_seconds) const
+{
+    // No zone changes its offset twice in two days, so the offsets a day either side are the
+    // only two that can apply.
+    int32_t before = types[type_at(local_seconds - SECONDS_PER_DAY)].utc_offset_seconds;
+    int32_t after = types[type_at(local_seconds + SECONDS_PER_DAY)].utc_offset_seconds;
+    if (before == after)
+        return local_seconds + before;
+
+    if (types[type_at(local_seconds + before)].utc_offset_seconds == before)
+        return local_seconds + before;
+    if (types[type_at(local_seconds + after)].utc_offset_seconds == after)
+        return local_seconds + after;
+
+    // In the gap the clocks skipped.
+    return local_seconds + before;
+}
+
+Datetime ZoneInfo::to_local(const Datetime& instant) const
+{
+    Datetime local = instant;
+    local.set_timezone(offset_at(instant).get_timezone());
+    return local;
+}
+
+Datetime ZoneInfo::from_local(const Datetime& local) const
+{
+    Datetime wall = local;
+    wall.timezone = TZ::UTC;
+    int64_t local_nanoseconds = Timestamp(wall).epoch_nanoseconds;
+    int64_t local_seconds = arithmetic::floor_div(local_nanoseconds,
+                                                  Timestamp::NANOSECONDS_PER_SECOND);
+
+    int64_t utc_seconds = local_to_utc(local_seconds);
+    int64_t utc_nanoseconds = local_nanoseconds
+                              + (utc_seconds - local_seconds) * Timestamp::NANOSECONDS_PER_SECOND;
+    return Timestamp(utc_nanoseconds).datetime(offset_at(utc_seconds).get_timezone());
+}
+
+size_t ZoneInfo::transition_index(int64_t utc_seconds) const
+{
+    size_t index;
+    if (utc_seconds >= 0 && utc_seconds < static_cast<int64_t>(BUCKETS << BUCKET_SHIFT))
+    {
+        // At most a few transitions fall in a bucket.
+        index = buckets[utc_seconds >> BUCKET_SHIFT];
+        while (index < transitions.size() && transitions[index] <= utc_seconds)
+            index++;
+    }
+    else
+    {
+        index = std::upper_bound(transitions.begin(), transitions.end(), utc_seconds)
+                - transitions.begin();
+    }
+    return index;
+}
+
+uint8_t ZoneInfo::type_at(int64_t utc_seconds) const
+{
+    size_t index = transition_index(utc_seconds);
+    return index == 0 ? 0 : transition_types[index - 1];
+}
+
+int32_t ZoneInfo::offset_after(size_t transition) const
+{
+    return types[transition == 0 ? 0 : transition_types[transition - 1]].utc_offset_seconds;
+}
+
+uint8_t ZoneInfo::find_or_add_type(int32_t utc_offset_seconds, bool is_dst,
+                                   std::string_view abbreviation)
+{
+    for (size_t i = 0; i < types.size(); i++)
+        if (types[i].utc_offset_seconds == utc_offset_seconds && types[i].is_dst == is_dst
+            && std::string_view(abbreviations.c_str() + types[i].abbreviation) == abbreviation)
+            return static_cast<uint8_t>(i);
+
+    if (types.size() == 256)
+        throw std::runtime_error("TZif data has too many local time types");
+
+    size_t position = abbreviations.find(std::string(abbreviation) + '\0');
+    if (position == std::string::npos || position > UINT8_MAX)
+    {
+        position = abbreviations.size();
+        abbreviations.append(abbreviation);
+        abbreviations.push_back('\0');
+    }
+    types.push_back({utc_offset_seconds, is_dst, static_cast<uint8_t>(position)});
+    return static_cast<uint8_t>(types.size() - 1);
+}
+
+void ZoneInfo::extend(std::string_view text)
+{
+    std::optional<Rule> rule = RuleParser(text).parse();
+    if (!rule)
+        throw std::runtime_error(fmt::format("Invalid TZ rule '{}' in TZif footer", text));
+
+    uint8_t std_type = find_or_add_type(rule->std_offset, false, rule->std_abbreviation);
+    if (!rule->has_dst)
+    {
+        // A rule without daylight saving time is in effect from the last transition on, and
+        // the table already ends with it.
+        return;
+    }
+    uint8_t dst_type = find_or_add_type(rule->dst_offset, true, rule->dst_abbreviation);
+
+    int64_t last = transitions.empty() ? INT64_MIN : transitions.back();
+    int first_year = last < 0 ? 1970
+                              : Date::from_day_number(last / SECONDS_PER_DAY).year;
+    for (int year = first_year; year <= 2100; year++)
+    {
+        // The start is in standard time, the end in daylight saving time.
+        int64_t start = rule->start.day_number(year) * SECONDS_PER_DAY + rule->start.time
+                        + rule->std_offset;
+        int64_t end = rule->end.day_number(year) * SECONDS_PER_DAY + rule->end.time
+                      + rule->dst_offset;
+
+        // South of the equator daylight saving time ends earlier in the year than it starts.
+        std::pair<int64_t, uint8_t> changes[2] = {{start, dst_type}, {end, std_type}};
+        if (end < start)
+            std::swap(changes[0], changes[1]);
+
+        for (auto [time, type] : changes)
+        {
+            if (time <= last || time > LAST_SECOND)
+                continue;
+            transitions.push_back(time);
+            transition_types.push_back(type);
+            last = time;
+        }
+    }
+}
+
+void ZoneInfo::index()
+{
+    buckets.resize(BUCKETS);
+    size_t transition = 0;
+    for (size_t bucket = 0; bucket < BUCKETS; bucket++)
+    {
+        int64_t start = static_cast<int64_t>(bucket) << BUCKET_SHIFT;
+        while (transition < transitions.size() && transitions[transition] <= start)
+            transition++;
+        buckets[bucket] = static_cast<uint32_t>(transition);
+    }
+}
+
+ZoneInfo::Offset ZoneInfo::make_offset(uint8_t type) const
+{
+    const Type& value = types[type];
+    return {value.utc_offset_seconds, value.is_dst,
+            std::string_view(abbreviations.c_str() + value.abbreviation)};
+}
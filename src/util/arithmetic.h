@@ -0,0 +1,28 @@
+#ifndef DATETIME_ARITHMETIC_H
+#define DATETIME_ARITHMETIC_H
+
+#include <cstdint>
+
+/**
+ * Integer helpers for arithmetic on dates and times.
+ */
+namespace arithmetic
+{
+/**
+ * Divides 'dividend' by 'divisor', rounding towards negative infinity instead of towards zero.
+ *
+ * @param dividend number to divide.
+ * @param divisor number to divide by. Must be positive.
+ *
+ * @return the largest integer less than or equal to 'dividend' / 'divisor'.
+ */
+constexpr int64_t floor_div(int64_t dividend, int64_t divisor)
+{
+    int64_t quotient = dividend / divisor;
+    if (dividend % divisor < 0)
+        quotient--;
+    return quotient;
+}
+}
+
+#endif //DATETIME_ARITHMETIC_H
@@ -0,0 +1,95 @@
+#ifndef DATETIME_CHARS_H
+#define DATETIME_CHARS_H
+
+#include <charconv>
+#include <cstdint>
+#include <system_error>
+
+/**
+ * Allocation free helpers for writing date and time strings into caller owned buffers.
+ */
+namespace chars
+{
+/**
+ * Writes characters into the buffer '[pos, last)', remembering if any did not fit.
+ */
+struct Writer
+{
+    /**
+     * Where the next character will be written.
+     */
+    char* pos;
+
+    /**
+     * One past the end of the buffer.
+     */
+    char* last;
+
+    /**
+     * Whether everything written so far fit in the buffer.
+     */
+    bool fits = true;
+
+    /**
+     * Writes 'c'.
+     *
+     * @param c character to write.
+     */
+    constexpr void put(char c)
+    {
+        if (pos == last)
+            fits = false;
+        else
+            *pos++ = c;
+    }
+
+    /**
+     * Writes 'value' in decimal, padded with leading zeros to at least 'min_width' digits.
+     *
+     * @param value number to write.
+     * @param min_width minimum number of digits to write. (default 1)
+     */
+    constexpr void put_number(int64_t value, int min_width = 1)
+    {
+        // Negated as unsigned, so the most negative 'int64_t' does not overflow.
+        uint64_t magnitude = static_cast<uint64_t>(value);
+        if (value < 0)
+        {
+            put('-');
+            magnitude = 0 - magnitude;
+        }
+
+        int width = 1;
+        for (uint64_t remaining = magnitude / 10; remaining != 0; remaining /= 10)
+            width++;
+        if (width < min_width)
+            width = min_width;
+
+        if (last - pos < width)
+        {
+            fits = false;
+            return;
+        }
+
+        // Fill in the digits from the least significant, which is the last to be written.
+        for (int i = width - 1; i >= 0; i--, magnitude /= 10)
+            pos[i] = static_cast<char>('0' + magnitude % 10);
+        pos += width;
+    }
+
+    /**
+     * Gets the result of the writes, in the form 'std::to_chars' returns.
+     *
+     * @return one past the last character written, or 'last' with
+     * 'std::errc::value_too_large' if everything did not fit.
+     */
+    constexpr std::to_chars_result result() const
+    {
+        if (!fits)
+            return {last, std::errc::value_too_large};
+        return {pos, std::errc()};
+    }
+};
+}
+
+#endif //DATETIME_CHARS_H
@@ -0,0 +1,88 @@
+#ifndef DATETIME_CPU_H
+#define DATETIME_CPU_H
+
+#include <cstdlib>
+#include <string_view>
+
+/**
+ * 'DATETIME_HAS_X86_KERNELS' is 1 where functions can be compiled for SSE4.1 or AVX2 with
+ * 'DATETIME_TARGET_SSE41' or 'DATETIME_TARGET_AVX2', whatever the flags of the rest of the library.
+ * They must only be called when 'cpu::has_sse41' or 'cpu::has_avx2' is 'true'.
+ */
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define DATETIME_HAS_X86_KERNELS 1
+#define DATETIME_TARGET_SSE41 __attribute__((target("sse4.1")))
+#define DATETIME_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define DATETIME_HAS_X86_KERNELS 0
+#define DATETIME_TARGET_SSE41
+#define DATETIME_TARGET_AVX2
+#endif
+
+/**
+ * Features of the CPU the library is running on, to pick between kernels at runtime.
+ */
+namespace cpu
+{
+/**
+ * Instruction sets kernels are written for, from the least to the most capable.
+ */
+enum class Level
+{
+    SCALAR,
+    SSE41,
+    AVX2
+};
+
+/**
+ * Gets the most capable 'Level' the CPU supports.
+ *
+ * The 'DATETIME_SIMD' environment variable, one of 'scalar', 'sse4.1', or 'avx2', caps it, so
+ * every kernel can be tested and benchmarked on one machine. It is read once.
+ *
+ * @return the 'Level' of the kernels to call.
+ */
+inline Level level()
+{
+    static const Level level = [] {
+        Level supported = Level::SCALAR;
+#if DATETIME_HAS_X86_KERNELS
+        if (__builtin_cpu_supports("avx2"))
+            supported = Level::AVX2;
+        else if (__builtin_cpu_supports("sse4.1"))
+            supported = Level::SSE41;
+#endif
+
+        const char* cap = std::getenv("DATETIME_SIMD");
+        std::string_view name = cap == nullptr ? "" : cap;
+        if (name == "scalar")
+            return Level::SCALAR;
+        if (name == "sse4.1" && supported > Level::SSE41)
+            return Level::SSE41;
+        return supported;
+    }();
+    return level;
+}
+
+/**
+ * Checks if SSE4.1 kernels can be called.
+ *
+ * @return 'true' if the CPU supports SSE4.1 and it is not capped, 'false' otherwise.
+ */
+inline bool has_sse41()
+{
+    return level() >= Level::SSE41;
+}
+
+/**
+ * Checks if AVX2 kernels can be called.
+ *
+ * @return 'true' if the CPU supports AVX2 and it is not capped, 'false' otherwise.
+ */
+inline bool has_avx2()
+{
+    return level() >= Level::AVX2;
+}
+}
+
+#endif //DATETIME_CPU_H
@@ -0,0 +1,186 @@
+#ifndef DATETIME_PARSE_H
+#define DATETIME_PARSE_H
+
+#include "datetime/parse/parse_error.h"
+#include <cstdint>
+#include <cstring>
+#include <expected>
+#include <limits>
+#include <stdexcept>
+#include <string_view>
+
+/**
+ * Allocation free helpers for reading the numbers out of date and time strings.
+ */
+namespace parse
+{
+/**
+ * Checks if 'c' is a decimal digit.
+ *
+ * @param c character to check.
+ *
+ * @return true if 'c' is in '0' to '9', false otherwise.
+ */
+constexpr bool is_digit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+/**
+ * Reads the 'width' digits starting at 'pos' in 'string' as a number.
+ *
+ * @param string string to read from.
+ * @param pos index of the first digit.
+ * @param width number of digits to read.
+ * @param value set to the number that was read.
+ *
+ * @return true if all 'width' characters are digits, false otherwise.
+ */
+constexpr bool fixed_digits(std::string_view string, size_t pos, size_t width, int64_t& value)
+{
+    if (pos + width > string.size())
+        return false;
+
+    value = 0;
+    for (size_t i = pos; i < pos + width; i++)
+    {
+        if (!is_digit(string[i]))
+            return false;
+        value = value * 10 + (string[i] - '0');
+    }
+    return true;
+}
+
+/**
+ * Reads the 8 characters starting at 'pos' in 'string' as a number, all at once.
+ *
+ * Loads the characters into one 64 bit word, checks they are all digits, then combines pairs,
+ * quads and octets of digits with 3 multiplies instead of 8 dependent ones.
+ *
+ * @param string string to read from.
+ * @param pos index of the first digit.
+ * @param value set to the number that was read.
+ *
+ * @return true if all 8 characters are digits, false otherwise.
+ */
+inline bool eight_digits(std::string_view string, size_t pos, int64_t& value)
+{
+    if (pos + 8 > string.size())
+        return false;
+
+    uint64_t word;
+    std::memcpy(&word, string.data() + pos, sizeof(word));
+
+    // Each byte is a digit if its high nibble is 3 and adding 6 to it does not carry past 9.
+    if ((word & 0xF0F0F0F0F0F0F0F0) != 0x3030303030303030
+        || ((word + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) != 0x3030303030303030)
+        return false;
+
+    word -= 0x3030303030303030;
+    word = (word * 10 + (word >> 8)) & 0x00FF00FF00FF00FF;
+    word = (word * 100 + (word >> 16)) & 0x0000FFFF0000FFFF;
+    value = static_cast<int64_t>((word * 10000 + (word >> 32)) & 0xFFFFFFFF);
+    return true;
+}
+
+/**
+ * Reads the next run of digits in 'string' at or after 'pos', skipping anything that is not a
+ * digit before it. 'pos' is moved past the run.
+ *
+ * Runs longer than 'std::numeric_limits<int>::digits10' digits still advance 'pos', but only
+ * their leading digits are read so 'value' can not overflow.
+ *
+ * @param string string to read from.
+ * @param pos index to start searching from.
+ * @param value set to the number that was read.
+ * @param digits set to the number of digits in the run.
+ *
+ * @return true if a run of digits was found, false if the end of 'string' was reached first.
+ */
+constexpr bool next_number(std::string_view string, size_t& pos, int64_t& value, size_t& digits)
+{
+    while (pos < string.size() && !is_digit(string[pos]))
+        pos++;
+
+    if (pos == string.size())
+        return false;
+
+    value = 0;
+    digits = 0;
+    for (; pos < string.size() && is_digit(string[pos]); pos++, digits++)
+    {
+        if (digits < std::numeric_limits<int>::digits10)
+            value = value * 10 + (string[pos] - '0');
+    }
+    return true;
+}
+
+/**
+ * Counts the runs of digits in 'string'.
+ *
+ * @param string string to count the runs of digits in.
+ *
+ * @return number of runs of digits in 'string'.
+ */
+constexpr size_t count_numbers(std::string_view string)
+{
+    size_t count = 0;
+    for (size_t i = 0; i < string.size(); i++)
+    {
+        if (is_digit(string[i]) && (i == 0 || !is_digit(string[i - 1])))
+            count++;
+    }
+    return count;
+}
+
+/**
+ * Reads the next number in 'string' for a component being parsed.
+ *
+ * @param string string to read from.
+ * @param pos index to start searching from. Moved past the number that was read.
+ *
+ * @return the number that was read, or a 'ParseError' if 'string' has no more numbers or the
+ * number does not fit in an 'int'.
+ */
+constexpr std::expected<int64_t, ParseError> next_component(std::string_view string,
+                                                            size_t& pos)
+{
+    int64_t value = 0;
+    size_t digits = 0;
+
+    if (!next_number(string, pos, value, digits))
+        return std::unexpected(ParseError{ParseError::Code::MISSING_COMPONENT,
+                                          static_cast<uint32_t>(pos)});
+
+    if (digits > std::numeric_limits<int>::digits10)
+        return std::unexpected(ParseError{ParseError::Code::NUMBER_TOO_LONG,
+                                          static_cast<uint32_t>(pos - digits)});
+
+    return value;
+}
+
+/**
+ * Gets the value of a parse 'result', throwing if parsing failed.
+ *
+ * @param result result of parsing 'string'.
+ * @param string the string that was parsed.
+ *
+ * @return the parsed value.
+ *
+ * @throws std::out_of_range if 'string' has a number with too many digits.
+ * @throws std::invalid_argument if parsing failed for any other reason.
+ */
+template<typename T>
+T value_or_throw(std::expected<T, ParseError> result, std::string_view string)
+{
+    if (result.has_value())
+        return *result;
+
+    if (result.error().code == ParseError::Code::NUMBER_TOO_LONG)
+        throw std::out_of_range(result.error().message(string));
+
+    throw std::invalid_argument(result.error().message(string));
+}
+}
+
+#endif //DATETIME_PARSE_H
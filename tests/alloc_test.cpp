@@ -0,0 +1,350 @@
+#include "gtest/gtest.h"
+#include <datetime/datetime.h>
+#include <array>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+/**
+ * Tests that the operations the library does not allocate in really do not.
+ *
+ * The global 'operator new' and 'operator delete' are replaced with versions that count the
+ * calls of the thread they are made in, so this is a program of its own rather than part of
+ * 'exec'.
+ */
+namespace
+{
+/**
+ * Calls of 'operator new' and 'operator delete' made by this thread.
+ */
+thread_local size_t allocations = 0;
+thread_local size_t deallocations = 0;
+
+void* allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t))
+{
+    allocations++;
+    if (size == 0)
+        size = 1;
+    void* pointer = alignment <= alignof(std::max_align_t)
+                    ? std::malloc(size)
+                    : std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+    if (pointer == nullptr)
+        throw std::bad_alloc();
+    return pointer;
+}
+
+void deallocate(void* pointer) noexcept
+{
+    if (pointer == nullptr)
+        return;
+    deallocations++;
+    std::free(pointer);
+}
+
+/**
+ * Address of the last value passed to 'keep', so the compiler can not drop the calls that made
+ * it.
+ */
+const volatile void* volatile kept = nullptr;
+
+template<typename T>
+void keep(const T& value)
+{
+    kept = &value;
+}
+
+/**
+ * Counts the allocations and deallocations 'function' makes in this thread.
+ *
+ * @return the number of calls of 'operator new' plus 'operator delete'.
+ */
+template<typename Function>
+size_t count_allocations(Function&& function)
+{
+    size_t allocations_before = allocations;
+    size_t deallocations_before = deallocations;
+    function();
+    return (allocations - allocations_before) + (deallocations - deallocations_before);
+}
+
+/**
+ * Expects 'statement' to neither allocate nor free memory.
+ */
+#define EXPECT_NO_ALLOCATIONS(statement) \
+    EXPECT_EQ(count_allocations([&] { statement; }), 0u) << #statement
+
+const Datetime DATETIME = Datetime(2024, 2, 29, 23, 59, 59, 999, 999, 999, TZ::EST);
+}
+
+void* operator new(std::size_t size)
+{
+    return allocate(size);
+}
+
+void* operator new[](std::size_t size)
+{
+    return allocate(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    return allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    try
+    {
+        return allocate(size);
+    }
+    catch (const std::bad_alloc&)
+    {
+        return nullptr;
+    }
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    try
+    {
+        return allocate(size);
+    }
+    catch (const std::bad_alloc&)
+    {
+        return nullptr;
+    }
+}
+
+void operator delete(void* pointer) noexcept
+{
+    deallocate(pointer);
+}
+
+void operator delete[](void* pointer) noexcept
+{
+    deallocate(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept
+{
+    deallocate(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept
+{
+    deallocate(pointer);
+}
+
+void operator delete(void* pointer, std::align_val_t) noexcept
+{
+    deallocate(pointer);
+}
+
+void operator delete[](void* pointer, std::align_val_t) noexcept
+{
+    deallocate(pointer);
+}
+
+void operator delete(void* pointer, std::size_t, std::align_val_t) noexcept
+{
+    deallocate(pointer);
+}
+
+void operator delete[](void* pointer, std::size_t, std::align_val_t) noexcept
+{
+    deallocate(pointer);
+}
+
+TEST(Allocations, counts_allocations)
+{
+    // The harness itself must see the allocations it is meant to catch.
+    EXPECT_EQ(count_allocations([] { keep(std::string(100, 'x')); }), 2u);
+    EXPECT_GT(count_allocations([] { keep(DATETIME.to_string()); }), 0u);
+    EXPECT_GT(count_allocations([] {
+        keep(Datetime::range(DATETIME, DATETIME + Hours(1), Minutes(1)));
+    }), 0u);
+}
+
+TEST(Allocations, construction)
+{
+    EXPECT_NO_ALLOCATIONS(keep(Date(2024, 2, 29)));
+    EXPECT_NO_ALLOCATIONS(keep(Time(1, 2, 3, 4, 5, 6, TZ::CST)));
+    EXPECT_NO_ALLOCATIONS(keep(Datetime(2024, 2, 29, 1, 2, 3, 4, 5, 6, TZ::CST)));
+    EXPECT_NO_ALLOCATIONS(keep(Datetime(UNCHECKED, 2024, 2, 29, 1, 2, 3, 4, 5, 6, TZ::CST)));
+    EXPECT_NO_ALLOCATIONS(keep(Datetime(Date(2024, 2, 29), Time(1, 2, 3))));
+    EXPECT_NO_ALLOCATIONS(keep(TimeDelta(1, 2, 3, 4, 5, 6, 7)));
+    EXPECT_NO_ALLOCATIONS(keep(Timezone(Minutes(-330))));
+    EXPECT_NO_ALLOCATIONS(keep(Time::get_default_timezone()));
+    EXPECT_NO_ALLOCATIONS(ScopedDefaultTimezone scope = ScopedDefaultTimezone(TZ::UTC));
+}
+
+TEST(Allocations, arithmetic)
+{
+    Datetime datetime = DATETIME;
+    EXPECT_NO_ALLOCATIONS(datetime += Nanoseconds(1));
+    EXPECT_NO_ALLOCATIONS(datetime += Microseconds(1));
+    EXPECT_NO_ALLOCATIONS(datetime += Milliseconds(1));
+    EXPECT_NO_ALLOCATIONS(datetime += Seconds(1));
+    EXPECT_NO_ALLOCATIONS(datetime += Minutes(1));
+    EXPECT_NO_ALLOCATIONS(datetime += Hours(1));
+    EXPECT_NO_ALLOCATIONS(datetime += Days(1));
+    EXPECT_NO_ALLOCATIONS(datetime -= Days(400));
+    EXPECT_NO_ALLOCATIONS(datetime += TimeDelta(1, 2, 3, 4, 5, 6, 7));
+    EXPECT_NO_ALLOCATIONS(datetime += Time(1, 2, 3));
+    EXPECT_NO_ALLOCATIONS(keep(datetime - DATETIME));
+    EXPECT_NO_ALLOCATIONS(keep(DATETIME + Minutes(90)));
+    EXPECT_NO_ALLOCATIONS(++datetime);
+    EXPECT_NO_ALLOCATIONS(datetime.round(TimeComponent::SECOND));
+    EXPECT_NO_ALLOCATIONS(datetime.set_timezone(Timezone(Minutes(-345))));
+
+    Date date = DATETIME.date();
+    EXPECT_NO_ALLOCATIONS(date += Days(30));
+    EXPECT_NO_ALLOCATIONS(keep(date - DATETIME.date()));
+    EXPECT_NO_ALLOCATIONS(keep(date.day_of_week()));
+
+    Time time = DATETIME.time();
+    EXPECT_NO_ALLOCATIONS(time += Minutes(95));
+    EXPECT_NO_ALLOCATIONS(keep(time - DATETIME.time()));
+
+    Timestamp timestamp = Timestamp(DATETIME);
+    EXPECT_NO_ALLOCATIONS(keep(timestamp + Nanoseconds(1)));
+    EXPECT_NO_ALLOCATIONS(keep(timestamp - Timestamp(0)));
+}
+
+TEST(Allocations, comparison_and_hashing)
+{
+    Datetime other = DATETIME + Nanoseconds(1);
+    EXPECT_NO_ALLOCATIONS(keep(DATETIME < other));
+    EXPECT_NO_ALLOCATIONS(keep(DATETIME == other));
+    EXPECT_NO_ALLOCATIONS(keep(DATETIME.date() < other.date()));
+    EXPECT_NO_ALLOCATIONS(keep(DATETIME.time() < other.time()));
+    EXPECT_NO_ALLOCATIONS(keep(Timestamp(DATETIME) < Timestamp(other)));
+    EXPECT_NO_ALLOCATIONS(keep(TimeDelta(1) < TimeDelta(2)));
+    EXPECT_NO_ALLOCATIONS(keep(hash_value(DATETIME)));
+    EXPECT_NO_ALLOCATIONS(keep(hash_value(DATETIME.date())));
+    EXPECT_NO_ALLOCATIONS(keep(hash_value(DATETIME.time())));
+    EXPECT_NO_ALLOCATIONS(keep(hash_value(Timestamp(DATETIME))));
+}
+
+TEST(Allocations, conversion)
+{
+    EXPECT_NO_ALLOCATIONS(keep(Datetime::from_ms(1'709'251'199'999, TZ::EST)));
+    EXPECT_NO_ALLOCATIONS(keep(Datetime::from_ns(1'709'251'199'999'999'999, TZ::UTC)));
+    EXPECT_NO_ALLOCATIONS(keep(DATETIME.to_ms()));
+    EXPECT_NO_ALLOCATIONS(keep(DATETIME.to_ns(TZ::PST)));
+    EXPECT_NO_ALLOCATIONS(keep(Timestamp(DATETIME)));
+    EXPECT_NO_ALLOCATIONS(keep(Timestamp(DATETIME).datetime(TZ::UTC)));
+    EXPECT_NO_ALLOCATIONS(keep(Timestamp(DATETIME.date(), TZ::UTC)));
+    EXPECT_NO_ALLOCATIONS(keep(DATETIME.date().to_day_number()));
+    EXPECT_NO_ALLOCATIONS(keep(Date::from_day_number(19'782)));
+}
+
+TEST(Allocations, views)
+{
+    EXPECT_NO_ALLOCATIONS(for (Datetime datetime : Datetime::iota(DATETIME, DATETIME + Hours(1),
+                                                                  Minutes(1))) keep(datetime));
+    EXPECT_NO_ALLOCATIONS(keep(Date::iota(Date(2024, 1, 1), Date(2025, 1, 1))[100]));
+    EXPECT_NO_ALLOCATIONS(keep(Time::iota(Time(9, 30), Time(16, 0), Seconds(1)).size()));
+}
+
+TEST(Allocations, formatting_to_buffer)
+{
+    std::array<char, 128> buffer;
+    char* first = buffer.data();
+    char* last = buffer.data() + buffer.size();
+    EXPECT_NO_ALLOCATIONS(keep(DATETIME.to_chars(first, last)));
+    EXPECT_NO_ALLOCATIONS(keep(DATETIME.date().to_chars(first, last)));
+    EXPECT_NO_ALLOCATIONS(keep(DATETIME.time().to_chars(first, last)));
+    EXPECT_NO_ALLOCATIONS(keep(TimeDelta(1, 2, 3, 4, 5, 6, 7).to_chars(first, last)));
+    EXPECT_NO_ALLOCATIONS(keep(Timezone(Minutes(-330)).to_chars(first, last)));
+    EXPECT_NO_ALLOCATIONS(keep(fmt::format_to_n(first, buffer.size(), "{}", DATETIME)));
+    EXPECT_NO_ALLOCATIONS(keep(fmt::format_to_n(first, buffer.size(),
+                                                "{:%Y-%m-%dT%H:%M:%S.%9f%z}", DATETIME)));
+
+    // Too small a buffer is reported, not grown.
+    EXPECT_NO_ALLOCATIONS(keep(DATETIME.to_chars(first, first + 4)));
+}
+
+TEST(Allocations, parsing)
+{
+    EXPECT_NO_ALLOCATIONS(keep(Datetime("2024-02-29T23:59:59.999999999-05:00")));
+    EXPECT_NO_ALLOCATIONS(keep(Datetime::try_parse("2024-02-29T23:59:59.999999999+05:30")));
+    EXPECT_NO_ALLOCATIONS(keep(Date("2024-02-29")));
+    EXPECT_NO_ALLOCATIONS(keep(Date::try_parse("2024/02/29")));
+    EXPECT_NO_ALLOCATIONS(keep(Time("1:02:03.4.5.6+5:30", TimeComponent::HOUR,
+                                    TimeComponent::MINUTE, TimeComponent::SECOND,
+                                    TimeComponent::MILLISECOND, TimeComponent::MICROSECOND,
+                                    TimeComponent::NANOSECOND, TimeComponent::TIMEZONE)));
+    EXPECT_NO_ALLOCATIONS(keep(Datetime::try_parse("2024-02-29 1:02", DateComponent::YEAR,
+                                                   DateComponent::MONTH, DateComponent::DAY,
+                                                   TimeComponent::HOUR,
+                                                   TimeComponent::MINUTE)));
+
+    // Failures are reported without allocating too, unless they throw.
+    EXPECT_NO_ALLOCATIONS(keep(Datetime::try_parse("2024-02-30T00:00:00Z")));
+    EXPECT_NO_ALLOCATIONS(keep(Datetime::try_parse("not a datetime")));
+
+    FixedFormat format = FixedFormat("%Y-%m-%d %H:%M:%S.%6f", TZ::UTC);
+    std::array<std::string_view, 2> rows = {"2024-02-29 23:59:59.999999",
+                                            "2024-02-30 00:00:00.000000"};
+    std::array<Timestamp, 2> timestamps;
+    EXPECT_NO_ALLOCATIONS(keep(parse_fixed(std::span(rows).first(1), format,
+                                           std::span(timestamps).first(1))));
+    EXPECT_NO_ALLOCATIONS(keep(parse_fixed(rows, format, timestamps)));
+}
+
+TEST(Allocations, clocks)
+{
+    // The first reads work out what is cached.
+    keep(Datetime::now(0, 0, 0, 0, 0, 0, 0, TZ::UTC));
+    keep(TZ::local());
+
+    EXPECT_NO_ALLOCATIONS(keep(Clock::now()));
+    EXPECT_NO_ALLOCATIONS(keep(Datetime::now(0, 0, 0, 0, 0, 0, 0, TZ::UTC)));
+    EXPECT_NO_ALLOCATIONS(keep(Time::now(0, 0, 0, 0, 0, 0, TZ::UTC)));
+    EXPECT_NO_ALLOCATIONS(keep(Date::today(0, TZ::UTC)));
+    EXPECT_NO_ALLOCATIONS(keep(Timestamp::now()));
+    EXPECT_NO_ALLOCATIONS(keep(TZ::local()));
+
+    CoarseClock clock = CoarseClock(Milliseconds(1), TZ::UTC);
+    std::array<char, Datetime::MAX_CHARS> buffer;
+    EXPECT_NO_ALLOCATIONS(keep(clock.now_nanoseconds()));
+    EXPECT_NO_ALLOCATIONS(keep(clock.now()));
+    EXPECT_NO_ALLOCATIONS(keep(clock.to_chars(buffer.data(), buffer.data() + buffer.size())));
+}
+
+TEST(Allocations, zone_lookups)
+{
+    ZoneConverter fixed = ZoneConverter(TZ::EST, Timezone(Minutes(-330)));
+    Timestamp local = Timestamp(DATETIME);
+    std::array<Timestamp, 4> in = {local, local + Hours(1), local + Days(200), local};
+    std::array<Timestamp, 4> out;
+    EXPECT_NO_ALLOCATIONS(keep(fixed.convert(local)));
+    EXPECT_NO_ALLOCATIONS(fixed.convert(in, out));
+
+    const char* tzdir = std::getenv("TZDIR");
+    TimeZoneDB& db = TimeZoneDB::system();
+    const ZoneInfo* new_york = nullptr;
+    try
+    {
+        new_york = &db.get("America/New_York");
+    }
+    catch (const std::invalid_argument&)
+    {
+        GTEST_SKIP() << "No zoneinfo in " << (tzdir != nullptr ? tzdir : "/usr/share/zoneinfo");
+    }
+
+    EXPECT_NO_ALLOCATIONS(keep(&db.get("America/New_York")));
+    EXPECT_NO_ALLOCATIONS(keep(new_york->offset_at(1'700'000'000)));
+    EXPECT_NO_ALLOCATIONS(keep(new_york->local_to_utc(1'700'000'000)));
+    EXPECT_NO_ALLOCATIONS(keep(new_york->to_local(DATETIME)));
+
+    ZoneConverter converter = ZoneConverter(*new_york, db.get("Europe/London"));
+    EXPECT_NO_ALLOCATIONS(converter.convert(in, out));
+}
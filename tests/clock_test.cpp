@@ -0,0 +1,155 @@
+#include "gtest/gtest.h"
+#include <datetime/datetime.h>
+#include <thread>
+
+namespace
+{
+/**
+ * Time returned by 'fixed_source'.
+ */
+int64_t fixed_nanoseconds = 0;
+
+int64_t fixed_source()
+{
+    return fixed_nanoseconds;
+}
+
+/**
+ * Plugs 'fixed_source' into 'Clock' for the length of a test.
+ */
+class FixedClock : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        previous = Clock::get_source();
+        Clock::set_source(fixed_source);
+    }
+
+    void TearDown() override
+    {
+        Clock::set_source(previous);
+    }
+
+    Clock::Source previous = nullptr;
+};
+}
+
+TEST(Clock, system_is_default_source)
+{
+    EXPECT_EQ(Clock::get_source(), &Clock::system);
+}
+
+TEST(Clock, system_matches_std_chrono)
+{
+    auto since_epoch = std::chrono::system_clock::now().time_since_epoch();
+    int64_t expected = std::chrono::duration_cast<std::chrono::nanoseconds>(since_epoch).count();
+    EXPECT_NEAR(static_cast<double>(Clock::system()), static_cast<double>(expected), 1e8);
+}
+
+TEST(Clock, tsc_matches_system)
+{
+    if (!Clock::tsc_available())
+        GTEST_SKIP() << "no invariant TSC";
+
+    EXPECT_NEAR(static_cast<double>(Clock::tsc()), static_cast<double>(Clock::system()), 1e6);
+
+    int64_t first = Clock::tsc();
+    int64_t second = Clock::tsc();
+    EXPECT_LE(first, second);
+}
+
+TEST_F(FixedClock, datetime_now_reads_source)
+{
+    fixed_nanoseconds = Timestamp(Datetime(2023, 3, 4, 5, 6, 7, 8, 9, 10, TZ::UTC))
+        .epoch_nanoseconds;
+
+    Datetime utc = Datetime::now(0, 0, 0, 0, 0, 0, 0, TZ::UTC);
+    EXPECT_EQ(utc, Datetime(2023, 3, 4, 5, 6, 7, 8, 9, 10, TZ::UTC));
+    EXPECT_EQ(utc.hour, 5);
+
+    Datetime est = Datetime::now(0, 0, 0, 0, 0, 0, 0, TZ::EST);
+    EXPECT_EQ(est.timezone, TZ::EST);
+    EXPECT_EQ(est.hour, 0);
+    EXPECT_EQ(est.day, 4);
+    EXPECT_EQ(est, utc);
+}
+
+TEST_F(FixedClock, date_and_time_agree_at_midnight)
+{
+    // One nanosecond before midnight in EST.
+    fixed_nanoseconds = Timestamp(Datetime(2023, 1, 2, 4, 59, 59, 999, 999, 999, TZ::UTC))
+        .epoch_nanoseconds;
+
+    EXPECT_EQ(Datetime::now(0, 0, 0, 0, 0, 0, 0, TZ::EST),
+              Datetime(2023, 1, 1, 23, 59, 59, 999, 999, 999, TZ::EST));
+    EXPECT_EQ(Date::today(0, TZ::EST), Date(2023, 1, 1));
+    EXPECT_EQ(Date::today(0, TZ::UTC), Date(2023, 1, 2));
+    EXPECT_EQ(Time::now(0, 0, 0, 0, 0, 0, TZ::EST),
+              Time(23, 59, 59, 999, 999, 999, TZ::EST));
+}
+
+TEST_F(FixedClock, offsets_carry)
+{
+    fixed_nanoseconds = Timestamp(Datetime(2023, 1, 31, 23, 30, 0, 0, 0, 0, TZ::UTC))
+        .epoch_nanoseconds;
+
+    EXPECT_EQ(Datetime::now(1, 1, 0, 0, 0, 0, 0, TZ::UTC),
+              Datetime(2023, 2, 2, 0, 30, 0, 0, 0, 0, TZ::UTC));
+    EXPECT_EQ(Time::now(1, 0, 0, 0, 0, 0, TZ::UTC), Time(0, 30, 0, 0, 0, 0, TZ::UTC));
+    EXPECT_EQ(Date::today(-31, TZ::UTC), Date(2022, 12, 31));
+    EXPECT_EQ(Date::tomorrow(TZ::UTC), Date(2023, 2, 1));
+}
+
+TEST_F(FixedClock, timestamp_now_reads_source)
+{
+    fixed_nanoseconds = 1'672'531'200'123'456'789;
+    EXPECT_EQ(Timestamp::now().epoch_nanoseconds, 1'672'531'200'123'456'789);
+}
+
+TEST_F(FixedClock, cached_day_changes_at_midnight)
+{
+    Datetime before_midnight = Datetime(2023, 12, 31, 23, 59, 59, 999, 999, 999, TZ::UTC);
+    fixed_nanoseconds = Timestamp(before_midnight).epoch_nanoseconds;
+    EXPECT_EQ(Datetime::now(0, 0, 0, 0, 0, 0, 0, TZ::UTC), before_midnight);
+
+    fixed_nanoseconds++;
+    EXPECT_EQ(Datetime::now(0, 0, 0, 0, 0, 0, 0, TZ::UTC),
+              Datetime(2024, 1, 1, 0, 0, 0, 0, 0, 0, TZ::UTC));
+    EXPECT_EQ(Date::today(0, TZ::UTC), Date(2024, 1, 1));
+
+    // A clock that steps backwards, such as on an NTP correction, leaves the cached day too.
+    fixed_nanoseconds--;
+    EXPECT_EQ(Datetime::now(0, 0, 0, 0, 0, 0, 0, TZ::UTC), before_midnight);
+    EXPECT_EQ(Date::today(0, TZ::UTC), Date(2023, 12, 31));
+}
+
+TEST_F(FixedClock, cached_day_is_per_timezone)
+{
+    // 2024-03-01 02:00 UTC is still 2024-02-29 in EST.
+    fixed_nanoseconds = Timestamp(Datetime(2024, 3, 1, 2, 0, 0, 0, 0, 0, TZ::UTC))
+        .epoch_nanoseconds;
+
+    for (int i = 0; i < 3; i++)
+    {
+        EXPECT_EQ(Date::today(0, TZ::UTC), Date(2024, 3, 1));
+        EXPECT_EQ(Date::today(0, TZ::EST), Date(2024, 2, 29));
+        EXPECT_EQ(Datetime::now(0, 0, 0, 0, 0, 0, 0, TZ::EST),
+                  Datetime(2024, 2, 29, 21, 0, 0, 0, 0, 0, TZ::EST));
+        EXPECT_EQ(Datetime::now(1, 0, 0, 0, 0, 0, 0, TZ::EST),
+                  Datetime(2024, 3, 1, 21, 0, 0, 0, 0, 0, TZ::EST));
+    }
+}
+
+TEST_F(FixedClock, cached_day_is_per_thread)
+{
+    fixed_nanoseconds = Timestamp(Datetime(2023, 6, 1, 12, 0, 0, 0, 0, 0, TZ::UTC))
+        .epoch_nanoseconds;
+    EXPECT_EQ(Date::today(0, TZ::UTC), Date(2023, 6, 1));
+
+    fixed_nanoseconds += 2 * Timestamp::NANOSECONDS_PER_DAY;
+    Date other_thread_today;
+    std::thread([&other_thread_today] { other_thread_today = Date::today(0, TZ::UTC); }).join();
+    EXPECT_EQ(other_thread_today, Date(2023, 6, 3));
+    EXPECT_EQ(Date::today(0, TZ::UTC), Date(2023, 6, 3));
+}
@@ -0,0 +1,123 @@
+#include "gtest/gtest.h"
+#include <datetime/datetime.h>
+#include <thread>
+#include <vector>
+
+namespace
+{
+const Datetime FIRST = Datetime(2023, 1, 1, 0, 0, 0, 0, 0, 0, TZ::UTC);
+const Datetime SECOND = Datetime(2044, 12, 31, 23, 59, 59, 999, 999, 999, TZ::UTC);
+
+/**
+ * Number of times 'alternating_source' has been read.
+ */
+std::atomic<int64_t> reads = 0;
+
+/**
+ * Alternates between 'FIRST' and 'SECOND', whose strings differ in every component, so a torn
+ * read would match neither.
+ */
+int64_t alternating_source()
+{
+    return Timestamp(reads.fetch_add(1) % 2 == 0 ? FIRST : SECOND).epoch_nanoseconds;
+}
+
+/**
+ * Plugs 'alternating_source' into 'Clock' for the length of a test.
+ */
+class AlternatingClock : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        previous = Clock::get_source();
+        reads = 0;
+        Clock::set_source(alternating_source);
+    }
+
+    void TearDown() override
+    {
+        Clock::set_source(previous);
+    }
+
+    Clock::Source previous = nullptr;
+};
+}
+
+TEST(CoarseClock, publishes_before_constructor_returns)
+{
+    int64_t before = Clock::now();
+    CoarseClock clock = CoarseClock(Milliseconds(100), TZ::UTC);
+    int64_t after = Clock::now();
+
+    EXPECT_GE(clock.now_nanoseconds(), before);
+    EXPECT_LE(clock.now_nanoseconds(), after);
+    EXPECT_EQ(Timestamp(clock.now()).epoch_nanoseconds, clock.now_nanoseconds());
+    EXPECT_EQ(clock.to_string(), clock.now().to_string());
+}
+
+TEST(CoarseClock, refreshes)
+{
+    CoarseClock clock = CoarseClock(Microseconds(100), TZ::UTC);
+    int64_t first = clock.now_nanoseconds();
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (clock.now_nanoseconds() == first && std::chrono::steady_clock::now() < deadline)
+        std::this_thread::yield();
+    EXPECT_GT(clock.now_nanoseconds(), first);
+}
+
+TEST(CoarseClock, publishes_in_timezone)
+{
+    CoarseClock clock = CoarseClock(Milliseconds(100), TZ::EST);
+    EXPECT_EQ(clock.get_timezone(), TZ::EST);
+    EXPECT_EQ(clock.now().timezone, TZ::EST);
+    EXPECT_TRUE(clock.to_string().ends_with(TZ::EST.to_string()));
+}
+
+TEST(CoarseClock, to_chars_checks_buffer_size)
+{
+    CoarseClock clock = CoarseClock(Milliseconds(100), TZ::UTC);
+    std::string expected = clock.to_string();
+
+    char buffer[Datetime::MAX_CHARS];
+    std::to_chars_result result = clock.to_chars(buffer, buffer + Datetime::MAX_CHARS);
+    EXPECT_EQ(result.ec, std::errc());
+    EXPECT_EQ(std::string(buffer, result.ptr), expected);
+
+    result = clock.to_chars(buffer, buffer + 5);
+    EXPECT_EQ(result.ec, std::errc::value_too_large);
+}
+
+TEST(CoarseClock, throws_invalid_argument_on_non_positive_interval)
+{
+    EXPECT_THROW(CoarseClock(Milliseconds(0)), std::invalid_argument);
+    EXPECT_THROW(CoarseClock(Microseconds(-1)), std::invalid_argument);
+}
+
+TEST_F(AlternatingClock, readers_never_see_torn_values)
+{
+    CoarseClock clock = CoarseClock(Microseconds(1), TZ::UTC);
+    std::string first = FIRST.to_string();
+    std::string second = SECOND.to_string();
+
+    std::vector<std::thread> readers;
+    std::atomic<int> failures = 0;
+    for (int i = 0; i < 4; i++)
+        readers.emplace_back([&]
+        {
+            for (int read = 0; read < 20'000; read++)
+            {
+                std::string string = clock.to_string();
+                Datetime datetime = clock.now();
+                if (string != first && string != second
+                    || datetime != FIRST && datetime != SECOND)
+                    failures++;
+            }
+        });
+    for (std::thread& reader : readers)
+        reader.join();
+
+    EXPECT_EQ(failures, 0);
+    EXPECT_GT(reads, 1);
+}
@@ -1,5 +1,6 @@
 #include "gtest/gtest.h"
 #include <datetime/datetime.h>
+#include <algorithm>
 
 TEST(Date, ostream)
 {
@@ -112,6 +113,46 @@ TEST(Date, operator_minusqual_subtracts_year)
         EXPECT_EQ(date.day, 1);
 }
 
+TEST(Date, operator_plusequal_adds_many_days)
+{
+        Date date = Date(1970, 1, 1);
+        date += Days(47481);
+        EXPECT_EQ(date, Date(2099, 12, 31));
+        date -= Days(47481);
+        EXPECT_EQ(date, Date(1970, 1, 1));
+}
+
+TEST(Date, to_day_number)
+{
+        EXPECT_EQ(Date(1970, 1, 1).to_day_number(), 0);
+        EXPECT_EQ(Date(1970, 1, 11).to_day_number(), 10);
+        EXPECT_EQ(Date(2000, 3, 1).to_day_number(), 11017);
+        EXPECT_EQ(Date(2100, 12, 31).to_day_number(), 47846);
+}
+
+TEST(Date, from_day_number)
+{
+        EXPECT_EQ(Date::from_day_number(0), Date(1970, 1, 1));
+        EXPECT_EQ(Date::from_day_number(11016), Date(2000, 2, 29));
+        EXPECT_EQ(Date::from_day_number(47846), Date(2100, 12, 31));
+}
+
+TEST(Date, from_day_number_throws_invalid_argument)
+{
+        EXPECT_THROW(Date::from_day_number(-1), std::invalid_argument);
+        EXPECT_THROW(Date::from_day_number(47847), std::invalid_argument);
+}
+
+TEST(Date, day_number_round_trip_every_day)
+{
+        int64_t day_number = 0;
+        for (Date date = Date(1970, 1, 1); date < Date(2100, 12, 31); ++date, ++day_number)
+        {
+                ASSERT_EQ(date.to_day_number(), day_number);
+                ASSERT_EQ(Date::from_day_number(day_number), date);
+        }
+}
+
 TEST(Date, operator_increment)
 {
         Date date = Date(1970, 1, 1);
@@ -362,6 +403,25 @@ TEST(Date, constructor_string_DateComponents_throws_invalid_argument_on_out_of_r
                  std::invalid_argument);
 }
 
+TEST(Date, constructor_string_DateComponents_throws_out_of_range_on_long_number)
+{
+    EXPECT_THROW(Date("20000000000-01-01", DateComponent::YEAR, DateComponent::MONTH,
+                      DateComponent::DAY), std::out_of_range);
+}
+
+TEST(Date, try_parse)
+{
+    EXPECT_EQ(Date::try_parse("2000-01-02").value(), Date(2000, 1, 2));
+    EXPECT_EQ(Date::try_parse("1/2", DateComponent::MONTH, DateComponent::DAY).value(),
+              Date(1970, 1, 2));
+    EXPECT_EQ(Date::try_parse("2000-01").error(),
+              (ParseError{ParseError::Code::MISSING_COMPONENT, 7}));
+    EXPECT_EQ(Date::try_parse("1800-01-01").error(),
+              (ParseError{ParseError::Code::INVALID_DATE, 0}));
+    EXPECT_EQ(Date::try_parse("2000-0000000000001-01").error(),
+              (ParseError{ParseError::Code::NUMBER_TOO_LONG, 5}));
+}
+
 TEST(Date, constructor_string_basic)
 {
     Date date = Date("2000-01-20");
@@ -422,9 +482,80 @@ TEST(Date, range_start_greater_than_end)
     EXPECT_EQ(actual, expected);
 }
 
+static_assert(std::ranges::random_access_range<IotaView<Date, Days>>);
+static_assert(std::ranges::sized_range<IotaView<Date, Days>>);
+static_assert(std::ranges::view<IotaView<Date, Days>>);
+
+TEST(Date, iota)
+{
+    IotaView<Date, Days> actual = Date::iota(Date(2022, 12, 30), Date(2023, 1, 1));
+    std::vector<Date> expected = {Date(2022, 12, 30), Date(2022, 12, 31), Date(2023, 1, 1)};
+    EXPECT_EQ(actual.size(), 3);
+    EXPECT_TRUE(std::ranges::equal(actual, expected));
+}
+
+TEST(Date, iota_increment_by_2)
+{
+    IotaView<Date, Days> actual = Date::iota(Date(2022, 12, 30), Date(2023, 1, 2), Days(2));
+    std::vector<Date> expected = {Date(2022, 12, 30), Date(2023, 1, 1)};
+    EXPECT_TRUE(std::ranges::equal(actual, expected));
+}
+
+TEST(Date, iota_start_greater_than_end)
+{
+    EXPECT_TRUE(Date::iota(Date(2023, 1, 1), Date(2022, 12, 30)).empty());
+}
+
+TEST(Date, iota_random_access)
+{
+    IotaView<Date, Days> view = Date::iota(Date(2000, 1, 1), Date(2099, 12, 31));
+    EXPECT_EQ(view.size(), 36525);
+    EXPECT_EQ(view[59], Date(2000, 2, 29));
+    EXPECT_EQ(view.back(), Date(2099, 12, 31));
+    EXPECT_EQ(*(view.end() - 365), Date(2099, 1, 1));
+    EXPECT_EQ(std::ranges::lower_bound(view, Date(2050, 6, 15)) - view.begin(),
+              Date(2050, 6, 15).to_day_number() - Date(2000, 1, 1).to_day_number());
+}
+
+TEST(Date, iota_throws_invalid_argument_on_non_positive_step)
+{
+    EXPECT_THROW(Date::iota(Date(2000, 1, 1), Date(2000, 1, 2), Days(0)), std::invalid_argument);
+    EXPECT_THROW(Date::iota(Date(2000, 1, 1), Date(2000, 1, 2), Days(-1)), std::invalid_argument);
+}
+
+TEST(Date, iota_constexpr)
+{
+    constexpr IotaView<Date, Days> view = Date::iota(Date(2000, 2, 27), Date(2000, 3, 1));
+    static_assert(view.size() == 4);
+    static_assert(view[2] == Date(2000, 2, 29));
+}
+
+TEST(Date, to_chars)
+{
+    char buffer[Date::MAX_CHARS];
+    std::to_chars_result result = Date(2000, 1, 30).to_chars(buffer, buffer + Date::MAX_CHARS,
+                                                             '/');
+    EXPECT_EQ(result.ec, std::errc());
+    EXPECT_EQ(std::string_view(buffer, result.ptr), "2000/01/30");
+
+    result = Date(2000, 1, 30).to_chars(buffer, buffer + 9);
+    EXPECT_EQ(result.ec, std::errc::value_too_large);
+}
+
 TEST(Date, to_string_delimeter)
 {
     Date date = Date(2020, 1, 2);
     std::string date_str = date.to_string('/');
     EXPECT_EQ(date_str, "2020/01/02");
-}
\ No newline at end of file
+}
+TEST(Date, constexpr_evaluation)
+{
+    static_assert(Date::EPOCH == Date(1970, 1, 1));
+    static_assert(Date::is_leap_year(2000));
+    static_assert(Date::max_days_in_month(2, 2024) == 29);
+    static_assert(Date(2000, 2, 28) + Days(2) == Date(2000, 3, 1));
+    static_assert(Date(2024, 1, 2).day_of_week() == Date::TUESDAY);
+    static_assert(Date::from_day_number(Date(2050, 6, 7).to_day_number()) == Date(2050, 6, 7));
+    constexpr Date date = Date(2024, 1, 2);
+    EXPECT_EQ(date.day, 2);
+}
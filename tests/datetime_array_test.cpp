@@ -0,0 +1,220 @@
+#include "gtest/gtest.h"
+#include <datetime/datetime.h>
+#include <array>
+#include <vector>
+
+namespace
+{
+/**
+ * Timezones the local time operations are checked in, including ones off the hour.
+ */
+const std::array<Timezone, 5> TIMEZONES = {TZ::UTC, TZ::EST, Timezone(-9),
+                                           Timezone(Minutes(-330)), Timezone(Minutes(30))};
+
+/**
+ * Creates nanoseconds since the unix epoch from 1970-01-02 to 2100, an odd number of them so the
+ * AVX2 kernels also finish with a scalar tail.
+ */
+std::vector<int64_t> make_epoch_nanoseconds()
+{
+    constexpr int64_t FIRST = Timestamp::NANOSECONDS_PER_DAY;
+    constexpr uint64_t SPAN = 4'102'444'800 * Timestamp::NANOSECONDS_PER_SECOND;
+
+    std::vector<int64_t> nanoseconds = {FIRST, FIRST + 1, 2 * FIRST - 1};
+    uint64_t state = 88172645463325252ull;
+    for (int i = 0; i < 1'001; i++)
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        nanoseconds.push_back(FIRST + static_cast<int64_t>(state % SPAN));
+    }
+    return nanoseconds;
+}
+}
+
+TEST(DatetimeArray, constructor_datetimes_keeps_points_in_time)
+{
+    std::vector<Datetime> datetimes = {Datetime(2000, 1, 2, 3, 4, 5, 6, 7, 8, TZ::UTC),
+                                       Datetime(2000, 1, 1, 22, 4, 5, 6, 7, 8, TZ::EST)};
+    DatetimeArray array = DatetimeArray(datetimes, TZ::CST);
+
+    ASSERT_EQ(array.size(), 2);
+    EXPECT_EQ(array.get_epoch_nanoseconds()[0], 946782245006007008);
+    EXPECT_EQ(array.get_epoch_nanoseconds()[1], 946782245006007008);
+    EXPECT_EQ(array.get_timezone(), TZ::CST);
+}
+
+TEST(DatetimeArray, to_datetimes_converts_to_timezone)
+{
+    DatetimeArray array = DatetimeArray(std::vector<int64_t>{946782245006007008}, TZ::EST);
+
+    std::vector<Datetime> datetimes = array.to_datetimes();
+    ASSERT_EQ(datetimes.size(), 1);
+    EXPECT_EQ(datetimes[0], Datetime(2000, 1, 1, 22, 4, 5, 6, 7, 8, TZ::EST));
+    EXPECT_EQ(datetimes[0].timezone, TZ::EST);
+    EXPECT_EQ(array[0], datetimes[0]);
+}
+
+TEST(DatetimeArray, round_trip)
+{
+    std::vector<Datetime> datetimes;
+    for (int64_t nanoseconds : make_epoch_nanoseconds())
+        datetimes.push_back(Timestamp(nanoseconds).datetime(TZ::PST));
+
+    EXPECT_EQ(DatetimeArray(datetimes, TZ::PST).to_datetimes(), datetimes);
+}
+
+TEST(DatetimeArray, push_back)
+{
+    DatetimeArray array = DatetimeArray(TZ::UTC);
+    EXPECT_TRUE(array.empty());
+
+    array.push_back(Datetime(1970, 1, 1, 0, 0, 0, 0, 0, 1, TZ::UTC));
+    array.push_back(Timestamp(2));
+
+    EXPECT_EQ(array, DatetimeArray(std::vector<int64_t>{1, 2}, TZ::UTC));
+}
+
+TEST(DatetimeArray, set_timezone_keeps_points_in_time)
+{
+    DatetimeArray array = DatetimeArray(std::vector<int64_t>{946782245006007008}, TZ::UTC);
+    array.set_timezone(TZ::EST);
+
+    EXPECT_EQ(array.get_epoch_nanoseconds()[0], 946782245006007008);
+    EXPECT_EQ(array[0].hour, 22);
+    EXPECT_EQ(array[0].timezone, TZ::EST);
+}
+
+TEST(DatetimeArray, add_and_subtract_time_delta)
+{
+    std::vector<int64_t> nanoseconds = make_epoch_nanoseconds();
+    DatetimeArray array = DatetimeArray(nanoseconds, TZ::UTC);
+    TimeDelta time_delta = TimeDelta(1, 2, 3, 4, 5, 6, 7);
+
+    array += time_delta;
+    for (size_t i = 0; i < nanoseconds.size(); i++)
+        ASSERT_EQ(array.get_epoch_nanoseconds()[i],
+                  nanoseconds[i] + time_delta.total_nanoseconds());
+
+    array -= time_delta;
+    EXPECT_EQ(array, DatetimeArray(nanoseconds, TZ::UTC));
+}
+
+TEST(DatetimeArray, floor_matches_datetime_floor)
+{
+    for (Timezone timezone : TIMEZONES)
+    {
+        for (TimeComponent component : {TimeComponent::HOUR, TimeComponent::MINUTE,
+                                        TimeComponent::SECOND, TimeComponent::MILLISECOND,
+                                        TimeComponent::MICROSECOND, TimeComponent::NANOSECOND})
+        {
+            std::vector<int64_t> nanoseconds = make_epoch_nanoseconds();
+            DatetimeArray array = DatetimeArray(nanoseconds, timezone);
+            array.floor(component);
+
+            for (size_t i = 0; i < nanoseconds.size(); i++)
+            {
+                Datetime expected = Timestamp(nanoseconds[i]).datetime(timezone);
+                expected.floor(component);
+                ASSERT_EQ(array[i], expected) << timezone << " " << nanoseconds[i];
+            }
+        }
+    }
+}
+
+TEST(DatetimeArray, floor_before_epoch)
+{
+    std::vector<int64_t> nanoseconds = {-1, -1, -1, -1, -Timestamp::NANOSECONDS_PER_MICROSECOND};
+    DatetimeArray array = DatetimeArray(nanoseconds, TZ::UTC);
+
+    array.floor(TimeComponent::MICROSECOND);
+    EXPECT_EQ(array.get_epoch_nanoseconds()[0], -Timestamp::NANOSECONDS_PER_MICROSECOND);
+    EXPECT_EQ(array.get_epoch_nanoseconds()[4], -Timestamp::NANOSECONDS_PER_MICROSECOND);
+
+    array.floor(TimeComponent::HOUR);
+    EXPECT_EQ(array.get_epoch_nanoseconds()[0], -Timestamp::NANOSECONDS_PER_HOUR);
+    EXPECT_EQ(array.get_epoch_nanoseconds()[4], -Timestamp::NANOSECONDS_PER_HOUR);
+}
+
+TEST(DatetimeArray, floor_far_from_epoch)
+{
+    std::vector<int64_t> nanoseconds = {4'000'000'000'000'123'456, -4'000'000'000'000'123'456,
+                                        INT64_MAX / 2, INT64_MIN / 2, 9'000'000'000'000'000'001};
+    for (TimeComponent component : {TimeComponent::HOUR, TimeComponent::MICROSECOND})
+    {
+        DatetimeArray array = DatetimeArray(nanoseconds, TZ::UTC);
+        array.floor(component);
+
+        int64_t unit = component == TimeComponent::HOUR ? Timestamp::NANOSECONDS_PER_HOUR
+                                                        : Timestamp::NANOSECONDS_PER_MICROSECOND;
+        for (size_t i = 0; i < nanoseconds.size(); i++)
+            EXPECT_EQ(array.get_epoch_nanoseconds()[i],
+                      nanoseconds[i] - (nanoseconds[i] % unit + unit) % unit);
+    }
+}
+
+TEST(DatetimeArray, day_of_week_matches_date)
+{
+    std::vector<int64_t> nanoseconds = make_epoch_nanoseconds();
+    for (Timezone timezone : TIMEZONES)
+    {
+        std::vector<uint8_t> days = DatetimeArray(nanoseconds, timezone).day_of_week();
+
+        ASSERT_EQ(days.size(), nanoseconds.size());
+        for (size_t i = 0; i < nanoseconds.size(); i++)
+            ASSERT_EQ(days[i], Timestamp(nanoseconds[i]).date(timezone).day_of_week())
+                << timezone << " " << nanoseconds[i];
+    }
+}
+
+TEST(DatetimeArray, day_of_week_in_timezone)
+{
+    // Thursday in UTC, still Wednesday in New York.
+    DatetimeArray array = DatetimeArray(std::vector<int64_t>{0}, TZ::UTC);
+    EXPECT_EQ(array.day_of_week(), std::vector<uint8_t>{Date::THURSDAY});
+
+    array.set_timezone(TZ::EST);
+    EXPECT_EQ(array.day_of_week(), std::vector<uint8_t>{Date::WEDNESDAY});
+}
+
+TEST(DatetimeArray, comparison_masks)
+{
+    Datetime datetime = Datetime(1970, 1, 1, 0, 0, 0, 0, 0, 2, TZ::UTC);
+    DatetimeArray array = DatetimeArray(std::vector<int64_t>{1, 2, 3}, TZ::EST);
+
+    EXPECT_EQ(array.less(datetime), (std::vector<uint8_t>{1, 0, 0}));
+    EXPECT_EQ(array.less_equal(datetime), (std::vector<uint8_t>{1, 1, 0}));
+    EXPECT_EQ(array.greater(datetime), (std::vector<uint8_t>{0, 0, 1}));
+    EXPECT_EQ(array.greater_equal(datetime), (std::vector<uint8_t>{0, 1, 1}));
+    EXPECT_EQ(array.equal(datetime), (std::vector<uint8_t>{0, 1, 0}));
+}
+
+TEST(DatetimeArray, comparison_masks_account_for_timezone)
+{
+    DatetimeArray array = DatetimeArray(std::vector<int64_t>{946782245006007008}, TZ::UTC);
+
+    EXPECT_EQ(array.equal(Datetime(2000, 1, 1, 22, 4, 5, 6, 7, 8, TZ::EST)),
+              std::vector<uint8_t>{1});
+}
+
+TEST(DatetimeArray, between_includes_begin_excludes_end)
+{
+    Datetime begin = Datetime(1970, 1, 1, 0, 0, 0, 0, 0, 2, TZ::UTC);
+    Datetime end = Datetime(1970, 1, 1, 0, 0, 0, 0, 0, 4, TZ::UTC);
+    DatetimeArray array = DatetimeArray(std::vector<int64_t>{1, 2, 3, 4, 5}, TZ::UTC);
+
+    EXPECT_EQ(array.between(begin, end), (std::vector<uint8_t>{0, 1, 1, 0, 0}));
+}
+
+TEST(DatetimeArray, empty_operations)
+{
+    DatetimeArray array = DatetimeArray(TZ::UTC);
+    array += TimeDelta(1);
+    array.floor(TimeComponent::HOUR);
+
+    EXPECT_TRUE(array.empty());
+    EXPECT_TRUE(array.day_of_week().empty());
+    EXPECT_TRUE(array.less(Datetime()).empty());
+    EXPECT_TRUE(array.to_datetimes().empty());
+}
@@ -1,6 +1,7 @@
 #include "gtest/gtest.h"
 
 #include <datetime/datetime.h>
+#include <algorithm>
 
 
 TEST(Datetime, constructor_date_sets_members)
@@ -467,6 +468,29 @@ TEST(Datetime, operator_minusequal_nanosecond_subtracts_microsecond)
         EXPECT_EQ(datetime.nanosecond, 999);
 }
 
+TEST(Datetime, operator_plusequal_nanosecond_adds_day)
+{
+        Datetime datetime = Datetime(2000, 12, 31, 23, 59, 59, 999, 999, 999);
+        datetime += Nanoseconds(1);
+        EXPECT_EQ(datetime, Datetime(2001, 1, 1));
+}
+
+TEST(Datetime, operator_minusequal_nanosecond_subtracts_day)
+{
+        Datetime datetime = Datetime(2001, 1, 1);
+        datetime -= Nanoseconds(1);
+        EXPECT_EQ(datetime, Datetime(2000, 12, 31, 23, 59, 59, 999, 999, 999));
+}
+
+TEST(Datetime, operator_plusequal_minutes_adds_many_days)
+{
+        Datetime datetime = Datetime(2000, 1, 1, 12);
+        datetime += Minutes(60 * 24 * 366 + 1);
+        EXPECT_EQ(datetime, Datetime(2001, 1, 1, 12, 1));
+        datetime -= Minutes(60 * 24 * 366 + 1);
+        EXPECT_EQ(datetime, Datetime(2000, 1, 1, 12));
+}
+
 TEST(Datetime, operator_incremenet)
 {
         Datetime datetime = Datetime(2000, 1, 1);
@@ -503,7 +527,7 @@ TEST(Datetime, constructor_string_DateComponent1_DateComponent2_DateComponent3_T
     EXPECT_EQ(datetime.millisecond, 6);
     EXPECT_EQ(datetime.microsecond, 7);
     EXPECT_EQ(datetime.nanosecond, 8);
-    EXPECT_EQ(datetime.timezone.utc_offset, 9);
+    EXPECT_EQ(datetime.timezone.utc_offset_minutes, 9 * 60);
 }
 
 TEST(Datetime, constructor_string_DateComponent1_DateComponent2_DateComponent3_TimeComponents_skip)
@@ -521,12 +545,147 @@ TEST(Datetime, constructor_string_DateComponent1_DateComponent2_DateComponent3_T
     EXPECT_EQ(datetime.nanosecond, 4);
 }
 
+TEST(Datetime, constructor_string_iso_full)
+{
+    Datetime datetime = Datetime("2000-01-02 03:04:50.006007008-09:00");
+    EXPECT_EQ(datetime.year, 2000);
+    EXPECT_EQ(datetime.month, 1);
+    EXPECT_EQ(datetime.day, 2);
+    EXPECT_EQ(datetime.hour, 3);
+    EXPECT_EQ(datetime.minute, 4);
+    EXPECT_EQ(datetime.second, 50);
+    EXPECT_EQ(datetime.millisecond, 6);
+    EXPECT_EQ(datetime.microsecond, 7);
+    EXPECT_EQ(datetime.nanosecond, 8);
+    EXPECT_EQ(datetime.timezone.utc_offset_minutes, 9 * 60);
+}
+
+TEST(Datetime, constructor_string_iso_partial)
+{
+    EXPECT_EQ(Datetime("2000-01-02"), Datetime(2000, 1, 2));
+    EXPECT_EQ(Datetime("2000-01-02T03:04"), Datetime(2000, 1, 2, 3, 4));
+    EXPECT_EQ(Datetime("2000-01-02T03:04:05Z"), Datetime(2000, 1, 2, 3, 4, 5, 0, 0, 0, TZ::UTC));
+    EXPECT_EQ(Datetime("2000-01-02T03:04:05.12+01:00"),
+              Datetime(2000, 1, 2, 3, 4, 5, 120, 0, 0, Timezone(-1)));
+}
+
+TEST(Datetime, constructor_string_iso_minutes_offset)
+{
+    EXPECT_EQ(Datetime("2000-01-02T03:04:05+05:30").timezone, Timezone(Minutes(-330)));
+    EXPECT_EQ(Datetime("2000-01-02T03:04:05+05:45").timezone, Timezone(Minutes(-345)));
+    EXPECT_EQ(Datetime("2000-01-02T03:04:05-03:30").timezone, Timezone(Minutes(210)));
+    EXPECT_EQ(Datetime("2000-01-02T03:04:05+05:30"),
+              Datetime(2000, 1, 1, 21, 34, 5, 0, 0, 0, TZ::UTC));
+}
+
+TEST(Datetime, set_timezone_minutes)
+{
+    Datetime datetime = Datetime(2000, 1, 1, 22, 0, 0, 0, 0, 0, TZ::UTC);
+    datetime.set_timezone(Timezone(Minutes(-345)));
+    EXPECT_EQ(datetime.day, 2);
+    EXPECT_EQ(datetime.hour, 3);
+    EXPECT_EQ(datetime.minute, 45);
+    EXPECT_EQ(datetime.to_ns(TZ::UTC), Datetime(2000, 1, 1, 22, 0, 0, 0, 0, 0, TZ::UTC)
+                                           .to_ns(TZ::UTC));
+}
+
+TEST(Datetime, constructor_string_iso_throws_invalid_argument)
+{
+    EXPECT_THROW(Datetime("2000/01/02"), std::invalid_argument);
+    EXPECT_THROW(Datetime("2000-01-02 3:04"), std::invalid_argument);
+    EXPECT_THROW(Datetime("2000-01-02 03:04:05."), std::invalid_argument);
+    EXPECT_THROW(Datetime("2000-01-02 03:04:05.0123456789"), std::invalid_argument);
+    EXPECT_THROW(Datetime("2000-01-02 03:04:05+05:60"), std::invalid_argument);
+    EXPECT_THROW(Datetime("2000-01-02 03:04:05 "), std::invalid_argument);
+    EXPECT_THROW(Datetime("2001-02-29"), std::invalid_argument);
+    EXPECT_THROW(Datetime("2000-01-02 24:00"), std::invalid_argument);
+}
+
+TEST(Datetime, try_parse_iso)
+{
+    std::expected<Datetime, ParseError> datetime = Datetime::try_parse("2000-01-02T03:04:05Z");
+    ASSERT_TRUE(datetime.has_value());
+    EXPECT_EQ(*datetime, Datetime(2000, 1, 2, 3, 4, 5, 0, 0, 0, TZ::UTC));
+}
+
+TEST(Datetime, try_parse_iso_offset_bound)
+{
+    // Both this and 'Time::try_parse' read offsets of up to 24 hours either way.
+    EXPECT_EQ(Datetime::try_parse("2024-01-02T00:00+24:00")->timezone.utc_offset_minutes, -1440);
+    EXPECT_EQ(Datetime::try_parse("2024-01-02T00:00-24:00")->timezone.utc_offset_minutes, 1440);
+}
+
+TEST(Datetime, try_parse_iso_error_code_and_offset)
+{
+    using Code = ParseError::Code;
+    EXPECT_EQ(Datetime::try_parse("2000/01/02").error(), (ParseError{Code::EXPECTED_SEPARATOR, 4}));
+    EXPECT_EQ(Datetime::try_parse("2000-01-0x").error(), (ParseError{Code::EXPECTED_DIGIT, 8}));
+    EXPECT_EQ(Datetime::try_parse("2000-01-02 03:04:05.").error(),
+              (ParseError{Code::EXPECTED_DIGIT, 20}));
+    EXPECT_EQ(Datetime::try_parse("2000-01-02 03:04:05+05:60").error(),
+              (ParseError{Code::UNSUPPORTED_OFFSET, 19}));
+    EXPECT_EQ(Datetime::try_parse("2024-01-02T00:00+99:59").error(),
+              (ParseError{Code::UNSUPPORTED_OFFSET, 16}));
+    EXPECT_EQ(Datetime::try_parse("2024-01-02T00:00-24:01").error(),
+              (ParseError{Code::UNSUPPORTED_OFFSET, 16}));
+    EXPECT_EQ(Datetime::try_parse("2000-01-02 03:04!").error(),
+              (ParseError{Code::TRAILING_CHARACTERS, 16}));
+    EXPECT_EQ(Datetime::try_parse("2001-02-29").error(), (ParseError{Code::INVALID_DATE, 0}));
+    EXPECT_EQ(Datetime::try_parse("2000-01-02 24:00").error(),
+              (ParseError{Code::INVALID_TIME, 11}));
+}
+
+TEST(Datetime, try_parse_components)
+{
+    std::expected<Datetime, ParseError> datetime = Datetime::try_parse("2000-01-02 3:04",
+                                                                       DateComponent::YEAR,
+                                                                       DateComponent::MONTH,
+                                                                       DateComponent::DAY,
+                                                                       TimeComponent::HOUR,
+                                                                       TimeComponent::MINUTE);
+    EXPECT_EQ(*datetime, Datetime(2000, 1, 2, 3, 4));
+
+    datetime = Datetime::try_parse("2000-01-02 3", DateComponent::YEAR, DateComponent::MONTH,
+                                   DateComponent::DAY, TimeComponent::HOUR,
+                                   TimeComponent::MINUTE);
+    EXPECT_EQ(datetime.error(), (ParseError{ParseError::Code::MISSING_COMPONENT, 12}));
+}
+
+TEST(Datetime, parse_error_message)
+{
+    std::string_view string = "2000/01/02";
+    EXPECT_EQ(Datetime::try_parse(string).error().message(string),
+              "'2000/01/02' could not be parsed: expected a separator at offset 4");
+}
+
+TEST(Datetime, constructor_unchecked_sets_members)
+{
+    Datetime datetime = Datetime(UNCHECKED, 2000, 1, 2, 3, 4, 5, 6, 7, 8, TZ::UTC);
+    EXPECT_EQ(datetime, Datetime(2000, 1, 2, 3, 4, 5, 6, 7, 8, TZ::UTC));
+}
+
 TEST(Datetime, to_string)
 {
     Datetime datetime = Datetime(2000, 1, 2, 3, 4, 50, 6, 7, 8);
     EXPECT_EQ(datetime.to_string(TimeComponent::TIMEZONE), "2000-01-02 3:04:50.6.7.8+5:00");
 }
 
+TEST(Datetime, to_chars)
+{
+    Datetime datetime = Datetime(2000, 1, 2, 3, 4, 50, 6, 7, 8, TZ::EST);
+    char buffer[Datetime::MAX_CHARS];
+    std::to_chars_result result = datetime.to_chars(buffer, buffer + Datetime::MAX_CHARS);
+    EXPECT_EQ(result.ec, std::errc());
+    EXPECT_EQ(std::string_view(buffer, result.ptr), "2000-01-02 3:04:50.6.7.8+5:00");
+
+    result = datetime.to_chars(buffer, buffer + Datetime::MAX_CHARS, TimeComponent::MINUTE, '/',
+                               'T');
+    EXPECT_EQ(std::string_view(buffer, result.ptr), "2000/01/02T3:04");
+
+    result = datetime.to_chars(buffer, buffer + 10);
+    EXPECT_EQ(result.ec, std::errc::value_too_large);
+}
+
 TEST(Datetime, ostream)
 {
         Datetime datetime = Datetime(2000, 1, 2, 3, 4, 5, 6, 7, 8);
@@ -563,6 +722,38 @@ TEST(Datetime, from_ms_complex)
     EXPECT_EQ(datetime.nanosecond, 0);
 }
 
+TEST(Datetime, from_ms_leap_day)
+{
+    Datetime datetime = Datetime::from_ms(1709251199999, TZ::UTC);
+    EXPECT_EQ(datetime, Datetime(2024, 2, 29, 23, 59, 59, 999, 0, 0, TZ::UTC));
+}
+
+TEST(Datetime, from_us)
+{
+    Datetime datetime = Datetime::from_us(946803845999998, TZ::UTC);
+    EXPECT_EQ(datetime, Datetime(2000, 1, 2, 9, 4, 5, 999, 998, 0, TZ::UTC));
+}
+
+TEST(Datetime, from_ns)
+{
+    Datetime datetime = Datetime::from_ns(946803845999998997, TZ::EST);
+    EXPECT_EQ(datetime.year, 2000);
+    EXPECT_EQ(datetime.month, 1);
+    EXPECT_EQ(datetime.day, 2);
+    EXPECT_EQ(datetime.hour, 4);
+    EXPECT_EQ(datetime.minute, 4);
+    EXPECT_EQ(datetime.second, 5);
+    EXPECT_EQ(datetime.millisecond, 999);
+    EXPECT_EQ(datetime.microsecond, 998);
+    EXPECT_EQ(datetime.nanosecond, 997);
+}
+
+TEST(Datetime, from_ns_epoch)
+{
+    Datetime datetime = Datetime::from_ns(0, TZ::UTC);
+    EXPECT_EQ(datetime, Datetime(1970, 1, 1, 0, 0, 0, 0, 0, 0, TZ::UTC));
+}
+
 TEST(Datetime, operator_plus_time)
 {
     Datetime datetime = Datetime(2000, 1, 2, 3, 4, 5, 6, 7, 8) + Time(1, 2, 3, 4, 5, 6);
@@ -699,6 +890,25 @@ TEST(Datetime, operator_minus_nanosecond)
     EXPECT_EQ(new_datetime, Datetime(2000, 1, 1, 1, 2, 3, 4, 5, 5));
 }
 
+TEST(Datetime, set_timezone_subtracts_day)
+{
+    Datetime datetime = Datetime(2000, 1, 1, 2, 0, 0, 0, 0, 0, TZ::UTC);
+    datetime.set_timezone(TZ::EST);
+    EXPECT_EQ(datetime.year, 1999);
+    EXPECT_EQ(datetime.month, 12);
+    EXPECT_EQ(datetime.day, 31);
+    EXPECT_EQ(datetime.hour, 21);
+    EXPECT_EQ(datetime.timezone, TZ::EST);
+}
+
+TEST(Datetime, set_timezone_adds_day)
+{
+    Datetime datetime = Datetime(1999, 12, 31, 21, 0, 0, 0, 0, 0, TZ::EST);
+    datetime.set_timezone(TZ::UTC);
+    EXPECT_EQ(datetime, Datetime(2000, 1, 1, 2, 0, 0, 0, 0, 0, TZ::UTC));
+    EXPECT_EQ(datetime.day, 1);
+}
+
 TEST(Datetime, to_ms_same_timezone)
 {
     Datetime datetime = Datetime(2000, 1, 2, 3, 4, 5, 6, 0, 0);
@@ -726,6 +936,41 @@ TEST(Datetime, to_ms_timezone)
     EXPECT_EQ(datetime.to_ms(TZ::CST), 946684800000);
 }
 
+TEST(Datetime, to_us)
+{
+    Datetime datetime = Datetime(2000, 1, 2, 3, 4, 5, 6, 7, 8, TZ::UTC);
+    EXPECT_EQ(datetime.to_us(), 946782245006007);
+}
+
+TEST(Datetime, to_ns)
+{
+    Datetime datetime = Datetime(2000, 1, 1, 22, 4, 5, 6, 7, 8, TZ::EST);
+    EXPECT_EQ(datetime.to_ns(), 946782245006007008);
+}
+
+TEST(Datetime, to_ns_from_ns_round_trip)
+{
+    for (Datetime datetime : {Datetime(1970, 1, 1, 0, 0, 0, 0, 0, 0, TZ::UTC),
+                              Datetime(1999, 12, 31, 23, 59, 59, 999, 999, 999, TZ::UTC),
+                              Datetime(2000, 2, 29, 12, 0, 0, 0, 0, 1, TZ::UTC),
+                              Datetime(2100, 12, 31, 23, 59, 59, 999, 999, 999, TZ::UTC)})
+    {
+        EXPECT_EQ(Datetime::from_ns(datetime.to_ns(), TZ::UTC), datetime);
+    }
+}
+
+TEST(Datetime, from_ns_to_ns_every_day)
+{
+    const size_t nanoseconds_per_day = 86'400'000'000'000;
+    Date date = Date(1970, 1, 1);
+    for (size_t days = 0; date < Date(2100, 12, 31); ++days, ++date)
+    {
+        Datetime datetime = Datetime::from_ns(days * nanoseconds_per_day, TZ::UTC);
+        ASSERT_EQ(datetime.date(), date);
+        ASSERT_EQ(datetime.to_ns(), days * nanoseconds_per_day);
+    }
+}
+
 TEST(Datetime, operator_plus_datetime_time_delta_pos_day)
 {
     Datetime datetime = Datetime(2000, 1, 1) + TimeDelta(1);
@@ -1124,4 +1369,110 @@ TEST(Datetime, floor)
     datetime = Datetime(2000, 1, 1, 1, 1, 1, 1, 1, 499);
     datetime.floor(TimeComponent::NANOSECOND);
     EXPECT_EQ(datetime, Datetime(2000, 1, 1, 1, 1, 1, 1, 1, 499));
-}
\ No newline at end of file
+}
+
+TEST(Datetime, round_up_adds_day)
+{
+    Datetime datetime = Datetime(2000, 12, 31, 23, 59, 59, 999, 999, 500);
+    datetime.round(TimeComponent::MICROSECOND);
+    EXPECT_EQ(datetime, Datetime(2001, 1, 1));
+
+    datetime = Datetime(2000, 12, 31, 23, 30);
+    datetime.round(TimeComponent::HOUR);
+    EXPECT_EQ(datetime, Datetime(2001, 1, 1));
+}
+
+TEST(Datetime, ceil_up_adds_day)
+{
+    Datetime datetime = Datetime(2000, 12, 31, 23, 0, 0, 0, 0, 1);
+    datetime.ceil(TimeComponent::HOUR);
+    EXPECT_EQ(datetime, Datetime(2001, 1, 1));
+}
+TEST(Datetime, constexpr_construct_and_arithmetic)
+{
+    constexpr Datetime open = Datetime(2024, 1, 2, 9, 30, 0, 0, 0, 0, TZ::EST);
+    constexpr Datetime close = open + Hours(6) + Minutes(30);
+    static_assert(close == Datetime(2024, 1, 2, 16, 0, 0, 0, 0, 0, TZ::EST));
+    static_assert(close - open == TimeDelta(0, 6, 30));
+    static_assert(Datetime::from_ns(open.to_ns(), TZ::EST) == open);
+    static_assert((Datetime(2000, 12, 31, 23, 59, 0, 0, 0, 0, TZ::UTC) + Minutes(1)).year == 2001);
+    EXPECT_EQ(open.hour, 9);
+}
+
+TEST(Datetime, comparisons_across_timezones)
+{
+    Datetime utc = Datetime(2000, 1, 1, 3, 0, 0, 0, 0, 0, TZ::UTC);
+    Datetime est = Datetime(1999, 12, 31, 22, 0, 0, 0, 0, 0, TZ::EST);
+    EXPECT_EQ(utc, est);
+    EXPECT_LE(utc, est);
+    EXPECT_GE(utc, est);
+    EXPECT_LT(est, est + Nanoseconds(1));
+    EXPECT_GT(utc + Nanoseconds(1), est);
+    EXPECT_NE(utc, est + Nanoseconds(1));
+}
+
+TEST(Datetime, hash_equal_instants)
+{
+    Datetime utc = Datetime(2000, 1, 1, 3, 0, 0, 0, 0, 0, TZ::UTC);
+    Datetime est = Datetime(1999, 12, 31, 22, 0, 0, 0, 0, 0, TZ::EST);
+    EXPECT_EQ(std::hash<Datetime>{}(utc), std::hash<Datetime>{}(est));
+    EXPECT_NE(std::hash<Datetime>{}(utc), std::hash<Datetime>{}(utc + Nanoseconds(1)));
+}
+
+static_assert(std::ranges::random_access_range<IotaView<Datetime, Microseconds>>);
+static_assert(std::ranges::sized_range<IotaView<Datetime, Microseconds>>);
+
+TEST(Datetime, iota_days)
+{
+    IotaView<Datetime, Days> actual = Datetime::iota(Datetime(2022, 12, 30, 12),
+                                                     Datetime(2023, 1, 1),
+                                                     Days(1));
+    std::vector<Datetime> expected = {Datetime(2022, 12, 30, 12),
+                                      Datetime(2022, 12, 31, 12)};
+    EXPECT_TRUE(std::ranges::equal(actual, expected));
+}
+
+TEST(Datetime, iota_matches_range)
+{
+    Datetime start = Datetime(2022, 12, 31, 23, 59, 58, 0, 0, 0, TZ::UTC);
+    Datetime end = Datetime(2023, 1, 1, 0, 0, 1, 0, 0, 0, TZ::UTC);
+    EXPECT_EQ(Datetime::iota(start, end, Milliseconds(250)).to_vector(),
+              Datetime::range(start, end, Milliseconds(250)));
+    EXPECT_EQ(Datetime::iota(start, end, Milliseconds(250)).size(), 13);
+}
+
+TEST(Datetime, iota_end_in_other_timezone)
+{
+    IotaView<Datetime, Hours> view = Datetime::iota(Datetime(2023, 1, 1, 23, 0, 0, 0, 0, 0,
+                                                             TZ::UTC),
+                                                    Datetime(2023, 1, 1, 20, 0, 0, 0, 0, 0,
+                                                             TZ::EST),
+                                                    Hours(1));
+    EXPECT_EQ(view.size(), 3);
+    EXPECT_EQ(view.back(), Datetime(2023, 1, 2, 1, 0, 0, 0, 0, 0, TZ::UTC));
+}
+
+TEST(Datetime, iota_microseconds_is_lazy)
+{
+    // A day of microseconds, far too many to store.
+    IotaView<Datetime, Microseconds> view = Datetime::iota(Datetime(2023, 1, 1),
+                                                           Datetime(2023, 1, 2),
+                                                           Microseconds(1));
+    EXPECT_EQ(view.size(), 86'400'000'001);
+    EXPECT_EQ(view[86'400'000'000], Datetime(2023, 1, 2));
+    EXPECT_EQ(view[43'200'000'001], Datetime(2023, 1, 1, 12, 0, 0, 0, 1));
+
+    auto iterator = view.end();
+    --iterator;
+    EXPECT_EQ(*iterator, Datetime(2023, 1, 2));
+    iterator -= 1'000'000;
+    EXPECT_EQ(*iterator, Datetime(2023, 1, 1, 23, 59, 59));
+}
+
+TEST(Datetime, iota_across_years)
+{
+    IotaView<Datetime, Days> view = Datetime::iota(Datetime(1970, 1, 1), Datetime(2100, 1, 1),
+                                                   Days(1));
+    EXPECT_EQ(view.size(), Date(2100, 1, 1).to_day_number() + 1);
+    EXPECT_EQ(view[view.size() - 1], Datetime(2100, 1, 1));
+}
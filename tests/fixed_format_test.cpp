@@ -0,0 +1,180 @@
+#include "gtest/gtest.h"
+#include <datetime/datetime.h>
+#include <fmt/format.h>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+/**
+ * Parses 'rows' as 'format', expecting every row to parse.
+ */
+std::vector<Timestamp> parse_all(const std::vector<std::string_view>& rows,
+                                 const FixedFormat& format)
+{
+    std::vector<Timestamp> timestamps(rows.size());
+    auto result = parse_fixed(rows, format, timestamps);
+    EXPECT_TRUE(result.has_value()) << result.error().index << " "
+                                    << result.error().error.message(rows[result.error().index]);
+    return timestamps;
+}
+
+/**
+ * Parses the single 'row' as 'format', expecting it to fail.
+ */
+ParseError parse_error(std::string_view row, const FixedFormat& format)
+{
+    Timestamp timestamp;
+    auto result = parse_fixed(std::span(&row, 1), format, std::span(&timestamp, 1));
+    EXPECT_FALSE(result.has_value()) << row;
+    return result.has_value() ? ParseError{} : result.error().error;
+}
+
+const FixedFormat VENDOR = FixedFormat("%Y-%m-%d %H:%M:%S.%6f", TZ::UTC);
+}
+
+TEST(FixedFormat, width)
+{
+    EXPECT_EQ(VENDOR.get_width(), 26);
+    EXPECT_EQ(FixedFormat("%Y%m%d").get_width(), 8);
+    EXPECT_EQ(FixedFormat("%Y-%m-%dT%H:%M:%S.%f").get_width(), 29);
+    EXPECT_EQ(FixedFormat("%%%Y-%m-%d").get_width(), 11);
+}
+
+TEST(FixedFormat, matches_timestamps_of_formatted_datetimes)
+{
+    // Random microseconds from 1970 to 2100, an odd number of them.
+    std::vector<Timestamp> expected;
+    uint64_t state = 88172645463325252ull;
+    for (int i = 0; i < 1'001; i++)
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        expected.push_back(Timestamp(static_cast<int64_t>(state % 4'102'444'800'000'000)
+                                     * Timestamp::NANOSECONDS_PER_MICROSECOND));
+    }
+
+    std::vector<std::string> strings;
+    for (Timestamp timestamp : expected)
+        strings.push_back(fmt::format("{:%Y-%m-%d %H:%M:%S.%6f}", timestamp.datetime(TZ::UTC)));
+    std::vector<std::string_view> rows(strings.begin(), strings.end());
+
+    EXPECT_EQ(parse_all(rows, VENDOR), expected);
+}
+
+TEST(FixedFormat, matches_iso_parser)
+{
+    std::vector<std::string_view> rows = {"1970-01-01 00:00:00.000000",
+                                          "2024-02-29 23:59:59.999999",
+                                          "2100-12-31 12:34:56.000001"};
+    std::vector<Timestamp> timestamps = parse_all(rows, VENDOR);
+
+    for (size_t i = 0; i < rows.size(); i++)
+    {
+        Datetime datetime = Datetime(fmt::format("{}Z", rows[i]));
+        EXPECT_EQ(timestamps[i], Timestamp(datetime)) << rows[i];
+    }
+}
+
+TEST(FixedFormat, timezone)
+{
+    std::vector<std::string_view> rows = {"2024-01-02 09:30:00.000000"};
+    FixedFormat format = FixedFormat("%Y-%m-%d %H:%M:%S.%6f", TZ::EST);
+
+    EXPECT_EQ(parse_all(rows, format)[0],
+              Timestamp(Datetime(2024, 1, 2, 9, 30, 0, 0, 0, 0, TZ::EST)));
+}
+
+TEST(FixedFormat, other_layouts)
+{
+    EXPECT_EQ(parse_all({"20240102"}, FixedFormat("%Y%m%d", TZ::UTC))[0],
+              Timestamp(Datetime(2024, 1, 2, 0, 0, 0, 0, 0, 0, TZ::UTC)));
+    EXPECT_EQ(parse_all({"02/01/2024 09:30"}, FixedFormat("%d/%m/%Y %H:%M", TZ::UTC))[0],
+              Timestamp(Datetime(2024, 1, 2, 9, 30, 0, 0, 0, 0, TZ::UTC)));
+    EXPECT_EQ(parse_all({"2024-01-02T09:30:15.123456789"},
+                        FixedFormat("%Y-%m-%dT%H:%M:%S.%f", TZ::UTC))[0],
+              Timestamp(Datetime(2024, 1, 2, 9, 30, 15, 123, 456, 789, TZ::UTC)));
+    EXPECT_EQ(parse_all({"2024-01-02 09:30:15.1"},
+                        FixedFormat("%Y-%m-%d %H:%M:%S.%1f", TZ::UTC))[0],
+              Timestamp(Datetime(2024, 1, 2, 9, 30, 15, 100, 0, 0, TZ::UTC)));
+    EXPECT_EQ(parse_all({"%2024-01-02"}, FixedFormat("%%%Y-%m-%d", TZ::UTC))[0],
+              Timestamp(Datetime(2024, 1, 2, 0, 0, 0, 0, 0, 0, TZ::UTC)));
+}
+
+TEST(FixedFormat, strings_at_the_end_of_a_page)
+{
+    // Each string ends closer to the next page than the width of the kernels' loads.
+    alignas(4096) static char pages[8192];
+    std::string_view string = "2024-02-29 23:59:59.999999";
+    for (size_t end = 4096 - 31; end <= 4096; end++)
+    {
+        std::memcpy(pages + end - string.size(), string.data(), string.size());
+        std::vector<std::string_view> rows = {{pages + end - string.size(), string.size()}};
+
+        EXPECT_EQ(parse_all(rows, VENDOR)[0],
+                  Timestamp(Datetime(2024, 2, 29, 23, 59, 59, 999, 999, 0, TZ::UTC)));
+    }
+}
+
+TEST(FixedFormat, errors)
+{
+    EXPECT_EQ(parse_error("2024-01-02 09:30:0x.000000", VENDOR),
+              (ParseError{ParseError::Code::EXPECTED_DIGIT, 18}));
+    EXPECT_EQ(parse_error("2024/01/02 09:30:00.000000", VENDOR),
+              (ParseError{ParseError::Code::EXPECTED_SEPARATOR, 4}));
+    EXPECT_EQ(parse_error("2024-01-02 09:30:00", VENDOR),
+              (ParseError{ParseError::Code::MISSING_COMPONENT, 19}));
+    EXPECT_EQ(parse_error("2024-01-02 09:30:00.0000001", VENDOR),
+              (ParseError{ParseError::Code::TRAILING_CHARACTERS, 26}));
+    EXPECT_EQ(parse_error("2024-01-02 24:00:00.000000", VENDOR),
+              (ParseError{ParseError::Code::INVALID_TIME, 11}));
+    EXPECT_EQ(parse_error("2024-01-02 23:60:00.000000", VENDOR),
+              (ParseError{ParseError::Code::INVALID_TIME, 11}));
+    EXPECT_EQ(parse_error("2023-02-29 00:00:00.000000", VENDOR),
+              (ParseError{ParseError::Code::INVALID_DATE, 0}));
+    EXPECT_EQ(parse_error("2024-13-01 00:00:00.000000", VENDOR),
+              (ParseError{ParseError::Code::INVALID_DATE, 0}));
+    EXPECT_EQ(parse_error("1969-12-31 23:59:59.999999", VENDOR),
+              (ParseError{ParseError::Code::INVALID_DATE, 0}));
+    EXPECT_EQ(parse_error("", VENDOR), (ParseError{ParseError::Code::MISSING_COMPONENT, 0}));
+}
+
+TEST(FixedFormat, error_reports_first_failing_index)
+{
+    std::vector<std::string_view> rows(37, "2024-01-02 09:30:00.000000");
+    rows[21] = "2024-01-02 09:30:00.00000x";
+    rows[30] = "bad";
+    std::vector<Timestamp> timestamps(rows.size());
+
+    auto result = parse_fixed(rows, VENDOR, timestamps);
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(),
+              (FixedFormat::Error{21, ParseError{ParseError::Code::EXPECTED_DIGIT, 25}}));
+    EXPECT_EQ(timestamps[20], Timestamp(Datetime(2024, 1, 2, 9, 30, 0, 0, 0, 0, TZ::UTC)));
+}
+
+TEST(FixedFormat, empty_batch)
+{
+    EXPECT_TRUE(parse_fixed({}, VENDOR, {}).has_value());
+}
+
+TEST(FixedFormat, output_size_mismatch_throws)
+{
+    std::vector<std::string_view> rows = {"2024-01-02 09:30:00.000000"};
+    std::vector<Timestamp> timestamps(2);
+    EXPECT_THROW(parse_fixed(rows, VENDOR, timestamps), std::invalid_argument);
+}
+
+TEST(FixedFormat, invalid_formats_throw)
+{
+    EXPECT_THROW(FixedFormat("%Y-%m"), std::invalid_argument);
+    EXPECT_THROW(FixedFormat("%Y-%m-%d %z"), std::invalid_argument);
+    EXPECT_THROW(FixedFormat("%Y-%m-%d %0f"), std::invalid_argument);
+    EXPECT_THROW(FixedFormat("%Y-%m-%d %H %H"), std::invalid_argument);
+    EXPECT_THROW(FixedFormat("%Y-%m-%d %3f %6f"), std::invalid_argument);
+    EXPECT_THROW(FixedFormat("%Y-%m-%d %"), std::invalid_argument);
+    EXPECT_THROW(FixedFormat("%Y-%m-%dT%H:%M:%S.%f and more"), std::invalid_argument);
+}
@@ -0,0 +1,71 @@
+#include "gtest/gtest.h"
+#include <datetime/datetime.h>
+
+TEST(Format, datetime_default_matches_to_string)
+{
+    Datetime datetime = Datetime(2000, 1, 2, 3, 4, 5, 6, 7, 8, TZ::EST);
+    EXPECT_EQ(fmt::format("{}", datetime), datetime.to_string());
+}
+
+TEST(Format, datetime_iso)
+{
+    Datetime datetime = Datetime(2000, 1, 2, 3, 4, 5, 6, 7, 8, TZ::EST);
+    EXPECT_EQ(fmt::format("{:%Y-%m-%dT%H:%M:%S.%9f%z}", datetime),
+              "2000-01-02T03:04:05.006007008-05:00");
+
+    datetime.set_timezone(TZ::UTC);
+    EXPECT_EQ(fmt::format("{:%Y-%m-%dT%H:%M:%S.%9f%z}", datetime),
+              "2000-01-02T08:04:05.006007008+00:00");
+}
+
+TEST(Format, datetime_iso_round_trip)
+{
+    Datetime datetime = Datetime(2024, 2, 29, 23, 59, 59, 999, 999, 999, TZ::CST);
+    EXPECT_EQ(Datetime(fmt::format("{:%Y-%m-%d %H:%M:%S.%f%z}", datetime)), datetime);
+}
+
+TEST(Format, datetime_iso_minutes_offset)
+{
+    Datetime datetime = Datetime("2000-01-02T03:04:05+05:45");
+    EXPECT_EQ(fmt::format("{:%Y-%m-%dT%H:%M:%S%z}", datetime), "2000-01-02T03:04:05+05:45");
+    EXPECT_EQ(fmt::format("{}", datetime.timezone), "-5:45");
+
+    datetime.set_timezone(Timezone(Minutes(210)));
+    EXPECT_EQ(fmt::format("{:%Y-%m-%dT%H:%M:%S%z}", datetime), "2000-01-01T17:49:05-03:30");
+    EXPECT_EQ(Datetime(fmt::format("{:%Y-%m-%d %H:%M:%S.%f%z}", datetime)), datetime);
+}
+
+TEST(Format, fraction_digits)
+{
+    Time time = Time(1, 2, 3, 456, 789, 12, TZ::UTC);
+    EXPECT_EQ(fmt::format("{:%S.%3f}", time), "03.456");
+    EXPECT_EQ(fmt::format("{:%S.%6f}", time), "03.456789");
+    EXPECT_EQ(fmt::format("{:%S.%1f}", time), "03.4");
+}
+
+TEST(Format, literals_and_percent)
+{
+    Date date = Date(2000, 1, 2);
+    EXPECT_EQ(fmt::format("{:Y=%Y 100%% d=%d}", date), "Y=2000 100% d=02");
+}
+
+TEST(Format, date_time_timedelta_timezone)
+{
+    EXPECT_EQ(fmt::format("{}", Date(2000, 1, 2)), "2000-01-02");
+    EXPECT_EQ(fmt::format("{:%d/%m/%Y}", Date(2000, 1, 2)), "02/01/2000");
+    EXPECT_EQ(fmt::format("{}", Time(1, 2, 3, 4, 5, 6, TZ::EST)), "1:02:03.4.5.6+5:00");
+    EXPECT_EQ(fmt::format("{:%H:%M%z}", Time(1, 2, 3, 4, 5, 6, TZ::EST)), "01:02-05:00");
+    EXPECT_EQ(fmt::format("{}", TimeDelta(1, 2, 3, 4, 5, 6, 7)), "1 days, 2:03:04.5.6.7");
+    EXPECT_EQ(fmt::format("{:%Dd %H:%M}", TimeDelta(1, 2, 3, 4, 5, 6, 7)), "1d 02:03");
+    EXPECT_EQ(fmt::format("{}", TZ::EST), "5:00");
+    EXPECT_EQ(fmt::format("{:%z}", TZ::EST), "-05:00");
+}
+
+TEST(Format, invalid_spec_throws_format_error)
+{
+    Date date = Date(2000, 1, 2);
+    EXPECT_THROW((void) fmt::format(fmt::runtime("{:%H}"), date), fmt::format_error);
+    EXPECT_THROW((void) fmt::format(fmt::runtime("{:%Y%}"), date), fmt::format_error);
+    EXPECT_THROW((void) fmt::format(fmt::runtime("{:%3d}"), date), fmt::format_error);
+    EXPECT_THROW((void) fmt::format(fmt::runtime("{:%f}"), date), fmt::format_error);
+}
@@ -1,6 +1,44 @@
 #include "gtest/gtest.h"
 
 #include <datetime/datetime.h>
+#include <algorithm>
+#include <cstdlib>
+#include <ctime>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+/**
+ * Sets the 'TZ' environment variable while in scope, then restores it.
+ */
+class ScopedTZ
+{
+public:
+    explicit ScopedTZ(const char* value)
+    {
+        if (const char* old = std::getenv("TZ"))
+            previous = old;
+        setenv("TZ", value, 1);
+        tzset();
+    }
+
+    ~ScopedTZ()
+    {
+        if (previous)
+            setenv("TZ", previous->c_str(), 1);
+        else
+            unsetenv("TZ");
+        tzset();
+    }
+
+private:
+    std::optional<std::string> previous;
+};
+}
 
 TEST(Time, constructor_sets_members)
 {
@@ -220,10 +258,102 @@ TEST(Time, set_timezone_wraps)
 
 TEST(Time, set_default_timezone)
 {
-        Timezone original_default_timezone = Time::default_timezone;
+        Timezone original_default_timezone = Time::get_default_timezone();
         Time::set_default_timezone(TZ::UTC);
-        EXPECT_EQ(Time::default_timezone, TZ::UTC);
-        Time::default_timezone = original_default_timezone;
+        EXPECT_EQ(Time::get_default_timezone(), TZ::UTC);
+        EXPECT_EQ(Time().timezone, TZ::UTC);
+        Time::set_default_timezone(original_default_timezone);
+}
+
+TEST(Time, static_time_takes_default_timezone_whatever_the_syntax)
+{
+    // Both are initialized when first reached, after the default changed.
+    ScopedDefaultTimezone utc = ScopedDefaultTimezone(TZ::UTC);
+    static Time copy_initialized = Time(9, 30);
+    static Time direct_initialized(9, 30);
+    EXPECT_EQ(copy_initialized.timezone, TZ::UTC);
+    EXPECT_EQ(direct_initialized.timezone, TZ::UTC);
+}
+
+TEST(Time, thread_default_timezone_overrides_process_default)
+{
+    Timezone process_default = Time::get_default_timezone();
+    EXPECT_EQ(Time::get_thread_default_timezone(), std::nullopt);
+
+    Time::set_thread_default_timezone(TZ::PST);
+    EXPECT_EQ(Time().timezone, TZ::PST);
+    EXPECT_EQ(Datetime(2000, 1, 2).timezone, TZ::PST);
+
+    // Other threads keep the process default.
+    Timezone other_thread = TZ::UTC;
+    std::thread([&other_thread] { other_thread = Time().timezone; }).join();
+    EXPECT_EQ(other_thread, process_default);
+
+    Time::set_thread_default_timezone(std::nullopt);
+    EXPECT_EQ(Time().timezone, process_default);
+}
+
+TEST(Time, scoped_default_timezone_nests)
+{
+    Timezone process_default = Time::get_default_timezone();
+    {
+        ScopedDefaultTimezone outer = ScopedDefaultTimezone(TZ::CST);
+        EXPECT_EQ(Time().timezone, TZ::CST);
+        {
+            ScopedDefaultTimezone inner = ScopedDefaultTimezone(Timezone(Minutes(-330)));
+            EXPECT_EQ(Time().timezone, Timezone(Minutes(-330)));
+        }
+        EXPECT_EQ(Time().timezone, TZ::CST);
+    }
+    EXPECT_EQ(Time::get_thread_default_timezone(), std::nullopt);
+    EXPECT_EQ(Time().timezone, process_default);
+}
+
+TEST(Time, default_timezone_stress)
+{
+    // Threads with their own defaults construct while the process default keeps changing, and
+    // each must only ever see its own default, or one of the process defaults.
+    Timezone original_default_timezone = Time::get_default_timezone();
+    constexpr int THREADS = 8;
+    constexpr int ITERATIONS = 20'000;
+    std::atomic<bool> done = false;
+    std::atomic<int> wrong = 0;
+
+    std::thread writer = std::thread([&done] {
+        for (int i = 0; !done.load(); i++)
+            Time::set_default_timezone(i % 2 == 0 ? TZ::UTC : TZ::EST);
+    });
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; t++)
+    {
+        threads.emplace_back([t, &wrong] {
+            if (t % 2 == 0)
+            {
+                Timezone own = Timezone(t);
+                ScopedDefaultTimezone scope = ScopedDefaultTimezone(own);
+                for (int i = 0; i < ITERATIONS; i++)
+                    if (Datetime(2000, 1, 2, 3, 4).timezone != own || Time().timezone != own)
+                        wrong++;
+            }
+            else
+            {
+                for (int i = 0; i < ITERATIONS; i++)
+                {
+                    Timezone timezone = Time().timezone;
+                    if (timezone != TZ::UTC && timezone != TZ::EST)
+                        wrong++;
+                }
+            }
+        });
+    }
+    for (std::thread& thread : threads)
+        thread.join();
+    done = true;
+    writer.join();
+
+    EXPECT_EQ(wrong.load(), 0);
+    Time::set_default_timezone(original_default_timezone);
 }
 
 TEST(Time, ostream)
@@ -458,6 +588,101 @@ TEST(Timezone, to_string)
     EXPECT_EQ(est_string, "5:00");
 }
 
+TEST(Timezone, to_string_minutes)
+{
+    EXPECT_EQ(Timezone(Minutes(-330)).to_string(), "-5:30");
+    EXPECT_EQ(Timezone(Minutes(-345)).to_string(), "-5:45");
+    EXPECT_EQ(Timezone(Minutes(210)).to_string(), "3:30");
+    EXPECT_EQ(Timezone(Minutes(-30)).to_string(), "-0:30");
+}
+
+TEST(Timezone, minutes_and_hours)
+{
+    static_assert(sizeof(Timezone) == 2);
+    EXPECT_EQ(TZ::EST.utc_offset_minutes, 300);
+    EXPECT_EQ(Timezone(Minutes(300)), TZ::EST);
+    EXPECT_EQ(TZ::EST.get_utc_offset_diff(TZ::CST).value, -60);
+    EXPECT_EQ(TZ::UTC.get_utc_offset_diff(Timezone(Minutes(-330))).value, 330);
+}
+
+TEST(Timezone, out_of_range_throws)
+{
+    EXPECT_EQ(Timezone(Minutes(1440)).utc_offset_minutes, 1440);
+    EXPECT_EQ(Timezone(-24).utc_offset_minutes, -1440);
+    EXPECT_THROW(Timezone(Minutes(1441)), std::invalid_argument);
+    EXPECT_THROW(Timezone(Minutes(-1441)), std::invalid_argument);
+    EXPECT_THROW(Timezone(Minutes(40'000)), std::invalid_argument);
+    EXPECT_THROW(Timezone(25), std::invalid_argument);
+    EXPECT_THROW(Timezone(-547), std::invalid_argument);
+}
+
+TEST(Timezone, get_local_tz_reads_TZ)
+{
+    {
+        ScopedTZ tz = ScopedTZ("UTC0");
+        EXPECT_EQ(TZ::helpers::get_local_tz(), TZ::UTC);
+    }
+    {
+        ScopedTZ tz = ScopedTZ("<+0530>-5:30");
+        EXPECT_EQ(TZ::helpers::get_local_tz(), Timezone(Minutes(-330)));
+    }
+}
+
+TEST(Timezone, get_local_tz_does_not_throw_on_unknown_name)
+{
+    // Central European Time, whose name 'get_from_str' does not know.
+    ScopedTZ tz = ScopedTZ("CET-1");
+    EXPECT_THROW(TZ::helpers::get_from_str("CET"), std::invalid_argument);
+    EXPECT_NO_THROW(TZ::helpers::get_local_tz());
+    EXPECT_EQ(TZ::helpers::get_local_tz(), Timezone(-1));
+}
+
+TEST(Timezone, local_is_read_once)
+{
+    std::vector<Timezone> results = std::vector<Timezone>(8, TZ::PST);
+    std::vector<std::thread> threads;
+    for (Timezone& result : results)
+        threads.emplace_back([&result] { result = TZ::local(); });
+    for (std::thread& thread : threads)
+        thread.join();
+
+    Timezone local = TZ::local();
+    for (Timezone result : results)
+        EXPECT_EQ(result, local);
+
+    // Later changes to 'TZ' are not picked up.
+    ScopedTZ tz = ScopedTZ(local == TZ::UTC ? "<+0530>-5:30" : "UTC0");
+    EXPECT_EQ(TZ::local(), local);
+    EXPECT_EQ(Timezone(TZ::LOCAL), local);
+    EXPECT_EQ(Time(1, 2, 3, 0, 0, 0, TZ::LOCAL).timezone, local);
+}
+
+TEST(Timezone, LOCAL_has_the_members_of_local)
+{
+    Timezone local = TZ::local();
+    char buffer[Timezone::MAX_CHARS];
+    std::ostringstream os;
+    os << TZ::LOCAL;
+
+    EXPECT_EQ(TZ::LOCAL.to_string(), local.to_string());
+    EXPECT_EQ(std::string(buffer, TZ::LOCAL.to_chars(buffer, buffer + Timezone::MAX_CHARS).ptr),
+              local.to_string());
+    EXPECT_EQ(TZ::LOCAL.get_utc_offset_diff(TZ::UTC).value,
+              local.get_utc_offset_diff(TZ::UTC).value);
+    EXPECT_EQ(os.str(), local.to_string());
+    EXPECT_EQ(fmt::format("{}", TZ::LOCAL), fmt::format("{}", local));
+    EXPECT_TRUE(TZ::LOCAL == local);
+}
+
+TEST(Time, set_timezone_minutes)
+{
+    Time time = Time(12, 0, 0, 0, 0, 0, TZ::UTC);
+    time.set_timezone(Timezone(Minutes(-345)));
+    EXPECT_EQ(time, Time(17, 45, 0, 0, 0, 0, Timezone(Minutes(-345))));
+    EXPECT_EQ(time.hour, 17);
+    EXPECT_EQ(time.minute, 45);
+}
+
 TEST(Time, round_up)
 {
         Time time = Time(11, 29, 30, 1, 1, 1);
@@ -601,6 +826,27 @@ TEST(Time, to_string_include_up_to_millisecond)
     EXPECT_EQ(time.to_string(TimeComponent::MILLISECOND), "1:02:30.4");
 }
 
+TEST(Time, to_chars)
+{
+    Time time = Time(1, 2, 30, 4, 5, 6, TZ::EST);
+    char buffer[Time::MAX_CHARS];
+    std::to_chars_result result = time.to_chars(buffer, buffer + Time::MAX_CHARS);
+    EXPECT_EQ(result.ec, std::errc());
+    EXPECT_EQ(std::string_view(buffer, result.ptr), "1:02:30.4.5.6+5:00");
+
+    result = time.to_chars(buffer, buffer + Time::MAX_CHARS, TimeComponent::SECOND, '-');
+    EXPECT_EQ(std::string_view(buffer, result.ptr), "1-02-30");
+}
+
+TEST(Time, to_chars_value_too_large)
+{
+    Time time = Time(1, 2, 30, 4, 5, 6, TZ::EST);
+    char buffer[17];
+    std::to_chars_result result = time.to_chars(buffer, buffer + sizeof(buffer));
+    EXPECT_EQ(result.ec, std::errc::value_too_large);
+    EXPECT_EQ(result.ptr, buffer + sizeof(buffer));
+}
+
 
 TEST(Time, string_TimeComponents_0_at_front_of_timezone)
 {
@@ -614,7 +860,7 @@ TEST(Time, string_TimeComponents_0_at_front_of_timezone)
     EXPECT_EQ(time.millisecond, 4);
     EXPECT_EQ(time.microsecond, 5);
     EXPECT_EQ(time.nanosecond, 6);
-    EXPECT_EQ(time.timezone.utc_offset, 7);
+    EXPECT_EQ(time.timezone.utc_offset_minutes, 7 * 60);
 }
 
 TEST(Time, string_TimeComponents_1_digit_timezone)
@@ -629,7 +875,7 @@ TEST(Time, string_TimeComponents_1_digit_timezone)
     EXPECT_EQ(time.millisecond, 4);
     EXPECT_EQ(time.microsecond, 5);
     EXPECT_EQ(time.nanosecond, 6);
-    EXPECT_EQ(time.timezone.utc_offset, 7);
+    EXPECT_EQ(time.timezone.utc_offset_minutes, 7 * 60);
 }
 
 TEST(Time, string_TimeComponents_2_digit_timezone)
@@ -644,7 +890,59 @@ TEST(Time, string_TimeComponents_2_digit_timezone)
     EXPECT_EQ(time.millisecond, 4);
     EXPECT_EQ(time.microsecond, 5);
     EXPECT_EQ(time.nanosecond, 6);
-    EXPECT_EQ(time.timezone.utc_offset, 12);
+    EXPECT_EQ(time.timezone.utc_offset_minutes, 12 * 60);
+}
+
+TEST(Time, string_TimeComponents_minutes_timezone)
+{
+    Time time = Time("1:02 5:30", TimeComponent::HOUR, TimeComponent::MINUTE,
+                     TimeComponent::TIMEZONE);
+    EXPECT_EQ(time.hour, 1);
+    EXPECT_EQ(time.minute, 2);
+    EXPECT_EQ(time.timezone.utc_offset_minutes, 5 * 60 + 30);
+}
+
+TEST(Time, string_TimeComponents_east_timezone_round_trips)
+{
+    for (int minutes : {-330, -345, -60, 0, 300, 570})
+    {
+        Time time = Time(1, 2, 3, 4, 5, 6, Timezone(Minutes(minutes)));
+        Time parsed = Time(time.to_string(), TimeComponent::HOUR, TimeComponent::MINUTE,
+                           TimeComponent::SECOND, TimeComponent::MILLISECOND,
+                           TimeComponent::MICROSECOND, TimeComponent::NANOSECOND,
+                           TimeComponent::TIMEZONE);
+        EXPECT_EQ(parsed, time) << time.to_string();
+    }
+}
+
+TEST(Time, string_TimeComponents_signed_timezone)
+{
+    EXPECT_EQ(Time("1:02 -5:45", TimeComponent::HOUR, TimeComponent::MINUTE,
+                   TimeComponent::TIMEZONE).timezone.utc_offset_minutes, -345);
+    EXPECT_EQ(Time("1:02 +5:45", TimeComponent::HOUR, TimeComponent::MINUTE,
+                   TimeComponent::TIMEZONE).timezone.utc_offset_minutes, 345);
+    EXPECT_EQ(Time("-5:30", TimeComponent::TIMEZONE).timezone.utc_offset_minutes, -330);
+}
+
+TEST(Time, try_parse_timezone_minutes_out_of_range)
+{
+    EXPECT_EQ(Time::try_parse("1:02 5:99", TimeComponent::HOUR, TimeComponent::MINUTE,
+                              TimeComponent::TIMEZONE).error(),
+              (ParseError{ParseError::Code::UNSUPPORTED_OFFSET, 7}));
+}
+
+TEST(Time, try_parse_timezone_out_of_range)
+{
+    EXPECT_EQ(Time::try_parse("1:02+1000", TimeComponent::HOUR, TimeComponent::MINUTE,
+                              TimeComponent::TIMEZONE).error(),
+              (ParseError{ParseError::Code::UNSUPPORTED_OFFSET, 5}));
+    EXPECT_EQ(Time::try_parse("1:02+-24:01", TimeComponent::HOUR, TimeComponent::MINUTE,
+                              TimeComponent::TIMEZONE).error(),
+              (ParseError{ParseError::Code::UNSUPPORTED_OFFSET, 6}));
+    EXPECT_THROW(Time("1:02+1000", TimeComponent::HOUR, TimeComponent::MINUTE,
+                      TimeComponent::TIMEZONE), std::invalid_argument);
+    EXPECT_EQ(Time("1:02+-24:00", TimeComponent::HOUR, TimeComponent::MINUTE,
+                   TimeComponent::TIMEZONE).timezone.utc_offset_minutes, -1440);
 }
 
 TEST(Time, string_TimeComponents_skip)
@@ -670,6 +968,21 @@ TEST(Time, constructor_string_TimeComponents_throws_invalid_argument_on_out_of_r
     EXPECT_THROW(Time("25", TimeComponent::HOUR), std::invalid_argument);
 }
 
+TEST(Time, try_parse)
+{
+    EXPECT_EQ(Time::try_parse("3:04 +6", TimeComponent::HOUR, TimeComponent::MINUTE,
+                              TimeComponent::TIMEZONE).value(),
+              Time(3, 4, 0, 0, 0, 0, TZ::CST));
+    EXPECT_EQ(Time::try_parse("25", TimeComponent::HOUR).error(),
+              (ParseError{ParseError::Code::INVALID_TIME, 0}));
+}
+
+TEST(Time, constructor_unchecked_sets_members)
+{
+    Time time = Time(UNCHECKED, 1, 2, 3, 4, 5, 6, TZ::CST);
+    EXPECT_EQ(time, Time(1, 2, 3, 4, 5, 6, TZ::CST));
+}
+
 TEST(Time, operator_plus_time)
 {
     TimeDelta time_delta = Time(1, 2, 3, 4, 5, 6) + Time(2, 3, 4, 5, 6, 7);
@@ -682,6 +995,12 @@ TEST(Time, operator_plus_time_day_wrap)
     EXPECT_EQ(time_delta, TimeDelta(1));
 }
 
+TEST(Time, operator_plus_time_day_wrap_from_minutes)
+{
+    TimeDelta time_delta = Time(23, 59) + Time(0, 1);
+    EXPECT_EQ(time_delta, TimeDelta(1));
+}
+
 TEST(Time, operator_minus_time)
 {
     TimeDelta time_delta = Time(3, 5, 7, 9, 11, 13) - Time(2, 3, 4, 5, 6, 7);
@@ -885,3 +1204,61 @@ TEST(Time, max)
 {
     EXPECT_EQ(Time::max(), Time(23, 59, 59, 999, 999, 999));
 }
+
+TEST(Time, constexpr_evaluation)
+{
+    constexpr Time time = Time(23, 59, 59, 999, 999, 999, TZ::UTC) + Nanoseconds(1);
+    static_assert(time == Time(0, 0, 0, 0, 0, 0, TZ::UTC));
+    static_assert(Time(1, 2, 3, 4, 5, 6, TZ::UTC).total_nanoseconds() == 3'723'004'005'006);
+    static_assert(Time(12, 0, 0, 0, 0, 0, TZ::UTC).timezone == TZ::UTC);
+    EXPECT_EQ(time.hour, 0);
+}
+
+static_assert(std::ranges::random_access_range<IotaView<Time, Seconds>>);
+static_assert(std::ranges::sized_range<IotaView<Time, Seconds>>);
+
+TEST(Time, iota)
+{
+    IotaView<Time, Minutes> actual = Time::iota(Time(10, 58, 0, 0, 0, 0, TZ::UTC),
+                                                Time(11, 0, 30, 0, 0, 0, TZ::UTC),
+                                                Minutes(1));
+    std::vector<Time> expected = {Time(10, 58, 0, 0, 0, 0, TZ::UTC),
+                                  Time(10, 59, 0, 0, 0, 0, TZ::UTC),
+                                  Time(11, 0, 0, 0, 0, 0, TZ::UTC)};
+    EXPECT_TRUE(std::ranges::equal(actual, expected));
+}
+
+TEST(Time, iota_end_before_start)
+{
+    // One nanosecond before 'start' must not round up to an empty distance of 0 hours.
+    EXPECT_TRUE(Time::iota(Time(10, 0, 0, 0, 0, 1, TZ::UTC),
+                           Time(10, 0, 0, 0, 0, 0, TZ::UTC),
+                           Hours(1)).empty());
+}
+
+TEST(Time, iota_end_in_other_timezone)
+{
+    IotaView<Time, Hours> view = Time::iota(Time(10, 0, 0, 0, 0, 0, TZ::UTC),
+                                            Time(8, 0, 0, 0, 0, 0, TZ::EST),
+                                            Hours(1));
+    EXPECT_EQ(view.size(), 4);
+    EXPECT_EQ(view.back(), Time(13, 0, 0, 0, 0, 0, TZ::UTC));
+}
+
+TEST(Time, iota_whole_day_does_not_wrap)
+{
+    IotaView<Time, Hours> view = Time::iota(Time(0, 0, 0, 0, 0, 0, TZ::UTC),
+                                            Time(23, 30, 0, 0, 0, 0, TZ::UTC),
+                                            Hours(1));
+    EXPECT_EQ(view.size(), 24);
+    EXPECT_EQ(view.back(), Time(23, 0, 0, 0, 0, 0, TZ::UTC));
+}
+
+TEST(Time, iota_nanoseconds_is_lazy)
+{
+    IotaView<Time, Nanoseconds> view = Time::iota(Time(0, 0, 0, 0, 0, 0, TZ::UTC),
+                                                  Time(23, 59, 59, 999, 999, 999, TZ::UTC),
+                                                  Nanoseconds(1));
+    EXPECT_EQ(view.size(), 86'400'000'000'000);
+    EXPECT_EQ(view[3'600'000'000'123], Time(1, 0, 0, 0, 0, 123, TZ::UTC));
+}
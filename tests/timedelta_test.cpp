@@ -395,4 +395,24 @@ TEST(TimeDelta, abs_neg)
 {
     TimeDelta time_delta = TimeDelta(-1);
     ASSERT_EQ(time_delta.abs().days, 1);
-}
\ No newline at end of file
+}
+TEST(TimeDelta, constexpr_evaluation)
+{
+    constexpr TimeDelta time_delta = TimeDelta(-1, 2, 3);
+    static_assert(TimeDelta(time_delta).abs() == TimeDelta(1, 2, 3));
+    static_assert(TimeDelta(0, 1).total_minutes() == 60);
+    EXPECT_EQ(time_delta.days, -1);
+}
+
+TEST(TimeDelta, to_chars)
+{
+    TimeDelta time_delta = TimeDelta(-1, 2, 3, 4, 5, 6, 7);
+    char buffer[TimeDelta::MAX_CHARS];
+    std::to_chars_result result = time_delta.to_chars(buffer, buffer + TimeDelta::MAX_CHARS);
+    EXPECT_EQ(result.ec, std::errc());
+    EXPECT_EQ(std::string_view(buffer, result.ptr), "-1 days, 2:03:04.5.6.7");
+
+    std::stringstream actual;
+    actual << time_delta;
+    EXPECT_EQ(actual.str(), "-1 days, 2:03:04.5.6.7");
+}
@@ -0,0 +1,253 @@
+#include "gtest/gtest.h"
+#include <datetime/datetime.h>
+#include <algorithm>
+#include <random>
+
+namespace
+{
+/**
+ * Clock the tests move by hand.
+ */
+struct FakeClock
+{
+    Datetime now = Datetime(2023, 1, 1, 0, 0, 0, 0, 0, 0, TZ::UTC);
+
+    TimerWheel::Clock clock()
+    {
+        return [this] { return now; };
+    }
+};
+}
+
+TEST(TimerWheel, fires_at_deadline)
+{
+    FakeClock clock;
+    TimerWheel wheel = TimerWheel(Milliseconds(1), clock.clock());
+
+    int fired = 0;
+    wheel.schedule(clock.now + Milliseconds(5), [&fired] { fired++; });
+    EXPECT_EQ(wheel.size(), 1);
+
+    clock.now += Milliseconds(4);
+    EXPECT_EQ(wheel.poll(), 0);
+    EXPECT_EQ(fired, 0);
+
+    clock.now += Milliseconds(1);
+    EXPECT_EQ(wheel.poll(), 1);
+    EXPECT_EQ(fired, 1);
+    EXPECT_TRUE(wheel.empty());
+}
+
+TEST(TimerWheel, never_fires_before_deadline)
+{
+    FakeClock clock;
+    TimerWheel wheel = TimerWheel(Milliseconds(10), clock.clock());
+
+    int fired = 0;
+    wheel.schedule(clock.now + Milliseconds(15), [&fired] { fired++; });
+
+    EXPECT_EQ(wheel.advance(clock.now + Milliseconds(14)), 0);
+    EXPECT_EQ(wheel.advance(clock.now + Milliseconds(19)), 0);
+    EXPECT_EQ(wheel.advance(clock.now + Milliseconds(20)), 1);
+}
+
+TEST(TimerWheel, fires_in_deadline_order)
+{
+    FakeClock clock;
+    TimerWheel wheel = TimerWheel(Milliseconds(1), clock.clock());
+
+    std::vector<int> order;
+    wheel.schedule(clock.now + Hours(72), [&order] { order.push_back(5); });
+    wheel.schedule(clock.now + Milliseconds(200), [&order] { order.push_back(2); });
+    wheel.schedule(clock.now + Hours(2), [&order] { order.push_back(4); });
+    wheel.schedule(clock.now + Milliseconds(3), [&order] { order.push_back(1); });
+    wheel.schedule(clock.now + Seconds(70), [&order] { order.push_back(3); });
+
+    EXPECT_EQ(wheel.advance(clock.now + Hours(96)), 5);
+    EXPECT_EQ(order, std::vector<int>({1, 2, 3, 4, 5}));
+}
+
+TEST(TimerWheel, deadline_timezone_is_accounted_for)
+{
+    FakeClock clock;
+    TimerWheel wheel = TimerWheel(Milliseconds(1), clock.clock());
+
+    int fired = 0;
+    // 2022-12-31 19:00 EST is 2023-01-01 00:00 UTC.
+    wheel.schedule(Datetime(2022, 12, 31, 19, 0, 1, 0, 0, 0, TZ::EST), [&fired] { fired++; });
+
+    EXPECT_EQ(wheel.advance(clock.now + Milliseconds(999)), 0);
+    EXPECT_EQ(wheel.advance(clock.now + Seconds(1)), 1);
+}
+
+TEST(TimerWheel, schedule_time_delta)
+{
+    FakeClock clock;
+    TimerWheel wheel = TimerWheel(Microseconds(1), clock.clock());
+    wheel.advance(clock.now + Seconds(10));
+
+    int fired = 0;
+    wheel.schedule(TimeDelta(0, 0, 0, 0, 0, 250), [&fired] { fired++; });
+
+    EXPECT_EQ(wheel.advance(clock.now + Seconds(10) + Microseconds(249)), 0);
+    EXPECT_EQ(wheel.advance(clock.now + Seconds(10) + Microseconds(250)), 1);
+    EXPECT_EQ(fired, 1);
+}
+
+TEST(TimerWheel, past_deadline_fires_on_next_advance)
+{
+    FakeClock clock;
+    TimerWheel wheel = TimerWheel(Milliseconds(1), clock.clock());
+
+    int fired = 0;
+    wheel.schedule(clock.now - Hours(1), [&fired] { fired++; });
+    EXPECT_EQ(wheel.poll(), 1);
+    EXPECT_EQ(fired, 1);
+}
+
+TEST(TimerWheel, cancel)
+{
+    FakeClock clock;
+    TimerWheel wheel = TimerWheel(Milliseconds(1), clock.clock());
+
+    int fired = 0;
+    TimerWheel::TimerId cancelled = wheel.schedule(clock.now + Seconds(1), [&fired] { fired++; });
+    TimerWheel::TimerId kept = wheel.schedule(clock.now + Seconds(1), [&fired] { fired += 10; });
+    EXPECT_NE(cancelled, TimerWheel::INVALID_TIMER);
+
+    EXPECT_TRUE(wheel.cancel(cancelled));
+    EXPECT_FALSE(wheel.cancel(cancelled));
+    EXPECT_EQ(wheel.size(), 1);
+
+    EXPECT_EQ(wheel.advance(clock.now + Seconds(1)), 1);
+    EXPECT_EQ(fired, 10);
+    EXPECT_FALSE(wheel.cancel(kept));
+    EXPECT_FALSE(wheel.cancel(TimerWheel::INVALID_TIMER));
+}
+
+TEST(TimerWheel, cancel_stale_id_does_not_cancel_reused_timer)
+{
+    FakeClock clock;
+    TimerWheel wheel = TimerWheel(Milliseconds(1), clock.clock());
+
+    TimerWheel::TimerId first = wheel.schedule(clock.now + Seconds(1), [] {});
+    EXPECT_TRUE(wheel.cancel(first));
+
+    int fired = 0;
+    TimerWheel::TimerId second = wheel.schedule(clock.now + Seconds(1), [&fired] { fired++; });
+    EXPECT_NE(first, second);
+    EXPECT_FALSE(wheel.cancel(first));
+
+    wheel.advance(clock.now + Seconds(1));
+    EXPECT_EQ(fired, 1);
+}
+
+TEST(TimerWheel, callbacks_can_schedule_and_cancel)
+{
+    FakeClock clock;
+    TimerWheel wheel = TimerWheel(Milliseconds(1), clock.clock());
+
+    std::vector<int> order;
+    TimerWheel::TimerId victim = wheel.schedule(clock.now + Milliseconds(2),
+                                                [&order] { order.push_back(0); });
+    wheel.schedule(clock.now + Milliseconds(1), [&]
+    {
+        order.push_back(1);
+        wheel.cancel(victim);
+        wheel.schedule(clock.now + Milliseconds(3), [&order] { order.push_back(2); });
+        wheel.schedule(clock.now, [&order] { order.push_back(3); });
+    });
+
+    EXPECT_EQ(wheel.advance(clock.now + Milliseconds(5)), 2);
+    EXPECT_EQ(order, std::vector<int>({1, 2}));
+
+    // Already due when it was scheduled, so it waits for the next call.
+    EXPECT_EQ(wheel.advance(clock.now + Milliseconds(5)), 1);
+    EXPECT_EQ(order, std::vector<int>({1, 2, 3}));
+}
+
+TEST(TimerWheel, callback_cancels_timer_due_on_same_tick)
+{
+    FakeClock clock;
+    TimerWheel wheel = TimerWheel(Milliseconds(1), clock.clock());
+
+    int fired = 0;
+    TimerWheel::TimerId second = TimerWheel::INVALID_TIMER;
+    wheel.schedule(clock.now + Milliseconds(1), [&] { fired++; wheel.cancel(second); });
+    second = wheel.schedule(clock.now + Milliseconds(1), [&fired] { fired++; });
+
+    EXPECT_EQ(wheel.advance(clock.now + Milliseconds(1)), 1);
+    EXPECT_EQ(fired, 1);
+    EXPECT_TRUE(wheel.empty());
+}
+
+TEST(TimerWheel, throwing_callback_leaves_the_rest_for_next_call)
+{
+    FakeClock clock;
+    TimerWheel wheel = TimerWheel(Milliseconds(1), clock.clock());
+
+    int fired = 0;
+    wheel.schedule(clock.now + Milliseconds(1), [] { throw std::runtime_error("failed"); });
+    wheel.schedule(clock.now + Milliseconds(1), [&fired] { fired++; });
+    wheel.schedule(clock.now + Milliseconds(2), [&fired] { fired++; });
+
+    EXPECT_THROW(wheel.advance(clock.now + Milliseconds(2)), std::runtime_error);
+    EXPECT_EQ(fired, 0);
+    EXPECT_EQ(wheel.size(), 2);
+
+    EXPECT_EQ(wheel.advance(clock.now + Milliseconds(2)), 2);
+    EXPECT_EQ(fired, 2);
+}
+
+TEST(TimerWheel, advance_backwards_is_ignored)
+{
+    FakeClock clock;
+    TimerWheel wheel = TimerWheel(Milliseconds(1), clock.clock());
+
+    int fired = 0;
+    wheel.advance(clock.now + Seconds(5));
+    wheel.schedule(TimeDelta(0, 0, 0, 1), [&fired] { fired++; });
+
+    EXPECT_EQ(wheel.advance(clock.now), 0);
+    EXPECT_EQ(wheel.advance(clock.now + Seconds(6)), 1);
+}
+
+TEST(TimerWheel, throws_invalid_argument_on_non_positive_resolution)
+{
+    FakeClock clock;
+    EXPECT_THROW(TimerWheel(Milliseconds(0), clock.clock()), std::invalid_argument);
+    EXPECT_THROW(TimerWheel(Microseconds(-1), clock.clock()), std::invalid_argument);
+}
+
+TEST(TimerWheel, matches_sorted_deadlines)
+{
+    FakeClock clock;
+    TimerWheel wheel = TimerWheel(Microseconds(1), clock.clock());
+    Datetime start = clock.now;
+
+    std::mt19937_64 random(42);
+    std::vector<int64_t> deadlines;
+    std::vector<int64_t> fired;
+    int64_t now = 0;
+    for (int i = 0; i < 5'000; i++)
+    {
+        // Mostly near deadlines, some far enough to sit in the higher wheels.
+        int64_t deadline = now + static_cast<int64_t>(random() % (i % 10 == 0 ? 1'000'000'000
+                                                                              : 5'000));
+        deadlines.push_back(deadline);
+        wheel.schedule(start + Microseconds(deadline), [&fired, deadline, &now]
+        {
+            EXPECT_LE(deadline, now);
+            fired.push_back(deadline);
+        });
+
+        now += static_cast<int64_t>(random() % 3'000);
+        wheel.advance(start + Microseconds(now));
+    }
+    now += 1'000'000'000;
+    wheel.advance(start + Microseconds(now));
+
+    std::sort(deadlines.begin(), deadlines.end());
+    EXPECT_EQ(fired, deadlines);
+    EXPECT_TRUE(wheel.empty());
+}
@@ -0,0 +1,142 @@
+#include "gtest/gtest.h"
+#include <datetime/datetime.h>
+
+TEST(Timestamp, constructor_epoch_nanoseconds_sets_member)
+{
+    Timestamp timestamp = Timestamp(946782245006007008);
+    EXPECT_EQ(timestamp.epoch_nanoseconds, 946782245006007008);
+}
+
+TEST(Timestamp, constructor_datetime_utc)
+{
+    Timestamp timestamp = Timestamp(Datetime(2000, 1, 2, 3, 4, 5, 6, 7, 8, TZ::UTC));
+    EXPECT_EQ(timestamp.epoch_nanoseconds, 946782245006007008);
+}
+
+TEST(Timestamp, constructor_datetime_timezone)
+{
+    Timestamp timestamp = Timestamp(Datetime(2000, 1, 1, 22, 4, 5, 6, 7, 8, TZ::EST));
+    EXPECT_EQ(timestamp.epoch_nanoseconds, 946782245006007008);
+}
+
+TEST(Timestamp, constructor_date_time)
+{
+    Timestamp timestamp = Timestamp(Date(2000, 1, 2), Time(3, 4, 5, 6, 7, 8, TZ::UTC));
+    EXPECT_EQ(timestamp, Timestamp(Datetime(2000, 1, 2, 3, 4, 5, 6, 7, 8, TZ::UTC)));
+}
+
+TEST(Timestamp, constructor_date)
+{
+    Timestamp timestamp = Timestamp(Date(1970, 1, 2), TZ::UTC);
+    EXPECT_EQ(timestamp.epoch_nanoseconds, Timestamp::NANOSECONDS_PER_DAY);
+}
+
+TEST(Timestamp, datetime_round_trip)
+{
+    Datetime datetime = Datetime(2024, 2, 29, 23, 59, 59, 999, 999, 999, TZ::CST);
+    Datetime converted = Timestamp(datetime).datetime(TZ::CST);
+    EXPECT_EQ(converted.year, 2024);
+    EXPECT_EQ(converted.month, 2);
+    EXPECT_EQ(converted.day, 29);
+    EXPECT_EQ(converted.hour, 23);
+    EXPECT_EQ(converted.minute, 59);
+    EXPECT_EQ(converted.second, 59);
+    EXPECT_EQ(converted.millisecond, 999);
+    EXPECT_EQ(converted.microsecond, 999);
+    EXPECT_EQ(converted.nanosecond, 999);
+    EXPECT_EQ(converted.timezone, TZ::CST);
+}
+
+TEST(Timestamp, datetime_timezone)
+{
+    Datetime datetime = Timestamp(946782245006007008).datetime(TZ::EST);
+    EXPECT_EQ(datetime, Datetime(2000, 1, 1, 22, 4, 5, 6, 7, 8, TZ::EST));
+}
+
+TEST(Timestamp, date)
+{
+    Timestamp timestamp = Timestamp(946782245006007008);
+    EXPECT_EQ(timestamp.date(TZ::UTC), Date(2000, 1, 2));
+    EXPECT_EQ(timestamp.date(TZ::EST), Date(2000, 1, 1));
+}
+
+TEST(Timestamp, time)
+{
+    Timestamp timestamp = Timestamp(946782245006007008);
+    EXPECT_EQ(timestamp.time(TZ::UTC), Time(3, 4, 5, 6, 7, 8, TZ::UTC));
+}
+
+TEST(Timestamp, operator_plus_equal_components)
+{
+    Timestamp timestamp = Timestamp(Datetime(2000, 1, 1, 0, 0, 0, 0, 0, 0, TZ::UTC));
+    timestamp += Days(1);
+    timestamp += Hours(2);
+    timestamp += Minutes(3);
+    timestamp += Seconds(4);
+    timestamp += Milliseconds(5);
+    timestamp += Microseconds(6);
+    timestamp += Nanoseconds(7);
+    EXPECT_EQ(timestamp.datetime(TZ::UTC), Datetime(2000, 1, 2, 2, 3, 4, 5, 6, 7, TZ::UTC));
+}
+
+TEST(Timestamp, operator_minus_equal_components)
+{
+    Timestamp timestamp = Timestamp(Datetime(2000, 1, 2, 2, 3, 4, 5, 6, 7, TZ::UTC));
+    timestamp -= Days(1);
+    timestamp -= Hours(2);
+    timestamp -= Minutes(3);
+    timestamp -= Seconds(4);
+    timestamp -= Milliseconds(5);
+    timestamp -= Microseconds(6);
+    timestamp -= Nanoseconds(7);
+    EXPECT_EQ(timestamp.datetime(TZ::UTC), Datetime(2000, 1, 1, 0, 0, 0, 0, 0, 0, TZ::UTC));
+}
+
+TEST(Timestamp, operator_plus_nanosecond_day_wrap)
+{
+    Timestamp timestamp = Timestamp(Datetime(2000, 12, 31, 23, 59, 59, 999, 999, 999, TZ::UTC));
+    EXPECT_EQ((timestamp + Nanoseconds(1)).datetime(TZ::UTC), Datetime(2001, 1, 1, 0, 0, 0, 0,
+                                                                       0, 0, TZ::UTC));
+}
+
+TEST(Timestamp, operator_plus_minus_timedelta)
+{
+    Timestamp timestamp = Timestamp(946782245006007008);
+    TimeDelta time_delta = TimeDelta(1, 2, 3, 4, 5, 6, 7);
+    EXPECT_EQ(timestamp + time_delta - time_delta, timestamp);
+    EXPECT_EQ((timestamp + time_delta) - timestamp, time_delta);
+}
+
+TEST(Timestamp, operator_minus_timestamp)
+{
+    Timestamp timestamp = Timestamp(Datetime(2000, 1, 2, 3, 0, 0, 0, 0, 0, TZ::UTC));
+    Timestamp other = Timestamp(Datetime(2000, 1, 1, 4, 0, 0, 0, 0, 1, TZ::UTC));
+    EXPECT_EQ(timestamp - other, TimeDelta(0, 22, 59, 59, 999, 999, 999));
+    EXPECT_EQ(other - timestamp, TimeDelta(-1, 1, 0, 0, 0, 0, 1));
+}
+
+TEST(Timestamp, comparisons)
+{
+    Timestamp lesser = Timestamp(Datetime(2000, 1, 1, 1, 0, 0, 0, 0, 0, TZ::UTC));
+    Timestamp greater = Timestamp(Datetime(2000, 1, 1, 1, 0, 0, 0, 0, 0, TZ::EST));
+    EXPECT_GT(greater, lesser);
+    EXPECT_GE(greater, lesser);
+    EXPECT_LT(lesser, greater);
+    EXPECT_LE(lesser, greater);
+    EXPECT_NE(lesser, greater);
+    EXPECT_EQ(lesser, Timestamp(Datetime(1999, 12, 31, 20, 0, 0, 0, 0, 0, TZ::EST)));
+}
+
+TEST(Timestamp, hash_equal_instants)
+{
+    Timestamp utc = Timestamp(Datetime(2000, 1, 1, 5, 0, 0, 0, 0, 0, TZ::UTC));
+    Timestamp est = Timestamp(Datetime(2000, 1, 1, 0, 0, 0, 0, 0, 0, TZ::EST));
+    EXPECT_EQ(std::hash<Timestamp>()(utc), std::hash<Timestamp>()(est));
+}
+
+TEST(Timestamp, ostream)
+{
+    std::stringstream actual;
+    actual << Timestamp(946782245006007008);
+    EXPECT_EQ(actual.str(), "2000-01-02 3:04:05.6.7.8+0:00");
+}
@@ -0,0 +1,313 @@
+#include "gtest/gtest.h"
+#include <datetime/datetime.h>
+#include <filesystem>
+
+namespace
+{
+/**
+ * Builds version 2 TZif data with no transitions, one local time type, and 'footer'.
+ */
+std::string make_tzif(int32_t utc_offset_east, std::string_view abbreviation,
+                      std::string_view footer)
+{
+    auto put = [](std::string& out, int64_t value, int size) {
+        for (int shift = (size - 1) * 8; shift >= 0; shift -= 8)
+            out.push_back(static_cast<char>(value >> shift & 0xFF));
+    };
+    auto block = [&](std::string& out) {
+        out += "TZif2";
+        out.append(15, '\0');
+        int64_t counts[6] = {0, 0, 0, 0, 1, static_cast<int64_t>(abbreviation.size()) + 1};
+        for (int64_t count : counts)
+            put(out, count, 4);
+        put(out, utc_offset_east, 4);
+        put(out, 0, 1);
+        put(out, 0, 1);
+        out += abbreviation;
+        out.push_back('\0');
+    };
+
+    std::string data;
+    block(data);
+    block(data);
+    data += '\n';
+    data += footer;
+    data += '\n';
+    return data;
+}
+
+/**
+ * Gets the whole seconds of 'timestamp'.
+ */
+int64_t whole_seconds(Timestamp timestamp)
+{
+    int64_t seconds = timestamp.epoch_nanoseconds / Timestamp::NANOSECONDS_PER_SECOND;
+    return timestamp.epoch_nanoseconds % Timestamp::NANOSECONDS_PER_SECOND < 0 ? seconds - 1
+                                                                                : seconds;
+}
+
+/**
+ * System database, or skips the test if the system has no zoneinfo.
+ */
+#define REQUIRE_SYSTEM_ZONEINFO() \
+    if (!std::filesystem::exists(TimeZoneDB::system().get_directory() + "/America/New_York")) \
+        GTEST_SKIP() << "no system zoneinfo"
+}
+
+TEST(ZoneInfo, rule_from_footer)
+{
+    ZoneInfo zone = ZoneInfo::from_tzif("Test/Eastern", make_tzif(-5 * 3'600, "EST",
+                                                                  "EST5EDT,M3.2.0,M11.1.0"));
+    EXPECT_EQ(zone.get_name(), "Test/Eastern");
+
+    // Daylight saving time starts 2023-03-12 02:00 EST and ends 2023-11-05 02:00 EDT.
+    ZoneInfo::Offset before = zone.offset_at(Datetime(2023, 3, 12, 6, 59, 59, 0, 0, 0, TZ::UTC));
+    EXPECT_EQ(before.utc_offset_seconds, 5 * 3'600);
+    EXPECT_FALSE(before.is_dst);
+    EXPECT_EQ(before.abbreviation, "EST");
+
+    ZoneInfo::Offset during = zone.offset_at(Datetime(2023, 3, 12, 7, 0, 0, 0, 0, 0, TZ::UTC));
+    EXPECT_EQ(during.utc_offset_seconds, 4 * 3'600);
+    EXPECT_TRUE(during.is_dst);
+    EXPECT_EQ(during.abbreviation, "EDT");
+    EXPECT_EQ(during.get_timezone(), TZ::EDT);
+
+    EXPECT_TRUE(zone.offset_at(Datetime(2023, 11, 5, 5, 59, 59, 0, 0, 0, TZ::UTC)).is_dst);
+    EXPECT_FALSE(zone.offset_at(Datetime(2023, 11, 5, 6, 0, 0, 0, 0, 0, TZ::UTC)).is_dst);
+
+    // Generated through the last year the library supports.
+    EXPECT_TRUE(zone.offset_at(Datetime(2100, 7, 1, 0, 0, 0, 0, 0, 0, TZ::UTC)).is_dst);
+    EXPECT_FALSE(zone.offset_at(Datetime(2100, 12, 31, 0, 0, 0, 0, 0, 0, TZ::UTC)).is_dst);
+}
+
+TEST(ZoneInfo, southern_hemisphere_rule)
+{
+    // Daylight saving time from the first Sunday of October to the first Sunday of April.
+    ZoneInfo zone = ZoneInfo::from_tzif("Test/Sydney", make_tzif(10 * 3'600, "AEST",
+                                                                 "AEST-10AEDT,M10.1.0,M4.1.0/3"));
+
+    ZoneInfo::Offset january = zone.offset_at(Datetime(2024, 1, 15, 0, 0, 0, 0, 0, 0, TZ::UTC));
+    EXPECT_TRUE(january.is_dst);
+    EXPECT_EQ(january.utc_offset_seconds, -11 * 3'600);
+    EXPECT_FALSE(zone.offset_at(Datetime(2024, 7, 15, 0, 0, 0, 0, 0, 0, TZ::UTC)).is_dst);
+
+    // 2024-04-07 03:00 AEDT is 2024-04-06 16:00 UTC.
+    EXPECT_TRUE(zone.offset_at(Datetime(2024, 4, 6, 15, 59, 59, 0, 0, 0, TZ::UTC)).is_dst);
+    EXPECT_FALSE(zone.offset_at(Datetime(2024, 4, 6, 16, 0, 0, 0, 0, 0, TZ::UTC)).is_dst);
+}
+
+TEST(ZoneInfo, fixed_rule)
+{
+    ZoneInfo zone = ZoneInfo::from_tzif("Test/Fixed", make_tzif(3 * 3'600, "MSK", "MSK-3"));
+    ZoneInfo::Offset offset = zone.offset_at(Datetime(2023, 6, 1, 0, 0, 0, 0, 0, 0, TZ::UTC));
+    EXPECT_EQ(offset.utc_offset_seconds, -3 * 3'600);
+    EXPECT_FALSE(offset.is_dst);
+    EXPECT_EQ(zone.local_to_utc(1'000'000), 1'000'000 - 3 * 3'600);
+}
+
+TEST(ZoneInfo, local_times_at_changes)
+{
+    ZoneInfo zone = ZoneInfo::from_tzif("Test/Eastern", make_tzif(-5 * 3'600, "EST",
+                                                                  "EST5EDT,M3.2.0,M11.1.0"));
+
+    // Ordinary times.
+    EXPECT_EQ(zone.from_local(Datetime(2023, 7, 4, 12, 0, 0, 0, 0, 0, TZ::UTC)),
+              Datetime(2023, 7, 4, 16, 0, 0, 0, 0, 0, TZ::UTC));
+    EXPECT_EQ(zone.from_local(Datetime(2023, 7, 4, 12, 0, 0, 0, 0, 0, TZ::UTC)).timezone, TZ::EDT);
+
+    // 02:30 never happens on 2023-03-12, and is taken as 03:30 EDT.
+    Datetime skipped = zone.from_local(Datetime(2023, 3, 12, 2, 30, 0, 0, 0, 0, TZ::UTC));
+    EXPECT_EQ(skipped, Datetime(2023, 3, 12, 3, 30, 0, 0, 0, 0, TZ::EDT));
+    EXPECT_EQ(skipped.timezone, TZ::EDT);
+
+    // 01:30 happens twice on 2023-11-05, and is taken as the first, in EDT.
+    Datetime repeated = zone.from_local(Datetime(2023, 11, 5, 1, 30, 0, 0, 0, 0, TZ::UTC));
+    EXPECT_EQ(repeated, Datetime(2023, 11, 5, 5, 30, 0, 0, 0, 0, TZ::UTC));
+    EXPECT_EQ(repeated.timezone, TZ::EDT);
+
+    EXPECT_EQ(zone.to_local(Datetime(2023, 11, 5, 6, 30, 0, 0, 0, 0, TZ::UTC)),
+              Datetime(2023, 11, 5, 1, 30, 0, 0, 0, 0, TZ::EST));
+    EXPECT_EQ(zone.to_local(Datetime(2023, 11, 5, 6, 30, 0, 0, 0, 0, TZ::UTC)).timezone, TZ::EST);
+}
+
+TEST(ZoneInfo, throws_runtime_error_on_invalid_data)
+{
+    EXPECT_THROW(ZoneInfo::from_tzif("Bad", "not tzif data"), std::runtime_error);
+    EXPECT_THROW(ZoneInfo::from_tzif("Bad", make_tzif(0, "UTC", "UTC0").substr(0, 60)),
+                 std::runtime_error);
+    EXPECT_THROW(ZoneInfo::from_tzif("Bad", make_tzif(0, "UTC", "UTC0,nonsense")),
+                 std::runtime_error);
+
+    // The version 2 header follows the 51 byte version 1 block, and the low byte of its
+    // 'charcnt', the last of its 6 big endian counts, is at 43.
+    std::string no_abbreviations = make_tzif(0, "", "UTC0");
+    no_abbreviations[51 + 43] = '\0';
+    EXPECT_THROW(ZoneInfo::from_tzif("Bad", no_abbreviations), std::runtime_error);
+}
+
+TEST(ZoneInfo, minute_offsets)
+{
+    ZoneInfo zone = ZoneInfo::from_tzif("Test/India", make_tzif(19'800, "IST", "IST-5:30"));
+    ZoneInfo::Offset offset = zone.offset_at(0);
+    EXPECT_EQ(offset.utc_offset_seconds, -19'800);
+    EXPECT_EQ(offset.get_timezone(), Timezone(Minutes(-330)));
+
+    Datetime local = zone.to_local(Datetime(2023, 1, 1, 0, 0, 0, 0, 0, 0, TZ::UTC));
+    EXPECT_EQ(local.hour, 5);
+    EXPECT_EQ(local.minute, 30);
+    EXPECT_EQ(zone.from_local(local), local);
+}
+
+TEST(ZoneInfo, throws_invalid_argument_on_non_minute_offset)
+{
+    ZoneInfo zone = ZoneInfo::from_tzif("Test/Monrovia",
+                                        make_tzif(-2'670, "MMT", "<-0044>0:44:30"));
+    ZoneInfo::Offset offset = zone.offset_at(0);
+    EXPECT_EQ(offset.utc_offset_seconds, 2'670);
+    EXPECT_THROW(offset.get_timezone(), std::invalid_argument);
+    EXPECT_THROW(zone.to_local(Datetime(2023, 1, 1, 0, 0, 0, 0, 0, 0, TZ::UTC)),
+                 std::invalid_argument);
+}
+
+TEST(TimeZoneDB, system_zone_history)
+{
+    REQUIRE_SYSTEM_ZONEINFO();
+    TimeZoneDB& db = TimeZoneDB::system();
+    const ZoneInfo& new_york = db.get("America/New_York");
+    EXPECT_EQ(&new_york, &db.get("America/New_York"));
+
+    // Daylight saving time started on the last Sunday of April until 1986, the first Sunday of
+    // April until 2006, and the second Sunday of March since.
+    EXPECT_TRUE(new_york.offset_at(Datetime(1985, 4, 28, 12, 0, 0, 0, 0, 0, TZ::UTC)).is_dst);
+    EXPECT_FALSE(new_york.offset_at(Datetime(1985, 4, 21, 12, 0, 0, 0, 0, 0, TZ::UTC)).is_dst);
+    EXPECT_TRUE(new_york.offset_at(Datetime(2006, 4, 2, 12, 0, 0, 0, 0, 0, TZ::UTC)).is_dst);
+    EXPECT_FALSE(new_york.offset_at(Datetime(2006, 3, 19, 12, 0, 0, 0, 0, 0, TZ::UTC)).is_dst);
+    EXPECT_TRUE(new_york.offset_at(Datetime(2007, 3, 11, 12, 0, 0, 0, 0, 0, TZ::UTC)).is_dst);
+
+    // Past the end of the file's table, from its footer rule.
+    EXPECT_TRUE(new_york.offset_at(Datetime(2060, 3, 14, 12, 0, 0, 0, 0, 0, TZ::UTC)).is_dst);
+    EXPECT_FALSE(new_york.offset_at(Datetime(2060, 3, 7, 12, 0, 0, 0, 0, 0, TZ::UTC)).is_dst);
+}
+
+TEST(TimeZoneDB, convert)
+{
+    REQUIRE_SYSTEM_ZONEINFO();
+    TimeZoneDB& db = TimeZoneDB::system();
+
+    // Europe changes a fortnight after America, so New York is 4 hours behind London between.
+    Datetime london = db.convert(Datetime(2023, 3, 20, 12, 0, 0, 0, 0, 0, TZ::EDT),
+                                 "Europe/London");
+    EXPECT_EQ(london.hour, 16);
+    EXPECT_EQ(london.timezone, TZ::UTC);
+
+    Datetime chicago = db.convert_local(Datetime(2023, 11, 5, 1, 30, 0, 0, 0, 0, TZ::UTC),
+                                        "America/New_York", "America/Chicago");
+    EXPECT_EQ(chicago, Datetime(2023, 11, 5, 0, 30, 0, 0, 0, 0, TZ::CDT));
+    EXPECT_EQ(chicago.timezone, TZ::CDT);
+}
+
+TEST(TimeZoneDB, convert_minute_offsets)
+{
+    REQUIRE_SYSTEM_ZONEINFO();
+    TimeZoneDB& db = TimeZoneDB::system();
+
+    Datetime kolkata = db.convert(Datetime(2023, 1, 1, 12, 0, 0, 0, 0, 0, TZ::UTC), "Asia/Kolkata");
+    EXPECT_EQ(kolkata, Datetime(2023, 1, 1, 17, 30, 0, 0, 0, 0, Timezone(Minutes(-330))));
+    EXPECT_EQ(kolkata.timezone, Timezone(Minutes(-330)));
+
+    Datetime kathmandu = db.convert_local(kolkata, "Asia/Kolkata", "Asia/Kathmandu");
+    EXPECT_EQ(kathmandu.hour, 17);
+    EXPECT_EQ(kathmandu.minute, 45);
+    EXPECT_EQ(kathmandu.timezone, Timezone(Minutes(-345)));
+}
+
+TEST(TimeZoneDB, throws_invalid_argument_on_unknown_zone)
+{
+    TimeZoneDB db = TimeZoneDB("/nonexistent");
+    EXPECT_EQ(db.get_directory(), "/nonexistent");
+    EXPECT_THROW(db.get("America/New_York"), std::invalid_argument);
+    EXPECT_THROW(TimeZoneDB::system().get("../etc/passwd"), std::invalid_argument);
+    EXPECT_THROW(TimeZoneDB::system().get(""), std::invalid_argument);
+    EXPECT_THROW(TimeZoneDB::system().get("Not/A_Zone"), std::invalid_argument);
+}
+
+TEST(ZoneInfo, intervals)
+{
+    ZoneInfo zone = ZoneInfo::from_tzif("Test/Eastern", make_tzif(-5 * 3'600, "EST",
+                                                                  "EST5EDT,M3.2.0,M11.1.0"));
+    int64_t start = Timestamp(Datetime(2023, 3, 12, 7, 0, 0, 0, 0, 0, TZ::UTC)).epoch_nanoseconds
+                    / Timestamp::NANOSECONDS_PER_SECOND;
+    int64_t end = Timestamp(Datetime(2023, 11, 5, 6, 0, 0, 0, 0, 0, TZ::UTC)).epoch_nanoseconds
+                  / Timestamp::NANOSECONDS_PER_SECOND;
+
+    ZoneInfo::Interval summer = zone.interval_at(start + 1'000);
+    EXPECT_EQ(summer.begin, start);
+    EXPECT_EQ(summer.end, end);
+    EXPECT_EQ(summer.utc_offset_seconds, 4 * 3'600);
+
+    // In local time, summer starts after the skipped hour and ends before the repeated one.
+    ZoneInfo::Interval local = zone.local_interval_at(start);
+    EXPECT_EQ(local.begin, start - 4 * 3'600);
+    EXPECT_EQ(local.end, end - 5 * 3'600);
+    EXPECT_EQ(local.utc_offset_seconds, 4 * 3'600);
+
+    // 02:30 on the day summer starts never happens.
+    ZoneInfo::Interval skipped = zone.local_interval_at(start - 5 * 3'600 + 1'800);
+    EXPECT_EQ(skipped.begin, skipped.end);
+    EXPECT_EQ(skipped.utc_offset_seconds, 5 * 3'600);
+}
+
+TEST(ZoneConverter, matches_zone_rules)
+{
+    ZoneInfo eastern = ZoneInfo::from_tzif("Test/Eastern", make_tzif(-5 * 3'600, "EST",
+                                                                     "EST5EDT,M3.2.0,M11.1.0"));
+    ZoneInfo sydney = ZoneInfo::from_tzif("Test/Sydney", make_tzif(10 * 3'600, "AEST",
+                                                                   "AEST-10AEDT,M10.1.0,M4.1.0/3"));
+    ZoneConverter converter = ZoneConverter(eastern, sydney);
+
+    // Every 17 minutes for two years, across both zones' changes.
+    std::vector<Timestamp> local;
+    int64_t first = Timestamp(Datetime(2023, 1, 1, 0, 0, 0, 0, 0, 0, TZ::UTC)).epoch_nanoseconds;
+    for (int64_t i = 0; i < 2 * 365 * 24 * 60 / 17; i++)
+        local.push_back(Timestamp(first + i * 17 * Timestamp::NANOSECONDS_PER_MINUTE + 123));
+
+    std::vector<Timestamp> out(local.size());
+    converter.convert(local, out);
+    for (size_t i = 0; i < local.size(); i++)
+    {
+        int64_t local_seconds = whole_seconds(local[i]);
+        int64_t utc_seconds = eastern.local_to_utc(local_seconds);
+        int64_t expected = utc_seconds - sydney.offset_at(utc_seconds).utc_offset_seconds;
+        ASSERT_EQ(whole_seconds(out[i]), expected) << i;
+        ASSERT_EQ(out[i].epoch_nanoseconds % Timestamp::NANOSECONDS_PER_SECOND, 123);
+    }
+
+    ZoneConverter::Stats stats = converter.get_stats();
+    EXPECT_EQ(stats.hits + stats.misses, local.size());
+    EXPECT_GT(stats.hit_rate(), 0.99);
+
+    converter.reset_stats();
+    EXPECT_EQ(converter.get_stats().hits, 0);
+    EXPECT_EQ(converter.get_stats().hit_rate(), 0.0);
+    EXPECT_EQ(converter.convert(local.back()), out.back());
+    EXPECT_EQ(converter.get_stats().hits, 1);
+}
+
+TEST(ZoneConverter, fixed_timezones)
+{
+    std::vector<Timestamp> local = {Timestamp(0), Timestamp(Timestamp::NANOSECONDS_PER_DAY)};
+    ZoneConverter::Stats stats = ZoneConverter::convert(local, TZ::EST, TZ::PST, local);
+
+    EXPECT_EQ(local[0].epoch_nanoseconds, -3 * Timestamp::NANOSECONDS_PER_HOUR);
+    EXPECT_EQ(local[1].epoch_nanoseconds,
+              Timestamp::NANOSECONDS_PER_DAY - 3 * Timestamp::NANOSECONDS_PER_HOUR);
+    EXPECT_EQ(stats.hits, 2);
+    EXPECT_EQ(stats.misses, 0);
+}
+
+TEST(ZoneConverter, throws_invalid_argument_on_size_mismatch)
+{
+    std::vector<Timestamp> local(3);
+    std::vector<Timestamp> out(2);
+    EXPECT_THROW(ZoneConverter::convert(local, TZ::UTC, TZ::UTC, out), std::invalid_argument);
+}